@@ -68,6 +68,10 @@ bool run_app(std::vector<std::string> const& vargs)
     ImGuiIO &io = ImGui::GetIO();
     auto config_args = shell.cmdline_args;
 
+    if (!config_args.profiling_trace_file.empty()) {
+        set_profiling_thread_name("Main");
+        set_profiling_trace_enabled(true);
+    }
     ProfilingScope profile_init("Initialization");
 
     std::unique_ptr<RenderBackend> renderer = Shell::create_standard_renderer(config_args.renderer, shell.display);
@@ -592,5 +596,8 @@ bool run_app(std::vector<std::string> const& vargs)
         }
     }
 
+    if (!config_args.profiling_trace_file.empty())
+        write_profiling_trace(config_args.profiling_trace_file.c_str());
+
     return app_state.tracked_file_has_changed;
 }
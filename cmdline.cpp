@@ -36,6 +36,9 @@ static char const* const s_usage =
     "\t--backend <backend>          Use the given backend. The last one specified wins.\n"
 #if ENABLE_VULKAN
     "\t                             vulkan: Render with Vulkan Ray Tracing\n"
+#endif
+#if ENABLE_CPU_BACKEND
+    "\t                             cpu: Render with the CPU reference path tracer\n"
 #endif
     "\n"
     "Validation mode:\n"
@@ -66,6 +69,9 @@ static char const* const s_usage =
     "\t                             Defaults to 60. Ignored unless in profiling mode.\n"
     "\t--profiling-img <prefix>     Also store the framebuffer after each keyframe in\n"
     "\t                             prefix_<keyframe>.pfm. Ignored unless in profiling mode.\n"
+    "\t--profiling-trace <file>     Record a timeline of all profiling scopes on all threads\n"
+    "\t                             and store it in file as Chrome trace JSON on exit, for\n"
+    "\t                             chrome://tracing or ui.perfetto.dev. Works in all modes.\n"
     "\n"
     "Example for running 3 frames of a given config in profiling mode:\n"
     "\t./rptr path/to/scene.vks --profiling example_prefix --profiling-fps 3 --config path/to/example_config.ini\n"
@@ -96,6 +102,13 @@ static char const* const s_usage =
     "\t--data-capture-albedo-roughness   Store the albedo (RGB) and roughness (A) aovs.\n"
     "\t--data-capture-normal-depth       Store the normal (RGB) and depth (A) aovs.\n"
     "\t--data-capture-motion             Store the motion vector (RGB) aovs\n"
+    "\t--data-capture-display            Also store the tone mapped display image, post-processed\n"
+    "\t                                  on the CPU from the rgba buffer, in <prefix>_display.png.\n"
+    "\t--data-capture-raw                Store the selected buffers of all frames unencoded in\n"
+    "\t                                  preallocated, memory-mapped <prefix>_<nnn>.rptrcap files.\n"
+    "\t                                  Convert them to images with convert_capture.\n"
+    "\t--data-capture-raw-frames <n>     Frames per raw capture file. Defaults to one logical\n"
+    "\t                                  second per keyframe.\n"
     "\n"
     "\t By default, the rgba buffer and all aovs are stored.\n"
     "\t The order of the arguments on the command line matters. This way, you can render\n"
@@ -111,6 +124,9 @@ struct ApiDescriptor {
 static constexpr ApiDescriptor available_apis[] = {
 #if ENABLE_VULKAN
   {"vulkan", "vk"},
+#endif
+#if ENABLE_CPU_BACKEND
+  {"cpu", "gl"},
 #endif
   {"unused", "unused"} // We don't count this one, it simply swallows a comma.
 };
@@ -403,6 +419,10 @@ ProgramArgs parse(Shell::DefaultArgs* optional_shell_args, std::vector<std::stri
         have_profiling_options = true;
         consume(vargs, i, shell.profiling_img_prefix);
     }
+    else if (vargs[i] == "--profiling-trace")
+    {
+        consume(vargs, i, shell.profiling_trace_file);
+    }
     else if (vargs[i] == "--benchmark-file")
     {
       println(CLL::CRITICAL, "--benchmark-file <name>.csv is now --profiling <name>");
@@ -447,6 +467,20 @@ ProgramArgs parse(Shell::DefaultArgs* optional_shell_args, std::vector<std::stri
     {
         shell.data_capture.motion = true;
     }
+    else if (vargs[i] == "--data-capture-display")
+    {
+        shell.data_capture.display = true;
+    }
+    else if (vargs[i] == "--data-capture-raw")
+    {
+        shell.data_capture.raw = true;
+    }
+    else if (vargs[i] == "--data-capture-raw-frames")
+    {
+        consume(vargs, i, shell.data_capture.raw_frames);
+        if (shell.data_capture.raw_frames < 1)
+            shell.data_capture.raw_frames = 1;
+    }
     else if (vargs[i] == "--exr")
     {
         shell.image_format = OUTPUT_IMAGE_FORMAT_EXR;
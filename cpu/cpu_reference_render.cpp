@@ -0,0 +1,120 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Headless reference render: accumulates the given number of samples per pixel
+// of a scene with the CPU path tracer, reports the sample and ray throughput and
+// writes the linear average as an EXR image for comparison with GPU backends.
+
+#include "render_cpu.h"
+#include "scene.h"
+#include "write_image.h"
+#include "parallel.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+void print_usage(char const* exe) {
+    printf("Usage: %s <scene.vks> [options]\n"
+           "  --spp <n>             samples per pixel (default 64)\n"
+           "  --batch <n>           samples per pixel per frame (default 4)\n"
+           "  --img <w> <h>         image resolution (default 1280 720)\n"
+           "  --camera <i>          scene camera index (default 0)\n"
+           "  --out <file.exr>      output image (default cpu_reference.exr)\n"
+           "  --threads <n>         number of worker threads (default all)\n", exe);
+}
+
+RenderCameraParams scene_camera(Scene const& scene, int camera_idx) {
+    CameraDesc camera;
+    if (camera_idx < ilen(scene.cameras))
+        camera = scene.cameras[camera_idx];
+    else {
+        // look at the scene from the corner of its bounds
+        AABB bounds = scene.compute_bounds();
+        camera.center = bounds.center();
+        camera.position = bounds.center() + bounds.extent() * 0.75f;
+        camera.up = glm::vec3(0.0f, 1.0f, 0.0f);
+        camera.fov_y = 60.0f;
+    }
+    RenderCameraParams params;
+    params.pos = camera.position;
+    params.dir = glm::normalize(camera.center - camera.position);
+    params.up = camera.up;
+    params.fovy = camera.fov_y;
+    return params;
+}
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    std::string scene_file;
+    std::string out_file = "cpu_reference.exr";
+    int width = 1280, height = 720;
+    int spp = 64, batch_spp = 4;
+    int camera_idx = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        bool has_arg = i + 1 < argc;
+        if (!strcmp(argv[i], "--img") && i + 2 < argc) {
+            sscanf(argv[++i], "%i", &width);
+            sscanf(argv[++i], "%i", &height);
+        }
+        else if (!strcmp(argv[i], "--spp") && has_arg)
+            sscanf(argv[++i], "%i", &spp);
+        else if (!strcmp(argv[i], "--batch") && has_arg)
+            sscanf(argv[++i], "%i", &batch_spp);
+        else if (!strcmp(argv[i], "--camera") && has_arg)
+            sscanf(argv[++i], "%i", &camera_idx);
+        else if (!strcmp(argv[i], "--out") && has_arg)
+            out_file = argv[++i];
+        else if (!strcmp(argv[i], "--threads") && has_arg)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else if (argv[i][0] != '-' && scene_file.empty())
+            scene_file = argv[i];
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (scene_file.empty() || width < 1 || height < 1 || spp < 1 || batch_spp < 1 || camera_idx < 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    Scene scene({scene_file});
+    RenderCPU renderer;
+    renderer.initialize(width, height);
+    renderer.set_scene(scene);
+    renderer.update_config(SceneConfig{});
+    renderer.params.batch_spp = batch_spp;
+
+    RenderConfiguration config = {};
+    config.camera = scene_camera(scene, camera_idx);
+    double render_ms = 0.0, rays = 0.0;
+    while (renderer.accumulated_spp() < spp) {
+        renderer.begin_frame(nullptr, config);
+        renderer.draw_frame(nullptr);
+        RenderStats stats = renderer.stats();
+        render_ms += stats.render_time;
+        if (stats.rays_per_second > 0.0f)
+            rays += double(stats.rays_per_second) * stats.render_time * 0.001;
+    }
+
+    double seconds = render_ms * 0.001;
+    double samples = double(renderer.accumulated_spp()) * width * height;
+    printf("%dx%d, %d spp in %.2f s, %d threads\n", width, height, renderer.accumulated_spp(), seconds, parallel_thread_count());
+    printf("%.2f Msamples/s, %.2f Mrays/s\n", samples / seconds * 1.e-6, rays / seconds * 1.e-6);
+
+    std::vector<float> pixels(size_t(width) * height * 4);
+    renderer.readback_framebuffer(pixels.size(), pixels.data());
+    if (!WriteImage::write_exr(out_file.c_str(), width, height, 4, pixels.data(), EXR_COMPRESSION_ZIP)) {
+        printf("Failed to write %s\n", out_file.c_str());
+        return 1;
+    }
+    return 0;
+}
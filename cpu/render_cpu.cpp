@@ -0,0 +1,702 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "render_cpu.h"
+#include "scene.h"
+#include "sky_light.h"
+#include "sky_sampling.h"
+#include "compute_cpu.h"
+#include "parallel.h"
+#include "profiling.h"
+#include "types.h"
+#include "util.h"
+#include "error_io.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace glsl {
+
+using namespace glm;
+// shadow the generic min/max of types.h, which are ambiguous with glm's
+using glm::min;
+using glm::max;
+#include "../rendering/language.hpp"
+
+// same conventions as the GPU path tracer
+#define RAY_EPSILON 0.000005f
+#define SAMPLE_PIXEL_FILTER(urand) (urand - vec2(0.5f))
+#define PREMULTIPLIED_BASE_COLOR_ALPHA
+
+// textures are sampled by the host functions below, not through standard texture slots
+#undef UNROLL_STANDARD_TEXTURES
+#define MATERIAL_DECODE_CUSTOM_TEXTURES
+
+struct CpuVertexBuffer {
+    vec3 const* v;
+};
+struct CpuMaterialIdBuffer {
+    uint32_t const* id_4pack;
+};
+#define PLAIN_VERTEX_BUFFER_TYPE CpuVertexBuffer
+#define MATERIAL_ID_BUFFER_TYPE CpuMaterialIdBuffer
+
+#include "../rendering/defaults.glsl"
+#include "../rendering/pathspace.h"
+#include "../rendering/bsdfs/hit_point.glsl"
+#include "../rendering/rt/hit.glsl"
+#include "../rendering/rt/materials.glsl"
+#include "../rendering/bsdfs/gltf_bsdf.glsl"
+#include "../rendering/lights/tri.glsl"
+#include "../rendering/lights/sky_model_arhosek/sky_model.glsl"
+#include "../rendering/lights/sky_map.glsl"
+
+// RGBA8 texels of the finest mip level, sampled bilinearly with wrapping
+struct CpuTexture {
+    int width = 0;
+    int height = 0;
+    uint8_t const* texels = nullptr;
+    bool srgb = false;
+};
+
+struct CpuSceneParams {
+    SkyModelParams sky_params;
+    vec3 sun_dir;
+    float sun_cos_angle;
+    vec4 sun_radiance;
+    float normal_z_scale;
+    SkySamplingParams sky_sampling;
+};
+
+// everything the shared shading code reads, fixed while samples accumulate
+struct CpuShadingContext {
+    CpuSceneParams scene_params;
+    RenderParams render_params;
+    float light_mis_angle = 0.0f;
+    TriLight const* lights = nullptr;
+    int light_count = 0;
+    int bin_size = 1;
+    SkySamplingMap sky_map;
+
+    BaseMaterial const* materials = nullptr;
+    std::vector<CpuTexture> textures;
+    bool has_alpha_materials = false;
+
+    Scene const* scene = nullptr;
+    CpuRaytracer const* raytracer = nullptr;
+    mat3 const* normals_to_world = nullptr;
+    std::vector<uint32_t> const* geometry_tri_offsets = nullptr;
+
+    // pinhole camera, as in the GPU view parameters
+    vec3 cam_pos;
+    vec3 cam_du;
+    vec3 cam_dv;
+    vec3 cam_dir_top_left;
+    ivec2 frame_dims;
+};
+
+// set by every worker before shading
+thread_local CpuShadingContext const* shading_context = nullptr;
+thread_local float geometry_scale = 0.0f;
+thread_local uint64_t ray_count = 0;
+
+#define scene_params (shading_context->scene_params)
+#define SCENE_GET_LIGHT_SOURCE(light_id) shading_context->lights[light_id]
+#define SCENE_GET_LIGHT_SOURCE_COUNT() shading_context->light_count
+#define SCENE_GET_SKY_MAP_VALUE(index) shading_context->sky_map.data[index]
+#define BINNED_LIGHTS_BIN_SIZE shading_context->bin_size
+#define SCENE_GET_BINNED_LIGHTS_BIN_COUNT() ((shading_context->light_count + (shading_context->bin_size - 1)) / shading_context->bin_size)
+
+#include "../rendering/rt/material_textures.glsl"
+#include "../rendering/mc/nee.glsl"
+
+inline float srgb_texel_to_linear(uint8_t texel) {
+    static float const* lut = [] {
+        static float table[256];
+        for (int i = 0; i < 256; ++i)
+            table[i] = srgb_to_linear(float(i) / 255.0f);
+        return table;
+    }();
+    return lut[texel];
+}
+
+inline vec4 sample_texture(uint32_t tex_id, vec2 uv) {
+    CpuTexture const& tex = shading_context->textures[tex_id];
+    vec2 st = uv * vec2(tex.width, tex.height) - vec2(0.5f);
+    vec2 st_floor = floor(st);
+    vec2 f = st - st_floor;
+    int x0 = int(st_floor.x), y0 = int(st_floor.y);
+
+    vec4 texels[4];
+    for (int i = 0; i < 4; ++i) {
+        int x = (x0 + (i & 1)) % tex.width;
+        int y = (y0 + (i >> 1)) % tex.height;
+        x += x < 0 ? tex.width : 0;
+        y += y < 0 ? tex.height : 0;
+        uint8_t const* texel = tex.texels + 4 * (size_t(y) * tex.width + x);
+        for (int c = 0; c < 4; ++c)
+            texels[i][c] = tex.srgb && c < 3 ? srgb_texel_to_linear(texel[c]) : float(texel[c]) / 255.0f;
+    }
+    return mix(mix(texels[0], texels[1], f.x), mix(texels[2], texels[3], f.x), f.y);
+}
+
+inline vec4 textured_color_param(const vec4 x, GLSL_in(HitPoint) hit) {
+    const uint32_t mask = floatBitsToUint(x.x);
+    if (IS_TEXTURED_PARAM(mask) != 0)
+        return sample_texture(GET_TEXTURE_ID(mask), hit.uv);
+    return x;
+}
+inline float textured_scalar_param(const float x, GLSL_in(HitPoint) hit) {
+    const uint32_t mask = floatBitsToUint(x);
+    if (IS_TEXTURED_PARAM(mask) != 0)
+        return sample_texture(GET_TEXTURE_ID(mask), hit.uv)[GET_TEXTURE_CHANNEL(mask)];
+    return x;
+}
+
+inline float geometry_scale_to_tmin(vec3 orig, float geometry_scale) {
+    return (length(orig) + geometry_scale) * RAY_EPSILON;
+}
+
+inline RTHit cpu_hit_attributes(CpuRayHit const& ray_hit, float ray_t, vec3 const& p, GLSL_out(float) alpha) {
+    Scene const& scene = *shading_context->scene;
+    Instance const& instance = scene.instances[ray_hit.instance_id];
+    ParameterizedMesh const& pm = scene.parameterized_meshes[instance.parameterized_mesh_id];
+    Geometry const& geom = scene.meshes[pm.mesh_id].geometries[ray_hit.geometry_id];
+    int prim = ray_hit.primitive_id;
+
+    mat3 verts;
+    geom.tri_positions(prim, verts[0], verts[1], verts[2]);
+    bool has_normals = !geom.normals.empty();
+    bool has_uvs = (geom.format_flags & Geometry::QuantizedNormalsAndUV) ? has_normals : !geom.uvs.empty();
+    mat3 normals(0.0f);
+    if (has_normals)
+        geom.tri_normals(prim, normals[0], normals[1], normals[2]);
+    mat3x2 uvs(0.0f);
+    if (has_uvs)
+        geom.tri_uvs(prim, uvs[0], uvs[1], uvs[2]);
+
+    int material_id = pm.material_offset(ray_hit.geometry_id);
+    if (pm.per_triangle_materials()) {
+        uint32_t tri_offset = shading_context->geometry_tri_offsets[pm.mesh_id][ray_hit.geometry_id];
+        material_id += pm.triangle_material_id(tri_offset + prim);
+    }
+
+    RTHit hit = calc_hit_attributes(ray_t, uint(prim), ray_hit.barycentrics
+        , verts, uvec3(0, 1, 2), shading_context->normals_to_world[ray_hit.instance_id]
+        , normals, has_normals, uvs, has_uvs
+        , material_id, CpuMaterialIdBuffer{ nullptr });
+
+    alpha = 1.0f;
+    BaseMaterial const& params = shading_context->materials[hit.material_id];
+    if ((params.flags & BASE_MATERIAL_NOALPHA) == 0)
+        alpha = get_material_alpha(uint32_t(hit.material_id), params, HitPoint{p, hit.uv, mat2(0.0f), vec3(0.0f)});
+    return hit;
+}
+
+// closest hit, skipping alpha-tested cut-outs as the GPU any-hit shader does
+inline bool raytrace_closest_hit(const vec3 origin, const vec3 dir, float t_min, float t_max, GLSL_out(RTHit) hit) {
+    for (;;) {
+        ++ray_count;
+        CpuRayHit ray_hit = shading_context->raytracer->trace_ray(origin + t_min * dir, dir, t_max - t_min);
+        if (!ray_hit.hit())
+            return false;
+        float t = t_min + ray_hit.t;
+        vec3 p = origin + t * dir;
+        float alpha;
+        hit = cpu_hit_attributes(ray_hit, t, p, alpha);
+        if (alpha > 0.5f)
+            return true;
+        // continue behind the cut-out
+        t_min = t + geometry_scale_to_tmin(p, geometry_scale);
+        if (!(t_min < t_max))
+            return false;
+    }
+}
+
+inline bool raytrace_test_visibility(const vec3 from, const vec3 dir, float dist) {
+    float epsilon = geometry_scale_to_tmin(from, geometry_scale);
+    if (!(dist - 2.f * epsilon > 0.0f))
+        return false;
+    if (!shading_context->has_alpha_materials) {
+        ++ray_count;
+        return !shading_context->raytracer->occluded(from + epsilon * dir, dir, dist - 2.f * epsilon);
+    }
+    RTHit hit;
+    return !raytrace_closest_hit(from, dir, epsilon, dist - epsilon, hit);
+}
+
+inline vec4 trace_path(ivec2 pixel, uint32_t sample_index) {
+    RenderParams const& render_params = shading_context->render_params;
+    const vec2 dims = vec2(shading_context->frame_dims);
+
+    RANDOM_STATE rng = GET_RNG(sample_index, 0, uvec4(pixel.x, pixel.y, shading_context->frame_dims.x, shading_context->frame_dims.y));
+
+    vec2 d = vec2(pixel.x + 0.5f, pixel.y + 0.5f);
+    d += SAMPLE_PIXEL_FILTER(RANDOM_FLOAT2(rng, DIM_PIXEL_X));
+    d /= dims;
+
+    vec3 ray_origin = shading_context->cam_pos;
+    vec3 ray_dir = normalize(d.x * shading_context->cam_du + d.y * shading_context->cam_dv + shading_context->cam_dir_top_left);
+    float t_min = 0;
+    float t_max = 1e20f;
+
+    if (render_params.aperture_radius > 0.0f) {
+        vec3 focus = ray_origin + render_params.focus_distance * ray_dir;
+        vec2 r2 = RANDOM_FLOAT2(rng, DIM_APERTURE_X);
+        r2 = vec2(cos(2.0f * M_PI * r2.x), sin(2.0f * M_PI * r2.x)) * sqrt(r2.y);
+        r2 *= render_params.aperture_radius;
+        ray_origin += r2.x * normalize(shading_context->cam_du);
+        ray_origin += r2.y * normalize(shading_context->cam_dv);
+        ray_dir = normalize(focus - ray_origin);
+    }
+
+    RANDOM_SET_DIM(rng, DIM_CAMERA_END);
+
+    float total_t = 0.0f;
+    geometry_scale = 0.0f;
+
+    int bounce = 0, realBounce = 0;
+    vec3 illum = vec3(0.f);
+    vec3 path_throughput = vec3(1.f);
+    // data for emitter MIS
+    vec3 prev_wo = vec3(-ray_dir);
+    vec3 prev_n = ray_dir;
+    float prev_bsdf_pdf = 2.0e16f;
+
+    do {
+        RTHit payload;
+        if (!raytrace_closest_hit(ray_origin, ray_dir, t_min, t_max, payload)) {
+            if (render_params.output_channel != 0)
+                break;
+            // sky and sun, as in the miss shader
+            vec3 dir = ray_dir;
+            float ocean_coeff = sky_ocean_mirror(dir);
+            NEEQueryPoint query;
+            query.point = ray_origin;
+            query.normal = prev_n;
+            query.w_o = prev_wo;
+            query.info = NEEQueryInfo{0};
+            float sky_w = nee_mis_heuristic(1.f, prev_bsdf_pdf, 1.f, eval_direct_sky_light_pdf(query, ray_dir));
+            illum += sky_w * path_throughput * sky_atmosphere_radiance(scene_params.sky_params, scene_params.sun_dir, ray_dir);
+            if (dot(dir, scene_params.sun_dir) >= scene_params.sun_cos_angle) {
+                float light_pdf = eval_direct_sun_light_pdf(query, ray_dir);
+                float w = nee_mis_heuristic(1.f, prev_bsdf_pdf, 1.f, light_pdf);
+                illum += w * path_throughput * vec3(scene_params.sun_radiance) * ocean_coeff;
+            }
+            break;
+        }
+
+        float approx_tri_solid_angle = length(payload.geo_normal);
+        payload.geo_normal /= approx_tri_solid_angle;
+        approx_tri_solid_angle *= abs(dot(payload.geo_normal, ray_dir)) / (payload.dist * payload.dist);
+
+        total_t += payload.dist;
+        geometry_scale = total_t;
+        // reference rendering: no texture filtering footprint
+        mat2 duvdxy = mat2(0.0f);
+
+        vec3 w_o = -ray_dir;
+        InteractionPoint interaction;
+        interaction.p = ray_origin + payload.dist * ray_dir;
+
+        BaseMaterial const& material_params = shading_context->materials[payload.material_id];
+        MATERIAL_TYPE mat;
+        EmitterParams emit;
+        unpack_material(mat, emit
+            , uint32_t(payload.material_id), material_params
+            , HitPoint{interaction.p, payload.uv, duvdxy, vec3(0.0)});
+        vec3 scatter_throughput = path_throughput;
+
+        // direct emitter hit
+        if (render_params.output_channel == 0 && emit.radiance != vec3(0.0f)) {
+            float w = 1.0f;
+            if (shading_context->light_mis_angle > 0.0f)
+                w = nee_mis_heuristic(1.f, prev_bsdf_pdf, 1.f, 1.0f / shading_context->light_mis_angle);
+            else if (SCENE_GET_LIGHT_SOURCE_COUNT() > 0)
+                w = nee_mis_heuristic(1.f, prev_bsdf_pdf, 1.f, wpdf_direct_tri_light(approx_tri_solid_angle, ray_origin, ray_dir));
+            illum += w * scatter_throughput * emit.radiance;
+        }
+
+        interaction.gn = payload.geo_normal;
+        interaction.n = payload.normal;
+        // For opaque objects (or in the future, thin ones) make the normal face forward
+        if ((mat.flags & BASE_MATERIAL_ONESIDED) == 0 && dot(w_o, interaction.gn) < 0.0) {
+            interaction.n = -interaction.n;
+            interaction.gn = -interaction.gn;
+        }
+
+        // apply normal mapping
+        int normal_map = material_params.normal_map;
+        if (normal_map != -1) {
+            vec3 v_y = normalize( cross(payload.normal, payload.tangent) );
+            vec3 v_x = cross(v_y, payload.normal);
+            v_x *= length(payload.tangent);
+            v_y *= payload.bitangent_l;
+
+            vec3 map_nrm = vec3(sample_texture(uint32_t(normal_map), payload.uv));
+            map_nrm = vec3(2.0f, 2.0f, 1.0f) * map_nrm - vec3(1.0f, 1.0f, 0.0f);
+            // Z encoding might be unclear, just reconstruct
+            map_nrm.z = sqrt(max(1.0f - map_nrm.x * map_nrm.x - map_nrm.y * map_nrm.y, 0.0f));
+            mat3 iT_shframe = mat3(v_x, v_y, scene_params.normal_z_scale * interaction.n);
+            interaction.n = normalize(iT_shframe * map_nrm);
+        }
+
+        // fix incident directions under geo hemisphere
+        {
+            float nw = dot(w_o, interaction.n);
+            float gnw = dot(w_o, interaction.gn);
+            if (nw * gnw <= 0.0f) {
+                float blend = gnw / (gnw - nw);
+                interaction.n = normalize( mix(interaction.gn, interaction.n, blend - EPSILON) );
+            }
+        }
+
+        interaction.v_y = normalize( cross(interaction.n, payload.tangent) );
+        interaction.v_x = cross(interaction.v_y, interaction.n);
+
+        if (render_params.output_channel == 0 && bounce+1 < render_params.max_path_depth) {
+            // first two dimensions light position selection, last light selection (sky/direct)
+            vec2 dir_sample = RANDOM_FLOAT2(rng, DIM_POSITION_X);
+            vec2 sel_sample = RANDOM_FLOAT2(rng, DIM_LIGHT_SEL_1);
+            NEEQueryAux nee_aux;
+            nee_aux.mis_pdf = shading_context->light_mis_angle > 0.0f ? 1.0f / shading_context->light_mis_angle : 0.0f;
+            illum += scatter_throughput * sample_direct_light(mat, interaction, w_o, dir_sample, sel_sample, nee_aux);
+        }
+        RANDOM_SHIFT_DIM(rng, DIM_LIGHT_END);
+
+        if (render_params.output_channel != 0) {
+            if (render_params.output_channel == 1)
+                illum += scatter_throughput * mat.base_color;
+            else if (render_params.output_channel == 2)
+                illum += interaction.n;
+            else if (render_params.output_channel == 3)
+                illum += interaction.p;
+        }
+
+        {
+            vec3 w_i;
+            float sampling_pdf, mis_wpdf;
+            vec3 bsdf = sample_bsdf(mat, interaction, w_o, w_i, sampling_pdf, mis_wpdf
+                , RANDOM_FLOAT2(rng, DIM_DIRECTION_X), RANDOM_FLOAT2(rng, DIM_LOBE), rng);
+            RANDOM_SHIFT_DIM(rng, DIM_VERTEX_END);
+            // Must increment before the break statement below or the alpha channel
+            // will be accumulated incorrectly.
+            ++bounce;
+            if (mis_wpdf == 0.f || bsdf == vec3(0.f) || !(dot(w_i, interaction.n) * dot(w_i, interaction.gn) > 0.0f)) {
+                break;
+            }
+            path_throughput *= bsdf;
+
+            prev_wo = w_o;
+            prev_bsdf_pdf = mis_wpdf;
+            prev_n = interaction.n;
+
+            ray_dir = w_i;
+        }
+        ray_origin = interaction.p;
+        t_min = geometry_scale_to_tmin(ray_origin, total_t);
+        t_max = 1e20f;
+        ++realBounce;
+
+        // Russian roulette termination
+        if (bounce >= render_params.rr_path_depth) {
+            float prefix_weight = max(path_throughput.x, max(path_throughput.y, path_throughput.z));
+
+            float rr_prob = prefix_weight;
+            if (bounce > 6)
+                rr_prob = min(0.95f, rr_prob);
+            else
+                rr_prob = min(1.0f, rr_prob);
+
+            float rr_sample = RANDOM_FLOAT1(rng, DIM_RR);
+
+            if (rr_sample < rr_prob)
+                path_throughput /= rr_prob;
+            else
+                break;
+        }
+
+        RANDOM_SET_DIM(rng, DIM_CAMERA_END + realBounce * (DIM_VERTEX_END + DIM_LIGHT_END));
+    } while (bounce < render_params.max_path_depth);
+
+    return vec4(illum, bounce == 0 ? 0.0f : 1.0f);
+}
+
+#undef scene_params
+
+} // namespace
+
+namespace {
+
+constexpr int TILE_SIZE = 16;
+
+bool has_animated_transforms(Scene const& scene) {
+    for (auto const& anim : scene.animation_data)
+        if (anim.numAnimatedTransforms > 0 && anim.numFrames > 1)
+            return true;
+    return false;
+}
+
+} // namespace
+
+RenderCPU::RenderCPU() {
+}
+
+RenderCPU::~RenderCPU() {
+}
+
+std::string RenderCPU::name() const {
+    return "cpu";
+}
+
+void RenderCPU::initialize(const int fb_width, const int fb_height) {
+    fb_dims = glm::ivec2(fb_width, fb_height);
+    accum_buffer.assign(size_t(fb_width) * fb_height, glm::vec4(0.0f));
+    accumulated_samples = 0;
+}
+
+void RenderCPU::set_scene(const Scene &scene) {
+    // mesh BVHs are kept for the same scene, fresh ones are built for newly loaded scenes
+    if (unique_scene_id != scene.unqiue_id)
+        raytracer = CpuRaytracer();
+    unique_scene_id = scene.unqiue_id;
+
+    // the scene may be released after this call, so keep what rendering and animation read;
+    // geometry, material ids and transforms share their buffers with the scene
+    std::unique_ptr<Scene> kept(new Scene());
+    kept->meshes = scene.meshes;
+    kept->parameterized_meshes = scene.parameterized_meshes;
+    kept->instances = scene.instances;
+    kept->materials = scene.materials;
+    kept->animation_data = scene.animation_data;
+    kept->unqiue_id = scene.unqiue_id;
+    this->scene = std::move(kept);
+
+    animation_frame = scene.animation_data.empty() ? 0 : scene.animation_data[0].frame_at(time);
+    raytracer.set_scene(scene, animation_frame);
+    update_instance_frames();
+
+    geometry_tri_offsets.resize(scene.meshes.size());
+    for (size_t i = 0; i < scene.meshes.size(); ++i) {
+        auto& offsets = geometry_tri_offsets[i];
+        offsets.clear();
+        uint32_t offset = 0;
+        for (auto const& geom : scene.meshes[i].geometries) {
+            offsets.push_back(offset);
+            offset += uint32_t(geom.num_tris());
+        }
+    }
+
+    // the CPU samples uncompressed texels
+    textures.resize(scene.textures.size());
+    parallel_for(0, ilen(scene.textures), 1, [&](index_t i, int) {
+        Image const& image = scene.textures[i];
+        textures[i] = image.bcFormat != 0 ? image.decompress() : image;
+        if (textures[i].channels != 4)
+            throw_error("unsupported channel layout in texture %s", image.name.c_str());
+    });
+
+    has_alpha_materials = false;
+    for (auto const& material : scene.materials)
+        has_alpha_materials |= (material.flags & BASE_MATERIAL_NOALPHA) == 0;
+
+    emitters = collect_emitters(scene, time);
+    light_sampling = BinnedLightSampling();
+
+    config_changed = true;
+}
+
+void RenderCPU::update_config(SceneConfig const& config) {
+    scene_config = config;
+    config_changed = true;
+}
+
+void RenderCPU::update_instance_frames() {
+    normals_to_world.resize(scene->instances.size());
+    parallel_for(0, ilen(scene->instances), 1024, [&](index_t i, int) {
+        Instance const& inst = scene->instances[i];
+        AnimationData const& anim = scene->animation_data[inst.animation_data_index];
+        uint32_t frame = anim.numFrames ? std::min(animation_frame, uint32_t(anim.numFrames - 1)) : 0;
+        glm::mat4 transform = anim.dequantize(inst.transform_index, frame);
+        normals_to_world[i] = glm::transpose(glm::inverse(glm::mat3(transform)));
+    });
+}
+
+bool RenderCPU::update_animation(double time) {
+    if (!has_animated_transforms(*scene))
+        return false;
+    uint32_t frame = scene->animation_data[0].frame_at(time);
+    if (frame == animation_frame)
+        return false;
+    animation_frame = frame;
+    // mesh BVHs are unchanged, only the top level and the emitters move
+    raytracer.set_scene(*scene, animation_frame);
+    update_instance_frames();
+    emitters = collect_emitters(*scene, time);
+    light_sampling = BinnedLightSampling();
+    return true;
+}
+
+void RenderCPU::update_shading_context() {
+    if (!shading)
+        shading.reset(new glsl::CpuShadingContext());
+    glsl::CpuShadingContext& ctx = *shading;
+
+    LightSamplingConfig lighting = lighting_params;
+    lighting.bin_size = glm::clamp(lighting.bin_size, 1, BINNED_LIGHTS_BIN_MAX_SIZE);
+    update_light_sampling(light_sampling, emitters, lighting);
+    ctx.lights = light_sampling.emitters.data();
+    ctx.light_count = ilen(light_sampling.emitters);
+    ctx.bin_size = light_sampling.params.bin_size;
+    ctx.light_mis_angle = lighting_params.light_mis_angle;
+
+    SkyLight sky = compute_sky_light(scene_config, ctx.light_count > 0);
+    for (int i = 0; i < 9; ++i)
+        ctx.scene_params.sky_params.configs[i] = sky.configs[i];
+    ctx.scene_params.sky_params.radiances = sky.radiances;
+    ctx.scene_params.sun_dir = sky.sun_dir;
+    ctx.scene_params.sun_cos_angle = sky.sun_cos_angle;
+    ctx.scene_params.sun_radiance = sky.sun_radiance;
+    ctx.scene_params.normal_z_scale = 1.0f / scene_config.bump_scale;
+    build_sky_sampling_map(ctx.sky_map, sky, SKY_MAP_DEFAULT_WIDTH, SKY_MAP_DEFAULT_HEIGHT);
+    ctx.scene_params.sky_sampling.map_width = ctx.sky_map.width;
+    ctx.scene_params.sky_sampling.map_height = ctx.sky_map.height;
+    ctx.scene_params.sky_sampling.probability = sky_sampling_probability(ctx.sky_map, sky);
+    ctx.render_params = params;
+
+    ctx.materials = scene->materials.data();
+    ctx.has_alpha_materials = has_alpha_materials;
+    ctx.textures.resize(textures.size());
+    for (size_t i = 0; i < textures.size(); ++i) {
+        auto& tex = ctx.textures[i];
+        tex.width = textures[i].width;
+        tex.height = textures[i].height;
+        tex.texels = textures[i].img.data();
+        tex.srgb = textures[i].color_space == SRGB;
+    }
+
+    ctx.scene = scene.get();
+    ctx.raytracer = &raytracer;
+    ctx.normals_to_world = normals_to_world.data();
+    ctx.geometry_tri_offsets = geometry_tri_offsets.data();
+
+    glm::vec2 img_plane_size;
+    img_plane_size.y = 2.f * std::tan(glm::radians(0.5f * camera.fovy));
+    img_plane_size.x = img_plane_size.y * float(fb_dims.x) / float(fb_dims.y);
+    ctx.cam_pos = camera.pos;
+    ctx.cam_du = glm::normalize(glm::cross(camera.dir, camera.up)) * img_plane_size.x;
+    ctx.cam_dv = -glm::normalize(glm::cross(ctx.cam_du, camera.dir)) * img_plane_size.y;
+    ctx.cam_dir_top_left = camera.dir - 0.5f * ctx.cam_du - 0.5f * ctx.cam_dv;
+    ctx.frame_dims = fb_dims;
+}
+
+RenderStats RenderCPU::render(const RenderConfiguration &config) {
+    RenderStats stats;
+    if (!scene || fb_dims.x <= 0 || fb_dims.y <= 0)
+        return stats;
+
+    // exposure is only applied on readback
+    RenderParams sample_params = params;
+    sample_params.exposure = last_params.exposure;
+
+    bool reset = config.reset_accumulation || config_changed || !shading;
+    reset |= std::memcmp(&camera, &last_camera, sizeof(camera)) != 0;
+    reset |= std::memcmp(&sample_params, &last_params, sizeof(sample_params)) != 0;
+    reset |= std::memcmp(&lighting_params, &last_lighting_params, sizeof(lighting_params)) != 0;
+    reset |= update_animation(time);
+    if (reset) {
+        last_camera = camera;
+        last_params = params;
+        last_lighting_params = lighting_params;
+        config_changed = false;
+        update_shading_context();
+        std::fill(accum_buffer.begin(), accum_buffer.end(), glm::vec4(0.0f));
+        accumulated_samples = 0;
+    }
+    else if (config.freeze_frame) {
+        stats.spp = accumulated_samples;
+        return stats;
+    }
+
+    BasicProfilingScope render_timer;
+    const int batch_spp = std::max(params.batch_spp, 1);
+    const int tiles_x = (fb_dims.x + TILE_SIZE - 1) / TILE_SIZE;
+    const int tiles_y = (fb_dims.y + TILE_SIZE - 1) / TILE_SIZE;
+    std::vector<uint64_t> thread_rays(parallel_thread_count(), 0);
+    glsl::CpuShadingContext const* ctx = shading.get();
+    // tiles are handed out one at a time, so threads that finish early pick up the remaining work
+    parallel_for(0, index_t(tiles_x) * tiles_y, 1, [&](index_t tile, int thread_idx) {
+        glsl::shading_context = ctx;
+        glsl::ray_count = 0;
+        glm::ivec2 tile_begin = glm::ivec2(int(tile % tiles_x), int(tile / tiles_x)) * TILE_SIZE;
+        glm::ivec2 tile_end = glm::min(tile_begin + glm::ivec2(TILE_SIZE), fb_dims);
+        for (int y = tile_begin.y; y < tile_end.y; ++y) {
+            for (int x = tile_begin.x; x < tile_end.x; ++x) {
+                glm::vec4 sum(0.0f);
+                for (int s = 0; s < batch_spp; ++s) {
+                    glm::vec4 sample = glsl::trace_path(glm::ivec2(x, y), uint32_t(accumulated_samples + s));
+                    // drop invalid samples rather than poisoning the accumulation
+                    if (std::isfinite(sample.x) && std::isfinite(sample.y) && std::isfinite(sample.z))
+                        sum += sample;
+                }
+                accum_buffer[size_t(y) * fb_dims.x + x] += sum;
+            }
+        }
+        thread_rays[thread_idx] += glsl::ray_count;
+    });
+    accumulated_samples += batch_spp;
+    render_timer.end();
+
+    uint64_t total_rays = 0;
+    for (uint64_t rays : thread_rays)
+        total_rays += rays;
+    stats.render_time = float(render_timer.elapsedMS());
+    stats.rays_per_second = stats.render_time > 0.0f ? float(double(total_rays) / (stats.render_time * 0.001)) : -1.0f;
+    stats.spp = accumulated_samples;
+    return stats;
+}
+
+ComputeDevice* RenderCPU::create_compatible_compute_device() const {
+    return new ComputeDeviceCPU();
+}
+
+glm::uvec3 RenderCPU::get_framebuffer_size() const {
+    return glm::uvec3(fb_dims.x, fb_dims.y, 4);
+}
+
+size_t RenderCPU::readback_framebuffer(size_t bufferSize, float *buffer, bool force_refresh) {
+    const size_t size = size_t(fb_dims.x) * fb_dims.y * 4;
+    if (bufferSize < size)
+        return 0;
+    float scale = accumulated_samples > 0 ? 1.0f / float(accumulated_samples) : 0.0f;
+    parallel_for(0, fb_dims.y, 16, [&](index_t y, int) {
+        for (int x = 0; x < fb_dims.x; ++x) {
+            size_t i = size_t(y) * fb_dims.x + x;
+            glm::vec4 c = accum_buffer[i] * scale;
+            std::memcpy(buffer + 4 * i, &c, sizeof(c));
+        }
+    });
+    return size;
+}
+
+size_t RenderCPU::readback_framebuffer(size_t bufferSize, unsigned char *buffer, bool force_refresh) {
+    const size_t size = size_t(fb_dims.x) * fb_dims.y * 4;
+    if (bufferSize < size)
+        return 0;
+    float scale = accumulated_samples > 0 ? std::exp2(params.exposure) / float(accumulated_samples) : 0.0f;
+    parallel_for(0, fb_dims.y, 16, [&](index_t y, int) {
+        for (int x = 0; x < fb_dims.x; ++x) {
+            size_t i = size_t(y) * fb_dims.x + x;
+            glm::vec3 c = glsl::linear_to_srgb(glm::clamp(glm::vec3(accum_buffer[i]) * scale, glm::vec3(0.0f), glm::vec3(1.0f)));
+            for (int k = 0; k < 3; ++k)
+                buffer[4 * i + k] = (unsigned char) (c[k] * 255.0f + 0.5f);
+            buffer[4 * i + 3] = 255;
+        }
+    });
+    return size;
+}
+
+RenderBackend* create_cpu_backend(Display& display) {
+    return new RenderCPU();
+}
@@ -0,0 +1,72 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "render_backend.h"
+#include "cpu_raytracer.h"
+#include "lights.h"
+
+namespace glsl {
+    struct CpuShadingContext;
+}
+
+struct Image;
+
+/* Reference path tracer on the CPU. Runs the integrator of the naive Vulkan
+ * path tracer, compiled from the shared GLSL sources for materials, light
+ * sampling and the sky, on top of the CPU BVH. Image tiles are handed out
+ * dynamically to all worker threads, samples accumulate progressively until
+ * the camera, scene or configuration changes.
+ */
+struct RenderCPU : RenderBackend {
+    RenderCPU();
+    ~RenderCPU();
+
+    std::string name() const override;
+    ComputeDevice* create_compatible_compute_device() const override;
+    void initialize(const int fb_width, const int fb_height) override;
+    void set_scene(const Scene &scene) override;
+    void update_config(SceneConfig const& config) override;
+
+    glm::uvec3 get_framebuffer_size() const override;
+    // sRGB-encoded colors after exposure
+    size_t readback_framebuffer(size_t bufferSize, unsigned char *buffer, bool force_refresh = false) override;
+    // linear average of the accumulated samples
+    size_t readback_framebuffer(size_t bufferSize, float *buffer, bool force_refresh = false) override;
+
+    int accumulated_spp() const { return accumulated_samples; }
+
+protected:
+    RenderStats render(const RenderConfiguration &config) override;
+
+private:
+    void update_shading_context();
+    bool update_animation(double time);
+    void update_instance_frames();
+
+    glm::ivec2 fb_dims = glm::ivec2(0);
+    std::vector<glm::vec4> accum_buffer; // sum of all samples per pixel
+    int accumulated_samples = 0;
+
+    std::unique_ptr<Scene> scene; // the parts of the last scene read while rendering
+    CpuRaytracer raytracer;
+    uint32_t animation_frame = 0;
+    std::vector<glm::mat3> normals_to_world; // per instance
+    std::vector<std::vector<uint32_t>> geometry_tri_offsets; // per mesh, first triangle of each geometry
+    std::vector<Image> textures; // decompressed
+    bool has_alpha_materials = false;
+
+    std::vector<TriLight> emitters;
+    BinnedLightSampling light_sampling;
+    SceneConfig scene_config;
+    std::unique_ptr<glsl::CpuShadingContext> shading;
+
+    // accumulation is reset when any of these change
+    RenderCameraParams last_camera = {};
+    RenderParams last_params;
+    LightSamplingConfig last_lighting_params;
+    bool config_changed = true;
+};
@@ -3,7 +3,9 @@
 
 #include "app_state.h"
 #include "util/profiling.h"
+#include "librender/postprocess_cpu.h"
 
+#include <cstring>
 #include <sstream>
 #include <iomanip>
 #include "types.h"
@@ -65,6 +67,9 @@ bool BasicApplicationState::state(RenderBackend *renderer)
     renderer_changed |= IMGUI_STATE(ImGui::Checkbox, "force bvh rebuild", &renderer->options.force_bvh_rebuild);
     renderer_changed |= IMGUI_STATE(ImGui::SliderInt, "rebuild triangle budget", &renderer->options.rebuild_triangle_budget, 0, 10000000);
 #endif
+    renderer_changed |= IMGUI_STATE(ImGui::Checkbox, "per-instance LoD selection", &renderer->options.enable_lod_selection);
+    if (renderer->options.enable_lod_selection)
+        renderer_changed |= IMGUI_STATE(ImGui::Checkbox, "LoD frustum culling", &renderer->options.lod_frustum_culling);
 
     // todo: move to extension?
 
@@ -343,32 +348,31 @@ bool BasicApplicationState::save_framebuffer_png(const char *prefix,
 {
     const glm::uvec3 fbSize = renderer->get_framebuffer_size();
     const size_t bufferSize = fbSize.x * static_cast<size_t>(fbSize.y) * fbSize.z;
-    readback_buffer_byte.resize(bufferSize);
+    ImageWriteBuffer pixels = image_writer.acquire(bufferSize);
 
     BasicProfilingScope readbackScope;
     readbackScope.begin();
-    const bool available = bufferSize == renderer->readback_framebuffer(bufferSize, readback_buffer_byte.data());
+    const bool available = bufferSize == renderer->readback_framebuffer(bufferSize, pixels.data<unsigned char>());
     readbackScope.end();
 
-    BasicProfilingScope saveScope;
-    saveScope.begin();
-    const bool written = WriteImage::write_png(prefix, fbSize.x, fbSize.y, fbSize.z,
-        readback_buffer_byte.data());
-    saveScope.end();
-
-    return available && written;
+    if (!available) {
+        image_writer.release(std::move(pixels));
+        return false;
+    }
+    image_writer.write_png(prefix, fbSize.x, fbSize.y, fbSize.z, std::move(pixels));
+    return true;
 }
 
-bool BasicApplicationState::save_framebuffer_pfm(const char *prefix,
-    RenderBackend *renderer)
+bool BasicApplicationState::readback_framebuffer_float(RenderBackend *renderer,
+    ImageWriteBuffer &pixels, glm::uvec3 &fbSize)
 {
-    glm::uvec3 fbSize = renderer->get_framebuffer_size();
+    fbSize = renderer->get_framebuffer_size();
     const size_t bufferSize = fbSize.x * static_cast<size_t>(fbSize.y) * fbSize.z;
-    readback_buffer_float.resize(bufferSize);
+    pixels = image_writer.acquire(bufferSize * sizeof(float));
 
     BasicProfilingScope readbackScope;
     readbackScope.begin();
-    const size_t nRead = renderer->readback_framebuffer(bufferSize, readback_buffer_float.data());
+    const size_t nRead = renderer->readback_framebuffer(bufferSize, pixels.data<float>());
     readbackScope.end();
 
     bool available = nRead == bufferSize;
@@ -377,42 +381,52 @@ bool BasicApplicationState::save_framebuffer_pfm(const char *prefix,
         fbSize.y /= uint32_t(renderer->options.render_upscale_factor);
         available = true;
     }
+    if (!available)
+        image_writer.release(std::move(pixels));
+    return available;
+}
 
-    BasicProfilingScope saveScope;
-    saveScope.begin();
-    const bool written = WriteImage::write_pfm(prefix, fbSize.x, fbSize.y, fbSize.z,
-            readback_buffer_float.data());
-    saveScope.end();
-
-    return available && written;
+bool BasicApplicationState::save_framebuffer_pfm(const char *prefix,
+    RenderBackend *renderer)
+{
+    glm::uvec3 fbSize;
+    ImageWriteBuffer pixels;
+    if (!readback_framebuffer_float(renderer, pixels, fbSize))
+        return false;
+    image_writer.write_pfm(prefix, fbSize.x, fbSize.y, fbSize.z, std::move(pixels));
+    return true;
 }
 
 bool BasicApplicationState::save_framebuffer_exr(const char *prefix,
     RenderBackend *renderer, ExrCompression compression)
 {
-    glm::uvec3 fbSize = renderer->get_framebuffer_size();
-    const size_t bufferSize = fbSize.x * static_cast<size_t>(fbSize.y) * fbSize.z;
-    readback_buffer_float.resize(bufferSize);
-
-    BasicProfilingScope readbackScope;
-    readbackScope.begin();
-    const size_t nRead = renderer->readback_framebuffer(bufferSize, readback_buffer_float.data());
-    readbackScope.end();
-
-    bool available = nRead == bufferSize;
-    if (nRead == bufferSize / renderer->options.render_upscale_factor / renderer->options.render_upscale_factor) {
-        fbSize.x /= uint32_t(renderer->options.render_upscale_factor);
-        fbSize.y /= uint32_t(renderer->options.render_upscale_factor);
-        available = true;
-    }
-
-    BasicProfilingScope saveScope;
-    saveScope.begin();
-    const bool written = WriteImage::write_exr(prefix, fbSize.x, fbSize.y, fbSize.z,
-            readback_buffer_float.data(), compression);
-    saveScope.end();
+    glm::uvec3 fbSize;
+    ImageWriteBuffer pixels;
+    if (!readback_framebuffer_float(renderer, pixels, fbSize))
+        return false;
+    image_writer.write_exr(prefix, fbSize.x, fbSize.y, fbSize.z, std::move(pixels), compression);
+    return true;
+}
 
-    return available && written;
+bool BasicApplicationState::save_framebuffer_display(const char *prefix,
+    RenderBackend *renderer)
+{
+    glm::uvec3 fbSize;
+    ImageWriteBuffer hdr;
+    if (!readback_framebuffer_float(renderer, hdr, fbSize))
+        return false;
+
+    // the accumulation buffer holds linear HDR values, apply the display transform on the CPU
+    BasicProfilingScope postprocessScope;
+    postprocessScope.begin();
+    ImageWriteBuffer pixels = image_writer.acquire(fbSize.x * static_cast<size_t>(fbSize.y) * 4);
+    postprocess_to_rgba8(postprocess_params(renderer->params), int(fbSize.x), int(fbSize.y), int(fbSize.z),
+        hdr.data<float>(), pixels.data<unsigned char>());
+    image_writer.release(std::move(hdr));
+    postprocessScope.end();
+
+    image_writer.write_png(prefix, fbSize.x, fbSize.y, 4, std::move(pixels));
+    return true;
 }
 
 bool BasicApplicationState::save_framebuffer(const char *prefix,
@@ -444,21 +458,131 @@ bool BasicApplicationState::save_aov_exr(const char *prefix,
 {
     const glm::uvec3 fbSize = renderer->get_framebuffer_size();
     const size_t bufferSize = fbSize.x * static_cast<size_t>(fbSize.y) * fbSize.z;
-    readback_buffer_half.resize(bufferSize);
-    
+    ImageWriteBuffer pixels = image_writer.acquire(bufferSize * sizeof(uint16_t));
+
     BasicProfilingScope readbackScope;
     readbackScope.begin();
     const bool available = renderer->readback_aov(aovIndex, bufferSize,
-        readback_buffer_half.data());
+        pixels.data<uint16_t>());
     readbackScope.end();
 
-    BasicProfilingScope saveScope;
-    saveScope.begin();
-    const bool written = WriteImage::write_exr(prefix,
-        fbSize.x, fbSize.y, fbSize.z, readback_buffer_half.data(),
-        compression);
-    saveScope.end();
-    return available && written;
+    if (!available) {
+        image_writer.release(std::move(pixels));
+        return false;
+    }
+    image_writer.write_exr_f16_pixels(prefix, fbSize.x, fbSize.y, fbSize.z,
+        std::move(pixels), compression);
+    return true;
+}
+
+bool BasicApplicationState::save_frame_capture(RenderBackend *renderer,
+    uint64_t frame_number)
+{
+    const glm::uvec3 fbSize = renderer->get_framebuffer_size();
+    const size_t bufferSize = fbSize.x * static_cast<size_t>(fbSize.y) * fbSize.z;
+
+    std::vector<FrameCaptureStream> streams;
+    auto add_stream = [&](bool enabled, const char *name, FrameCapturePixelFormat format) {
+        if (!enabled)
+            return;
+        FrameCaptureStream stream = { };
+        strncpy(stream.name, name, sizeof(stream.name) - 1);
+        stream.width = fbSize.x;
+        stream.height = fbSize.y;
+        stream.pixel_format = format;
+        streams.push_back(stream);
+    };
+    // same order as written below
+    add_stream(data_capture.rgba, "rgba", FRAME_CAPTURE_RGBA32F);
+    add_stream(data_capture.display, "display", FRAME_CAPTURE_RGBA8);
+    add_stream(data_capture.albedo_roughness, "albedo_roughness", FRAME_CAPTURE_RGBA16F);
+    add_stream(data_capture.normal_depth, "normal_depth", FRAME_CAPTURE_RGBA16F);
+    add_stream(data_capture.motion, "motion_jitter", FRAME_CAPTURE_RGBA16F);
+    if (streams.empty())
+        return false;
+
+    // frame slots are sized for the extents at the start of a segment, resizing
+    // the framebuffer beyond them or changing the streams starts a new segment
+    bool streams_fit = frame_capture.is_open()
+        && frame_capture.header()->num_streams == streams.size();
+    for (size_t i = 0; streams_fit && i < streams.size(); ++i) {
+        FrameCaptureStream const& open_stream = frame_capture.header()->streams[i];
+        streams_fit = strcmp(open_stream.name, streams[i].name) == 0
+            && open_stream.pixel_format == streams[i].pixel_format
+            && open_stream.width >= fbSize.x && open_stream.height >= fbSize.y;
+    }
+
+    if (!streams_fit || frame_capture.full()) {
+        // by default, every keyframe runs for one logical second
+        uint64_t capacity = data_capture.raw_frames > 0 ? uint64_t(data_capture.raw_frames)
+            : uint64_t(std::ceil(std::max(ImState::NumKeyframes(), 1) * data_capture.fps)) + 1;
+        std::ostringstream os;
+        os << data_capture.img_prefix << "_"
+           << std::setw(3) << std::setfill('0')
+           << frame_capture_segment++ << ".rptrcap";
+        if (!frame_capture.open(os.str(), streams, capacity))
+            return false;
+        println(CLL::INFORMATION, "Capturing %llu frames to %s",
+            (unsigned long long) capacity, os.str().c_str());
+    }
+
+    // readbacks go straight into the mapped frame slot
+    BasicProfilingScope readbackScope;
+    readbackScope.begin();
+    int stream = 0;
+    float *hdr = nullptr;
+    glm::uvec2 hdrSize(0);
+    if (data_capture.rgba || data_capture.display) {
+        ImageWriteBuffer scratch;
+        if (data_capture.rgba)
+            hdr = reinterpret_cast<float*>(frame_capture.stream_data(stream));
+        else {
+            scratch = image_writer.acquire(bufferSize * sizeof(float));
+            hdr = scratch.data<float>();
+        }
+        const size_t nRead = renderer->readback_framebuffer(bufferSize, hdr);
+        if (nRead == bufferSize)
+            hdrSize = glm::uvec2(fbSize);
+        else if (nRead == bufferSize / renderer->options.render_upscale_factor / renderer->options.render_upscale_factor)
+            hdrSize = glm::uvec2(fbSize) / uint32_t(renderer->options.render_upscale_factor);
+        if (data_capture.rgba) {
+            if (hdrSize.x)
+                frame_capture.set_stream_extent(stream, hdrSize.x, hdrSize.y);
+            ++stream;
+        }
+        if (data_capture.display) {
+            if (hdrSize.x) {
+                postprocess_to_rgba8(postprocess_params(renderer->params), int(hdrSize.x), int(hdrSize.y), int(fbSize.z),
+                    hdr, frame_capture.stream_data(stream));
+                frame_capture.set_stream_extent(stream, hdrSize.x, hdrSize.y);
+            }
+            ++stream;
+        }
+        if (!data_capture.rgba)
+            image_writer.release(std::move(scratch));
+    }
+    const RenderGraphic::AOVBufferIndex aovs[] = {
+        RenderGraphic::AOVAlbedoRoughnessIndex,
+        RenderGraphic::AOVNormalDepthIndex,
+        RenderGraphic::AOVMotionJitterIndex
+    };
+    const bool aovEnabled[] = {
+        data_capture.albedo_roughness,
+        data_capture.normal_depth,
+        data_capture.motion
+    };
+    for (int i = 0; i < 3; ++i) {
+        if (!aovEnabled[i])
+            continue;
+        if (renderer->readback_aov(aovs[i], bufferSize,
+                reinterpret_cast<uint16_t*>(frame_capture.stream_data(stream))))
+            frame_capture.set_stream_extent(stream, fbSize.x, fbSize.y);
+        ++stream;
+    }
+    readbackScope.end();
+
+    frame_capture.commit_frame(frame_number, current_time);
+    return true;
 }
 
 void BasicApplicationState::handle_mode_actions(const Shell &shell,
@@ -506,20 +630,28 @@ void BasicApplicationState::handle_mode_actions(const Shell &shell,
                << ImState::CurrentKeyframe()+1;
             const std::string pf = os.str();
 
-            if (data_capture.rgba) {
-                save_framebuffer((pf + "_rgba").c_str(), renderer, EXR_COMPRESSION_NONE);
-            }
-            if (data_capture.albedo_roughness) {
-                save_aov_exr((pf + "_albedo_roughness").c_str(), renderer,
-                    RenderGraphic::AOVAlbedoRoughnessIndex, EXR_COMPRESSION_NONE);
-            }
-            if (data_capture.normal_depth) {
-                save_aov_exr((pf + "_normal_depth").c_str(), renderer,
-                    RenderGraphic::AOVNormalDepthIndex, EXR_COMPRESSION_NONE);
+            if (data_capture.raw) {
+                save_frame_capture(renderer, uint64_t(ImState::CurrentKeyframe()+1));
             }
-            if (data_capture.motion) {
-                save_aov_exr((pf + "_motion_jitter").c_str(), renderer,
-                    RenderGraphic::AOVMotionJitterIndex, EXR_COMPRESSION_NONE);
+            else {
+                if (data_capture.rgba) {
+                    save_framebuffer((pf + "_rgba").c_str(), renderer, EXR_COMPRESSION_NONE);
+                }
+                if (data_capture.display) {
+                    save_framebuffer_display((pf + "_display").c_str(), renderer);
+                }
+                if (data_capture.albedo_roughness) {
+                    save_aov_exr((pf + "_albedo_roughness").c_str(), renderer,
+                        RenderGraphic::AOVAlbedoRoughnessIndex, EXR_COMPRESSION_NONE);
+                }
+                if (data_capture.normal_depth) {
+                    save_aov_exr((pf + "_normal_depth").c_str(), renderer,
+                        RenderGraphic::AOVNormalDepthIndex, EXR_COMPRESSION_NONE);
+                }
+                if (data_capture.motion) {
+                    save_aov_exr((pf + "_motion_jitter").c_str(), renderer,
+                        RenderGraphic::AOVMotionJitterIndex, EXR_COMPRESSION_NONE);
+                }
             }
 
             if (ImState::LastKeyframeComingUp(current_time + data_capture_delta_time))
@@ -532,6 +664,12 @@ void BasicApplicationState::handle_mode_actions(const Shell &shell,
     {
         track_file_change(shell);
     }
+
+    // all images of a finished run are on disk before the application shuts down
+    if (done && !image_writer.flush())
+        println(CLL::CRITICAL, "Failed to write some of the saved images");
+    if (done)
+        frame_capture.close();
 }
 
 void BasicApplicationState::track_file_change(const Shell &shell)
@@ -10,6 +10,8 @@
 #include "shell.h"
 #include "util.h"
 #include "benchmark_info.h"
+#include "async_image_writer.h"
+#include "frame_capture.h"
 #include <memory>
 #include <vector>
 
@@ -105,15 +107,24 @@ struct BasicApplicationState {
         void track_file_change(const Shell &shell);
         bool save_framebuffer(const char *prefix, RenderBackend *renderer,
             ExrCompression compression);
+        bool readback_framebuffer_float(RenderBackend *renderer,
+                ImageWriteBuffer &pixels, glm::uvec3 &fbSize);
         bool save_framebuffer_png(const char *prefix, RenderBackend *renderer);
         bool save_framebuffer_pfm(const char *prefix, RenderBackend *renderer);
         bool save_framebuffer_exr(const char *prefix, RenderBackend *renderer,
                 ExrCompression compression);
+        bool save_framebuffer_display(const char *prefix, RenderBackend *renderer);
         bool save_aov_exr(const char *prefix, RenderBackend *renderer,
                 RenderGraphic::AOVBufferIndex aovIndex,
                 ExrCompression compression);
+        bool save_frame_capture(RenderBackend *renderer, uint64_t frame_number);
 
-        std::vector<float>         readback_buffer_float;
-        std::vector<uint16_t>      readback_buffer_half;
-        std::vector<unsigned char> readback_buffer_byte;
+        // readbacks are encoded and written in the background, the
+        // destructor waits for the remaining images
+        AsyncImageWriter image_writer;
+
+        // raw capture file of data capture mode, continued in the next
+        // segment file when full
+        FrameCaptureWriter frame_capture;
+        int frame_capture_segment = 0;
 };
@@ -10,6 +10,7 @@
 
 #include <memory>
 #include "librender/raytrace_backend.h"
+#include "librender/cpu_raytrace_backend.h"
 #include "librender/render_backend.h"
 
 #include "libdatacapture/pois.h"
@@ -24,8 +25,10 @@ struct DataCaptureTools {
     
     DataCaptureTools(RenderBackend* renderer) {
        raytracer = dynamic_cast<RaytraceBackend*>(renderer);
+       // no ray tracing capable device, trace on the CPU
        if (!raytracer) {
-            assert(false);
+            aux_raytracer = std::make_unique<CpuRaytraceBackend>();
+            raytracer = aux_raytracer.get();
        }
     }
 
@@ -55,6 +55,8 @@ void imstate_scene_loader_parameters(SceneLoaderParams& params, const std::vecto
     if (ImState::Open("SceneLoader")) {
         IMGUI_STATE1(ImGui::Checkbox, "use deduplication", &params.use_deduplication);
         IMGUI_STATE1(ImGui::Checkbox, "remove LODs", &params.remove_lods);
+        IMGUI_STATE1(ImGui::Checkbox, "generate LODs", &params.generate_lods);
+        IMGUI_STATE1(ImGui::Checkbox, "optimize meshes", &params.optimize_meshes);
     }
     int scene_count = ilen(fnames);
     for (int scene_idx = 0; scene_idx < scene_count; ++scene_idx) {
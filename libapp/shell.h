@@ -35,6 +35,10 @@ struct DataCaptureConfig {
     bool albedo_roughness { true };
     bool normal_depth { true };
     bool motion { true };
+    bool display { false };
+    // store all streams in preallocated raw capture files instead of images
+    bool raw { false };
+    int raw_frames { 0 }; // frames per capture file, 0 estimates from the keyframes
 };
 
 struct Shell {
@@ -84,6 +88,8 @@ struct Shell {
         std::string profiling_csv_prefix;
         std::string profiling_img_prefix;
         float profiling_fps = 60.f;
+        // Timeline of the profiling scopes, independent of profiling mode.
+        std::string profiling_trace_file;
 
         // Data capture mode is designed for generating training data for
         // denoisers.
@@ -0,0 +1,182 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// CPU ray tracing benchmark: builds the two-level CPU BVH for a scene and
+// measures the throughput of batched primary rays from the scene camera and
+// of occlusion rays from the primary hits towards a fixed light direction.
+// Compares the float BVH layout against the compressed quantized layout.
+
+#include "scene.h"
+#include "cpu_raytracer.h"
+#include "profiling.h"
+#include "parallel.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+void print_usage(char const* exe) {
+    printf("Usage: %s <scene.vks> [options]\n"
+           "  --resolution <w> <h>  primary ray grid (default 1024 1024)\n"
+           "  --repeat <n>          number of timed batches (default 5)\n"
+           "  --layout <l>          float, compressed or both (default both)\n"
+           "  --threads <n>         number of worker threads (default all)\n", exe);
+}
+
+std::vector<RenderRayQuery> primary_rays(Scene const& scene, AABB const& bounds, int width, int height) {
+    CameraDesc camera;
+    if (!scene.cameras.empty())
+        camera = scene.cameras[0];
+    else {
+        // look at the scene from the corner of its bounds
+        camera.center = bounds.center();
+        camera.position = bounds.center() + bounds.extent() * 0.75f;
+        camera.up = glm::vec3(0.0f, 1.0f, 0.0f);
+        camera.fov_y = 60.0f;
+    }
+    glm::vec3 dir_z = glm::normalize(camera.center - camera.position);
+    glm::vec3 dir_x = glm::normalize(glm::cross(dir_z, camera.up));
+    glm::vec3 dir_y = glm::cross(dir_x, dir_z);
+    float tan_y = std::tan(glm::radians(camera.fov_y) * 0.5f);
+    float tan_x = tan_y * float(width) / float(height);
+
+    std::vector<RenderRayQuery> queries(size_t(width) * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            float sx = (2.0f * (float(x) + 0.5f) / float(width) - 1.0f) * tan_x;
+            float sy = (1.0f - 2.0f * (float(y) + 0.5f) / float(height)) * tan_y;
+            RenderRayQuery& query = queries[size_t(y) * width + x];
+            query.origin = camera.position;
+            query.mode_or_data = 0;
+            query.dir = glm::normalize(dir_z + sx * dir_x + sy * dir_y);
+            query.t_max = 1.e20f;
+        }
+    }
+    return queries;
+}
+
+struct LayoutResult {
+    char const* name;
+    CpuRaytracerStats build_stats;
+    double primary_ms = 0.0;
+    double shadow_ms = 0.0;
+    int primary_hits = 0;
+    int shadow_rays = 0;
+    int shadowed = 0;
+};
+
+LayoutResult run_layout(Scene const& scene, CpuBVHLayout layout, int width, int height, int repeat) {
+    LayoutResult result;
+    result.name = layout == CpuBVHLayout::Compressed ? "compressed" : "float";
+    CpuRaytracer raytracer(layout);
+    raytracer.set_scene(scene);
+    result.build_stats = raytracer.stats();
+
+    std::vector<RenderRayQuery> queries = primary_rays(scene, raytracer.bounds(), width, height);
+    int const num_queries = ilen(queries);
+    std::vector<CpuRayHit> hits(queries.size());
+    result.primary_ms = 1.e30;
+    for (int i = 0; i < repeat; ++i) {
+        BasicProfilingScope t;
+        raytracer.trace_rays(queries.data(), num_queries, hits.data());
+        t.end();
+        result.primary_ms = std::min(result.primary_ms, t.elapsedMS());
+    }
+
+    // occlusion rays from the primary hits, offset along the light direction
+    glm::vec3 light_dir = glm::normalize(glm::vec3(0.3f, 1.0f, 0.2f));
+    float offset = 1.e-4f * glm::length(raytracer.bounds().extent());
+    std::vector<RenderRayQuery> shadow_queries;
+    for (int i = 0; i < num_queries; ++i) {
+        if (!hits[i].hit())
+            continue;
+        RenderRayQuery query = queries[i];
+        query.origin = query.origin + hits[i].t * query.dir + offset * light_dir;
+        query.dir = light_dir;
+        query.t_max = 1.e20f;
+        shadow_queries.push_back(query);
+    }
+    result.primary_hits = ilen(shadow_queries);
+    result.shadow_rays = ilen(shadow_queries);
+    std::vector<uint8_t> occluded(shadow_queries.size());
+    result.shadow_ms = 1.e30;
+    for (int i = 0; i < repeat && !shadow_queries.empty(); ++i) {
+        BasicProfilingScope t;
+        raytracer.trace_occlusion(shadow_queries.data(), ilen(shadow_queries), occluded.data());
+        t.end();
+        result.shadow_ms = std::min(result.shadow_ms, t.elapsedMS());
+    }
+    for (uint8_t o : occluded)
+        result.shadowed += o;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    std::string scene_file;
+    int width = 1024, height = 1024;
+    int repeat = 5;
+    std::vector<CpuBVHLayout> layouts = {CpuBVHLayout::Float, CpuBVHLayout::Compressed};
+
+    for (int i = 1; i < argc; ++i) {
+        bool has_arg = i + 1 < argc;
+        if (!strcmp(argv[i], "--resolution") && i + 2 < argc) {
+            sscanf(argv[++i], "%i", &width);
+            sscanf(argv[++i], "%i", &height);
+        } else if (!strcmp(argv[i], "--repeat") && has_arg)
+            sscanf(argv[++i], "%i", &repeat);
+        else if (!strcmp(argv[i], "--layout") && has_arg) {
+            ++i;
+            if (!strcmp(argv[i], "float"))
+                layouts = {CpuBVHLayout::Float};
+            else if (!strcmp(argv[i], "compressed"))
+                layouts = {CpuBVHLayout::Compressed};
+            else if (strcmp(argv[i], "both")) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "--threads") && has_arg)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else if (argv[i][0] != '-' && scene_file.empty())
+            scene_file = argv[i];
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (scene_file.empty() || width < 1 || height < 1 || repeat < 1) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    Scene scene({scene_file});
+    size_t vertex_bytes = 0;
+    for (auto const& mesh : scene.meshes) {
+        for (auto const& geom : mesh.geometries)
+            vertex_bytes += geom.vertices.nbytes() + geom.indices.nbytes();
+    }
+    printf("%d meshes, %d instances, %.1f MB scene positions and indices, %d threads\n"
+        , ilen(scene.meshes), ilen(scene.instances), double(vertex_bytes) / (1024.0 * 1024.0), parallel_thread_count());
+
+    int const num_queries = width * height;
+    for (CpuBVHLayout layout : layouts) {
+        LayoutResult r = run_layout(scene, layout, width, height, repeat);
+        printf("%-10s: %llu triangles, build %.2f ms, %.1f MB (%.1f B/triangle)\n"
+            , r.name, (unsigned long long) r.build_stats.triangles, r.build_stats.build_ms
+            , double(r.build_stats.memory_bytes) / (1024.0 * 1024.0)
+            , r.build_stats.triangles ? double(r.build_stats.memory_bytes) / double(r.build_stats.triangles) : 0.0);
+        printf("%-10s  primary: %d rays, %.1f%% hit, %.2f ms, %.2f Mrays/s\n"
+            , "", num_queries, 100.0 * double(r.primary_hits) / double(num_queries), r.primary_ms
+            , double(num_queries) / (r.primary_ms * 1.e3));
+        if (r.shadow_rays)
+            printf("%-10s  occlusion: %d rays, %.1f%% occluded, %.2f ms, %.2f Mrays/s\n"
+                , "", r.shadow_rays, 100.0 * double(r.shadowed) / double(r.shadow_rays), r.shadow_ms
+                , double(r.shadow_rays) / (r.shadow_ms * 1.e3));
+    }
+    return 0;
+}
@@ -0,0 +1,173 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Synthetic animated-light benchmark: compares per-frame refitting of the
+// binned light sampling data against a full rebuild, for a configurable
+// number of emissive instances of which a fraction is animated.
+
+#include "lights.h"
+#include "profiling.h"
+#include "parallel.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+
+void print_usage(char const* exe) {
+    printf("Usage: %s [options]\n"
+           "  --instances <n>        emissive instances (default 10000)\n"
+           "  --emitters <n>         emissive triangles per instance (default 8)\n"
+           "  --animated <fraction>  fraction of animated instances (default 0.1)\n"
+           "  --toggled <fraction>   fraction of instances toggled per frame (default 0.0)\n"
+           "  --frames <n>           number of simulated frames (default 100)\n"
+           "  --bin-size <n>         light sampling bin size (default %d)\n"
+           "  --threads <n>          number of worker threads (default all)\n", exe, BINNED_LIGHTS_BIN_MAX_SIZE);
+}
+
+// builds a synthetic scene of small emissive triangle fans scattered over a city-sized area
+void build_synthetic_emitters(DynamicEmitters& dynamic, int instance_count, int emitters_per_instance, float animated_fraction) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    float const two_pi = 6.28318530718f;
+
+    dynamic.ranges.clear();
+    dynamic.local_emitters.clear();
+    for (int instance = 0; instance < instance_count; ++instance) {
+        DynamicEmitters::InstanceRange range;
+        range.instance_id = uint32_t(instance);
+        range.first_emitter = uint32_t(dynamic.local_emitters.size());
+        range.emitter_count = uint32_t(emitters_per_instance);
+        range.frame = 0;
+        range.animated = u01(rng) < animated_fraction;
+        dynamic.ranges.push_back(range);
+
+        glm::vec3 radiance = glm::vec3(u01(rng), u01(rng), u01(rng)) * (1.0f + 100.0f * u01(rng) * u01(rng));
+        for (int e = 0; e < emitters_per_instance; ++e) {
+            float a0 = two_pi * float(e) / float(emitters_per_instance);
+            float a1 = two_pi * float(e + 1) / float(emitters_per_instance);
+            TriLight light;
+            light.v0 = glm::vec3(0.0f);
+            light.v1 = glm::vec3(std::cos(a1), 0.0f, std::sin(a1)) * 0.5f;
+            light.v2 = glm::vec3(std::cos(a0), 0.0f, std::sin(a0)) * 0.5f;
+            light.radiance = radiance;
+            dynamic.local_emitters.push_back(light);
+        }
+    }
+    dynamic.emitters.resize(dynamic.local_emitters.size());
+}
+
+glm::mat4 synthetic_transform(int instance, float time) {
+    std::mt19937 rng(instance);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    glm::vec3 base = glm::vec3(u01(rng) * 2000.0f - 1000.0f, u01(rng) * 50.0f, u01(rng) * 2000.0f - 1000.0f);
+    float speed = 0.5f + u01(rng);
+    glm::vec3 offset = glm::vec3(std::cos(speed * time), 0.0f, std::sin(speed * time)) * 10.0f;
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), base + offset);
+    return glm::rotate(transform, speed * time, glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    int instance_count = 10000;
+    int emitters_per_instance = 8;
+    float animated_fraction = 0.1f;
+    float toggled_fraction = 0.0f;
+    int frame_count = 100;
+    LightSamplingConfig config;
+    config.bin_size = BINNED_LIGHTS_BIN_MAX_SIZE;
+
+    for (int i = 1; i < argc; ++i) {
+        bool has_arg = i + 1 < argc;
+        if (!strcmp(argv[i], "--instances") && has_arg)
+            sscanf(argv[++i], "%i", &instance_count);
+        else if (!strcmp(argv[i], "--emitters") && has_arg)
+            sscanf(argv[++i], "%i", &emitters_per_instance);
+        else if (!strcmp(argv[i], "--animated") && has_arg)
+            sscanf(argv[++i], "%f", &animated_fraction);
+        else if (!strcmp(argv[i], "--toggled") && has_arg)
+            sscanf(argv[++i], "%f", &toggled_fraction);
+        else if (!strcmp(argv[i], "--frames") && has_arg)
+            sscanf(argv[++i], "%i", &frame_count);
+        else if (!strcmp(argv[i], "--bin-size") && has_arg)
+            sscanf(argv[++i], "%i", &config.bin_size);
+        else if (!strcmp(argv[i], "--threads") && has_arg)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (config.bin_size < 1 || config.bin_size > BINNED_LIGHTS_BIN_MAX_SIZE || instance_count < 1 || emitters_per_instance < 1) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    DynamicEmitters dynamic;
+    build_synthetic_emitters(dynamic, instance_count, emitters_per_instance, animated_fraction);
+    for (int r = 0; r < instance_count; ++r)
+        dynamic.set_transform(r, synthetic_transform(r, 0.0f));
+    dynamic.changed_emitters.clear();
+
+    BinnedLightSampling binned;
+    BasicProfilingScope build_timer;
+    update_light_sampling(binned, dynamic.emitters, config);
+    build_timer.end();
+    printf("%d emitters (%d binned), initial build %.2f ms, %d threads\n"
+        , ilen(dynamic.emitters), ilen(binned.emitters), build_timer.elapsedMS(), parallel_thread_count());
+
+    std::mt19937 toggle_rng(7);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    double transform_ms = 0.0, refit_ms = 0.0, rebuild_ms = 0.0;
+    int const rebuild_frames = std::min(frame_count, 5); // full rebuilds are slow, only sample a few
+    size_t uploaded_bytes = 0, copy_regions = 0;
+    std::vector<glm::uvec2> dirty_ranges;
+    for (int frame = 1; frame <= frame_count; ++frame) {
+        float time = float(frame) / 60.0f;
+
+        BasicProfilingScope transform_timer;
+        for (int r = 0; r < instance_count; ++r) {
+            if (dynamic.ranges[r].animated)
+                dynamic.set_transform(r, synthetic_transform(r, time));
+            if (toggled_fraction > 0.0f && u01(toggle_rng) < toggled_fraction)
+                dynamic.set_enabled(r, !dynamic.ranges[r].enabled);
+        }
+        transform_timer.end();
+        transform_ms += transform_timer.elapsedMS();
+
+        BasicProfilingScope refit_timer;
+        refit_light_sampling(binned, dynamic.emitters, dynamic.changed_emitters, dirty_ranges);
+        refit_timer.end();
+        refit_ms += refit_timer.elapsedMS();
+        dynamic.changed_emitters.clear();
+
+        for (auto range : dirty_ranges)
+            uploaded_bytes += (range.y - range.x) * sizeof(TriLightData);
+        copy_regions += dirty_ranges.size();
+
+        if (frame <= rebuild_frames) {
+            BinnedLightSampling rebuilt;
+            BasicProfilingScope rebuild_timer;
+            update_light_sampling(rebuilt, dynamic.emitters, config);
+            rebuild_timer.end();
+            rebuild_ms += rebuild_timer.elapsedMS();
+        }
+    }
+
+    double inv_frames = 1.0 / double(std::max(frame_count, 1));
+    rebuild_ms *= double(frame_count) / double(std::max(rebuild_frames, 1));
+    size_t full_upload_bytes = binned.emitters.size() * sizeof(TriLightData);
+    printf("per frame: transform %.3f ms, refit %.3f ms, full rebuild %.3f ms (%.1fx)\n"
+        , transform_ms * inv_frames, refit_ms * inv_frames, rebuild_ms * inv_frames
+        , refit_ms > 0.0 ? rebuild_ms / refit_ms : 0.0);
+    printf("per frame: upload %.2f KB in %.1f copy regions, full upload %.2f KB\n"
+        , double(uploaded_bytes) * inv_frames / 1024.0, double(copy_regions) * inv_frames
+        , double(full_upload_bytes) / 1024.0);
+    return 0;
+}
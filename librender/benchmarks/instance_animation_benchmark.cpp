@@ -0,0 +1,186 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Synthetic animated-instance benchmark: measures the per-frame cost of
+// playing back quantized instance animation, i.e. evaluating the transforms
+// of all animated instances, collecting the ones that moved and packing
+// their transforms for upload, compared to re-evaluating every instance.
+
+#include "scene.h"
+#include "instance_animation.h"
+#include "profiling.h"
+#include "parallel.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr size_t QUANTIZED_TRANSFORM_SIZE = 24; // VKR_QUANTIZED_TRANSFORM_SIZE
+
+void print_usage(char const* exe) {
+    printf("Usage: %s [options]\n"
+           "  --instances <n>       animated instances (default 100000)\n"
+           "  --static <n>          additional static instances (default 0)\n"
+           "  --holding <fraction>  fraction of animated instances that hold still (default 0.0)\n"
+           "  --keyframes <n>       animation frames stored per instance (default 60)\n"
+           "  --frames <n>          number of simulated render frames (default 240)\n"
+           "  --stepped             step between animation frames instead of interpolating\n"
+           "  --threads <n>         number of worker threads (default all)\n", exe);
+}
+
+// stores a transform in the VKR quantized layout: float translation[3], float scale, uint16 quaternion[4]
+void quantize_transform(unsigned char* quantized, glm::vec3 translation, float scale, glm::vec4 rotation) {
+    uint16_t q[4];
+    for (int i = 0; i < 4; ++i)
+        q[i] = uint16_t(std::min(std::max((rotation[i] + 1.0f) * 0.5f * float(0xffff) + 0.5f, 0.0f), float(0xffff)));
+    std::memcpy(quantized, &translation, sizeof(float) * 3);
+    std::memcpy(quantized + sizeof(float) * 3, &scale, sizeof(float));
+    std::memcpy(quantized + sizeof(float) * 4, q, sizeof(q));
+}
+
+// builds a scene of instances spinning and orbiting around random points of a city-sized area
+Scene build_synthetic_scene(int animated_count, int static_count, float holding_fraction, int keyframes) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    float const two_pi = 6.28318530718f;
+
+    AnimationData anim;
+    anim.numStaticTransforms = uint64_t(static_count);
+    anim.numAnimatedTransforms = uint64_t(animated_count);
+    anim.numFrames = uint64_t(keyframes);
+    anim.animationStart = 0.0f;
+    anim.animationStep = 1.0f / 30.0f;
+    std::vector<unsigned char> quantized(anim.size_in_bytes());
+
+    for (int i = 0; i < static_count; ++i) {
+        glm::vec3 position(u01(rng) * 2000.0f - 1000.0f, 0.0f, u01(rng) * 2000.0f - 1000.0f);
+        quantize_transform(quantized.data() + i * QUANTIZED_TRANSFORM_SIZE, position, 1.0f, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    }
+    for (int i = 0; i < animated_count; ++i) {
+        glm::vec3 base(u01(rng) * 2000.0f - 1000.0f, u01(rng) * 50.0f, u01(rng) * 2000.0f - 1000.0f);
+        float speed = u01(rng) < holding_fraction ? 0.0f : 0.5f + u01(rng);
+        float scale = 0.5f + u01(rng);
+        for (int f = 0; f < keyframes; ++f) {
+            float angle = speed * two_pi * float(f) / float(keyframes);
+            glm::vec3 offset = glm::vec3(std::cos(angle), 0.0f, std::sin(angle)) * 10.0f;
+            glm::vec4 rotation(0.0f, std::sin(angle * 0.5f), 0.0f, std::cos(angle * 0.5f));
+            // animated transforms are stored frame by frame after the static ones
+            uint64_t offset_idx = anim.numStaticTransforms + uint64_t(f) * anim.numAnimatedTransforms + uint64_t(i);
+            quantize_transform(quantized.data() + offset_idx * QUANTIZED_TRANSFORM_SIZE, base + offset, scale, rotation);
+        }
+    }
+    anim.quantized = mapped_vector<unsigned char>(std::move(quantized));
+
+    Scene scene;
+    scene.animation_data.push_back(anim);
+    scene.instances.resize(size_t(static_count) + animated_count);
+    for (int i = 0, ie = ilen(scene.instances); i < ie; ++i)
+        scene.instances[i].transform_index = uint32_t(i);
+    return scene;
+}
+
+// row-major 3x4 transforms as consumed by acceleration structure instance records
+size_t pack_transforms(std::vector<float>& packed, std::vector<glm::mat4> const& transforms, std::vector<uint32_t> const& ids) {
+    packed.resize(ids.size() * 12);
+    for (size_t k = 0; k < ids.size(); ++k) {
+        glm::mat4 const& m = transforms[ids[k]];
+        for (int r = 0; r < 3; ++r)
+            for (int c = 0; c < 4; ++c)
+                packed[k * 12 + r * 4 + c] = m[c][r];
+    }
+    return packed.size() * sizeof(float);
+}
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    int animated_count = 100000;
+    int static_count = 0;
+    float holding_fraction = 0.0f;
+    int keyframes = 60;
+    int frame_count = 240;
+    bool interpolate = true;
+
+    for (int i = 1; i < argc; ++i) {
+        bool has_arg = i + 1 < argc;
+        if (!strcmp(argv[i], "--instances") && has_arg)
+            sscanf(argv[++i], "%i", &animated_count);
+        else if (!strcmp(argv[i], "--static") && has_arg)
+            sscanf(argv[++i], "%i", &static_count);
+        else if (!strcmp(argv[i], "--holding") && has_arg)
+            sscanf(argv[++i], "%f", &holding_fraction);
+        else if (!strcmp(argv[i], "--keyframes") && has_arg)
+            sscanf(argv[++i], "%i", &keyframes);
+        else if (!strcmp(argv[i], "--frames") && has_arg)
+            sscanf(argv[++i], "%i", &frame_count);
+        else if (!strcmp(argv[i], "--stepped"))
+            interpolate = false;
+        else if (!strcmp(argv[i], "--threads") && has_arg)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (animated_count < 1 || static_count < 0 || keyframes < 2 || frame_count < 1) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    Scene scene = build_synthetic_scene(animated_count, static_count, holding_fraction, keyframes);
+    InstanceAnimation animation;
+    animation.interpolate = interpolate;
+    BasicProfilingScope init_timer;
+    animation.initialize(scene, 0.0);
+    init_timer.end();
+    printf("%d animated + %d static instances, %d keyframes, %s, initialize %.2f ms, %d threads\n"
+        , animated_count, static_count, keyframes, interpolate ? "interpolated" : "stepped"
+        , init_timer.elapsedMS(), parallel_thread_count());
+
+    // render frames at 60 Hz, animation keyframes are at 30 Hz
+    std::vector<float> packed;
+    double update_ms = 0.0, pack_ms = 0.0, full_ms = 0.0;
+    size_t moved_total = 0, uploaded_bytes = 0;
+    int updated_frames = 0;
+    std::vector<glm::mat4> full_transforms(scene.instances.size());
+    std::vector<uint32_t> all_ids(scene.instances.size());
+    for (int i = 0, ie = ilen(all_ids); i < ie; ++i)
+        all_ids[i] = uint32_t(i);
+    for (int frame = 1; frame <= frame_count; ++frame) {
+        double time = double(frame) / 60.0;
+
+        BasicProfilingScope update_timer;
+        bool moved = animation.update(time);
+        update_timer.end();
+        update_ms += update_timer.elapsedMS();
+
+        BasicProfilingScope pack_timer;
+        if (moved)
+            uploaded_bytes += pack_transforms(packed, animation.transforms, animation.moved_instances);
+        pack_timer.end();
+        pack_ms += pack_timer.elapsedMS();
+        moved_total += animation.moved_instances.size();
+        updated_frames += moved;
+
+        // baseline: re-evaluate and re-upload every instance each frame
+        BasicProfilingScope full_timer;
+        auto const& anim = scene.animation_data[0];
+        parallel_for(0, index_t(scene.instances.size()), 1024, [&](index_t i, int) {
+            full_transforms[i] = anim.transform_at(scene.instances[i].transform_index, time, interpolate);
+        });
+        pack_transforms(packed, full_transforms, all_ids);
+        full_timer.end();
+        full_ms += full_timer.elapsedMS();
+    }
+
+    printf("incremental: %.3f ms/frame update, %.3f ms/frame packing, %.0f moved instances/frame, %d/%d frames with updates\n"
+        , update_ms / frame_count, pack_ms / frame_count, double(moved_total) / frame_count, updated_frames, frame_count);
+    printf("incremental: %.2f MB/frame transform uploads\n", double(uploaded_bytes) / frame_count / (1024.0 * 1024.0));
+    printf("full:        %.3f ms/frame update and packing, %.2f MB/frame transform uploads\n"
+        , full_ms / frame_count, double(scene.instances.size() * 12 * sizeof(float)) / (1024.0 * 1024.0));
+    return 0;
+}
@@ -0,0 +1,286 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Offline light sampling quality benchmark: builds the binned light sampling
+// structures for a list of configurations and measures build time, memory and
+// the variance of next-event estimation at a fixed set of receiver points,
+// using the same GLSL selection code that runs on the GPU.
+
+#include "scene.h"
+#include "lights.h"
+#include "profiling.h"
+#include "parallel.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace glsl {
+
+using namespace glm;
+// shadow the generic min/max of types.h, which are ambiguous with glm's
+using glm::min;
+using glm::max;
+#include "../rendering/language.hpp"
+
+#include "../rendering/pointsets/lcg_rng.glsl"
+#include "../rendering/util.glsl"
+
+// configuration currently under test
+TriLight const* bench_emitters = nullptr;
+int bench_emitter_count = 0;
+int bench_bin_size = 1;
+
+#define SCENE_GET_LIGHT_SOURCE(light_id) bench_emitters[light_id]
+#define SCENE_GET_LIGHT_SOURCE_COUNT() bench_emitter_count
+#define BINNED_LIGHTS_BIN_SIZE bench_bin_size
+#define SCENE_GET_BINNED_LIGHTS_BIN_COUNT() ((bench_emitter_count + (bench_bin_size - 1)) / bench_bin_size)
+
+#include "../rendering/mc/lights_linear.glsl"
+
+} // namespace
+
+namespace {
+
+struct Receiver {
+    glm::vec3 p;
+    glm::vec3 n;
+};
+
+struct BenchmarkResult {
+    LightSamplingConfig config;
+    double build_ms = 0.0;
+    size_t memory_bytes = 0;
+    int light_count = 0;
+    int bin_count = 0;
+    double mean_irradiance = 0.0;
+    double mean_variance = 0.0;
+    double mean_relative_variance = 0.0;
+    double ns_per_sample = 0.0;
+};
+
+void print_usage(char const* exe) {
+    printf("Usage: %s <scene.vks> [options]\n"
+           "  --receivers <file>   receiver points, one 'x y z [nx ny nz]' per line\n"
+           "  --num-receivers <n>  number of random receivers in the scene bounds (default 1024)\n"
+           "  --spp <n>            light samples per receiver (default 256)\n"
+           "  --config <bin_size>,<min_radiance>,<min_receiver_dist>\n"
+           "                       light sampling configuration, may be repeated\n"
+           "  --threads <n>        number of worker threads (default all)\n"
+           "  --json <file>        write results as JSON\n", exe);
+}
+
+std::vector<Receiver> load_receivers(char const* filename) {
+    std::vector<Receiver> receivers;
+    FILE* file = fopen(filename, "r");
+    if (!file) {
+        fprintf(stderr, "Failed to open receiver file %s\n", filename);
+        return receivers;
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), file)) {
+        Receiver r;
+        int count = sscanf(line, "%f %f %f %f %f %f", &r.p.x, &r.p.y, &r.p.z, &r.n.x, &r.n.y, &r.n.z);
+        if (count < 3)
+            continue;
+        if (count < 6 || !(dot(r.n, r.n) > 0.0f))
+            r.n = glm::vec3(0.0f, 1.0f, 0.0f);
+        r.n = normalize(r.n);
+        receivers.push_back(r);
+    }
+    fclose(file);
+    return receivers;
+}
+
+std::vector<Receiver> random_receivers(AABB const& bounds, int count) {
+    std::vector<Receiver> receivers(count);
+    // fixed seed for reproducible runs
+    glsl::LCGRand rng = glsl::get_lcg_rng(0, 0, 0x5eedu);
+    for (auto& r : receivers) {
+        glm::vec3 u = glm::vec3(glsl::lcg_randomf(rng), glsl::lcg_randomf(rng), glsl::lcg_randomf(rng));
+        r.p = bounds.lower + u * bounds.extent();
+        glm::vec3 n;
+        do {
+            n = glm::vec3(glsl::lcg_randomf(rng), glsl::lcg_randomf(rng), glsl::lcg_randomf(rng)) * 2.0f - glm::vec3(1.0f);
+        } while (!(dot(n, n) > 1.e-4f && dot(n, n) <= 1.0f));
+        r.n = normalize(n);
+    }
+    return receivers;
+}
+
+void estimate_receiver_variance(BenchmarkResult& result, std::vector<Receiver> const& receivers, int spp) {
+    int num_threads = parallel_thread_count();
+    std::vector<double> thread_mean(num_threads), thread_var(num_threads), thread_rel_var(num_threads);
+
+    BasicProfilingScope timer;
+    parallel_for(0, ilen(receivers), 16, [&](index_t i, int thread_idx) {
+        Receiver const& r = receivers[i];
+        glsl::LCGRand rng = glsl::get_lcg_rng(uint32_t(i), 0, 0);
+        // Welford accumulation of the irradiance estimate
+        double mean = 0.0, m2 = 0.0;
+        for (int s = 0; s < spp; ++s) {
+            glm::vec2 dir_sample = glm::vec2(glsl::lcg_randomf(rng), glsl::lcg_randomf(rng));
+            glm::vec2 sel_sample = glm::vec2(glsl::lcg_randomf(rng), glsl::lcg_randomf(rng));
+            glm::vec3 light_dir;
+            float light_dist, pdf, mis_wpdf;
+            glm::vec3 value = glsl::sample_tri_lights(r.p, r.n, dir_sample, sel_sample, light_dir, light_dist, pdf, mis_wpdf);
+            double estimate = 0.0;
+            if (pdf > 0.0f && light_dist > 0.0f)
+                estimate = double(glsl::luminance(value)) * std::max(double(dot(light_dir, r.n)), 0.0);
+            if (!(estimate == estimate))
+                estimate = 0.0;
+            double delta = estimate - mean;
+            mean += delta / double(s + 1);
+            m2 += delta * (estimate - mean);
+        }
+        double var = spp > 1 ? m2 / double(spp - 1) : 0.0;
+        thread_mean[thread_idx] += mean;
+        thread_var[thread_idx] += var;
+        if (mean > 0.0)
+            thread_rel_var[thread_idx] += var / (mean * mean);
+    });
+    timer.end();
+
+    double inv_count = receivers.empty() ? 0.0 : 1.0 / double(receivers.size());
+    for (int t = 0; t < num_threads; ++t) {
+        result.mean_irradiance += thread_mean[t] * inv_count;
+        result.mean_variance += thread_var[t] * inv_count;
+        result.mean_relative_variance += thread_rel_var[t] * inv_count;
+    }
+    double total_samples = double(receivers.size()) * double(spp);
+    if (total_samples > 0.0)
+        result.ns_per_sample = double(timer.elapsedNS()) * double(num_threads) / total_samples;
+}
+
+void write_json(char const* filename, std::string const& scene_file, size_t receiver_count, int spp, std::vector<BenchmarkResult> const& results) {
+    FILE* file = fopen(filename, "w");
+    if (!file) {
+        fprintf(stderr, "Failed to open JSON output file %s\n", filename);
+        return;
+    }
+    fprintf(file, "{\n  \"scene\": \"%s\",\n  \"receivers\": %zu,\n  \"spp\": %d,\n  \"configs\": [\n", scene_file.c_str(), receiver_count, spp);
+    for (size_t i = 0; i < results.size(); ++i) {
+        auto const& r = results[i];
+        fprintf(file, "    {\"bin_size\": %d, \"min_radiance\": %g, \"min_receiver_dist\": %g"
+            ", \"build_ms\": %.3f, \"memory_bytes\": %zu, \"lights\": %d, \"bins\": %d"
+            ", \"mean_irradiance\": %.9g, \"mean_variance\": %.9g, \"mean_relative_variance\": %.9g"
+            ", \"ns_per_sample\": %.2f}%s\n"
+            , r.config.bin_size, r.config.min_radiance, r.config.min_perceived_receiver_dist
+            , r.build_ms, r.memory_bytes, r.light_count, r.bin_count
+            , r.mean_irradiance, r.mean_variance, r.mean_relative_variance
+            , r.ns_per_sample, i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+}
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    std::string scene_file = argv[1];
+    char const* receiver_file = nullptr;
+    char const* json_file = nullptr;
+    int num_receivers = 1024;
+    int spp = 256;
+    std::vector<LightSamplingConfig> configs;
+
+    for (int i = 2; i < argc; ++i) {
+        bool has_arg = i + 1 < argc;
+        if (!strcmp(argv[i], "--receivers") && has_arg)
+            receiver_file = argv[++i];
+        else if (!strcmp(argv[i], "--num-receivers") && has_arg)
+            sscanf(argv[++i], "%i", &num_receivers);
+        else if (!strcmp(argv[i], "--spp") && has_arg)
+            sscanf(argv[++i], "%i", &spp);
+        else if (!strcmp(argv[i], "--threads") && has_arg)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--json") && has_arg)
+            json_file = argv[++i];
+        else if (!strcmp(argv[i], "--config") && has_arg) {
+            LightSamplingConfig config;
+            sscanf(argv[++i], "%i,%f,%f", &config.bin_size, &config.min_radiance, &config.min_perceived_receiver_dist);
+            if (config.bin_size < 1 || config.bin_size > BINNED_LIGHTS_BIN_MAX_SIZE) {
+                fprintf(stderr, "Bin size must be in [1, %d]\n", BINNED_LIGHTS_BIN_MAX_SIZE);
+                return 1;
+            }
+            configs.push_back(config);
+        }
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (configs.empty()) {
+        for (int bin_size : { BINNED_LIGHTS_BIN_MAX_SIZE, 8, 4, 1 }) {
+            LightSamplingConfig config;
+            config.bin_size = bin_size;
+            configs.push_back(config);
+        }
+    }
+
+    Scene scene({ scene_file });
+
+    BasicProfilingScope collect_timer;
+    std::vector<TriLight> emitters = collect_emitters(scene);
+    collect_timer.end();
+    printf("Collected %d emitters in %.2f ms\n", ilen(emitters), collect_timer.elapsedMS());
+    if (emitters.empty()) {
+        fprintf(stderr, "Scene contains no emissive triangles\n");
+        return 1;
+    }
+
+    std::vector<Receiver> receivers;
+    if (receiver_file)
+        receivers = load_receivers(receiver_file);
+    else
+        receivers = random_receivers(scene.compute_bounds(), num_receivers);
+    if (receivers.empty()) {
+        fprintf(stderr, "No receiver points\n");
+        return 1;
+    }
+    printf("Evaluating %d receivers at %d spp on %d threads\n", ilen(receivers), spp, parallel_thread_count());
+
+    std::vector<BenchmarkResult> results;
+    printf("%8s %10s %10s %10s %8s %8s %14s %14s %12s %10s\n"
+        , "bin_size", "min_rad", "min_dist", "build_ms", "MB", "lights", "irradiance", "variance", "rel_var", "ns/sample");
+    for (auto const& config : configs) {
+        BenchmarkResult result;
+        result.config = config;
+
+        BinnedLightSampling binned;
+        BasicProfilingScope build_timer;
+        update_light_sampling(binned, emitters, config);
+        build_timer.end();
+
+        result.build_ms = build_timer.elapsedMS();
+        result.light_count = ilen(binned.emitters);
+        result.bin_count = binned.bin_count();
+        result.memory_bytes = binned.emitters.size() * sizeof(TriLightData)
+            + binned.radiances.size() * sizeof(float);
+
+        if (!binned.emitters.empty()) {
+            glsl::bench_emitters = binned.emitters.data();
+            glsl::bench_emitter_count = result.light_count;
+            glsl::bench_bin_size = config.bin_size;
+            estimate_receiver_variance(result, receivers, spp);
+        }
+
+        printf("%8d %10g %10g %10.2f %8.2f %8d %14.6g %14.6g %12.6g %10.1f\n"
+            , config.bin_size, config.min_radiance, config.min_perceived_receiver_dist
+            , result.build_ms, double(result.memory_bytes) / (1024.0 * 1024.0), result.light_count
+            , result.mean_irradiance, result.mean_variance, result.mean_relative_variance, result.ns_per_sample);
+        results.push_back(result);
+    }
+
+    if (json_file)
+        write_json(json_file, scene_file, receivers.size(), spp, results);
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Synthetic LoD selection benchmark: runs the per-instance CPU culling and
+// LoD selection pass for a large number of instances of a few LoD groups
+// scattered over a city-sized area, with a camera turning around in place.
+
+#include "scene.h"
+#include "lod.h"
+#include "profiling.h"
+#include "parallel.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+
+void print_usage(char const* exe) {
+    printf("Usage: %s [options]\n"
+           "  --instances <n>      number of instances (default 1048576)\n"
+           "  --groups <n>         number of LoD groups (default 64)\n"
+           "  --lods <n>           levels of detail per group (default 4)\n"
+           "  --frames <n>         number of simulated frames (default 100)\n"
+           "  --max-distance <d>   distance culling threshold, 0 disables (default 0)\n"
+           "  --no-frustum         disable frustum culling\n"
+           "  --threads <n>        number of worker threads (default all)\n", exe);
+}
+
+// builds a scene without geometry, meshes only carry their cached bounds
+void build_synthetic_scene(Scene& scene, int group_count, int lod_count) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+
+    for (int group = 0; group < group_count; ++group) {
+        LodGroup lod_group;
+        float radius = 1.0f + 10.0f * u01(rng);
+        for (int lod = 0; lod < lod_count; ++lod) {
+            Mesh mesh;
+            mesh.bounds.box = AABB(glm::vec3(-radius), glm::vec3(radius));
+            mesh.bounds.sphere = Sphere(glm::vec3(0.0f), radius * 1.7320508f);
+            mesh.bounds_revision = mesh.model_vertex_revision();
+            scene.meshes.push_back(std::move(mesh));
+
+            ParameterizedMesh pmesh;
+            pmesh.mesh_id = ilen(scene.meshes) - 1;
+            pmesh.lod_group = ilen(scene.lod_groups);
+            scene.parameterized_meshes.push_back(std::move(pmesh));
+
+            lod_group.mesh_ids.push_back(ilen(scene.parameterized_meshes) - 1);
+            lod_group.detail_reduction.push_back(1.0f - 1.0f / float(1 << (2 * lod)));
+        }
+        scene.lod_groups.push_back(std::move(lod_group));
+    }
+}
+
+// same layout as the instances kept by the render backends
+struct BenchmarkInstance {
+    int32_t parameterized_mesh_id;
+    glm::mat4 transform;
+};
+
+std::vector<BenchmarkInstance> build_synthetic_instances(Scene const& scene, int instance_count) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    int const group_count = ilen(scene.lod_groups) - 1;
+
+    std::vector<BenchmarkInstance> instances(instance_count);
+    for (auto& inst : instances) {
+        int group = 1 + std::min(int(u01(rng) * float(group_count)), group_count - 1);
+        inst.parameterized_mesh_id = scene.lod_groups[group].mesh_ids[0];
+        glm::vec3 position = glm::vec3(u01(rng) * 4000.0f - 2000.0f, 0.0f, u01(rng) * 4000.0f - 2000.0f);
+        glm::mat4 transform = glm::translate(glm::mat4(1.0f), position);
+        transform = glm::rotate(transform, u01(rng) * 6.28318530718f, glm::vec3(0.0f, 1.0f, 0.0f));
+        inst.transform = glm::scale(transform, glm::vec3(0.5f + 1.5f * u01(rng)));
+    }
+    return instances;
+}
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    int instance_count = 1 << 20;
+    int group_count = 64;
+    int lod_count = 4;
+    int frame_count = 100;
+    LoDCullingView view;
+
+    for (int i = 1; i < argc; ++i) {
+        bool has_arg = i + 1 < argc;
+        if (!strcmp(argv[i], "--instances") && has_arg)
+            sscanf(argv[++i], "%i", &instance_count);
+        else if (!strcmp(argv[i], "--groups") && has_arg)
+            sscanf(argv[++i], "%i", &group_count);
+        else if (!strcmp(argv[i], "--lods") && has_arg)
+            sscanf(argv[++i], "%i", &lod_count);
+        else if (!strcmp(argv[i], "--frames") && has_arg)
+            sscanf(argv[++i], "%i", &frame_count);
+        else if (!strcmp(argv[i], "--max-distance") && has_arg)
+            sscanf(argv[++i], "%f", &view.max_distance);
+        else if (!strcmp(argv[i], "--no-frustum"))
+            view.frustum_culling = false;
+        else if (!strcmp(argv[i], "--threads") && has_arg)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (instance_count < 1 || group_count < 1 || lod_count < 1 || lod_count > 8 || frame_count < 1) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    Scene scene;
+    build_synthetic_scene(scene, group_count, lod_count);
+    std::vector<BenchmarkInstance> instances = build_synthetic_instances(scene, instance_count);
+
+    float const fov_y = 60.0f;
+    LoDSystem lod_system;
+    BasicProfilingScope init_timer;
+    lod_system.initialize(scene);
+    lod_system.update_camera(fov_y);
+    init_timer.end();
+    printf("%d instances of %d LoD groups, initialize %.2f ms, %d threads\n"
+        , instance_count, group_count, init_timer.elapsedMS(), parallel_thread_count());
+
+    LoDInstanceView instance_view;
+    instance_view.parameterized_mesh_ids = &instances[0].parameterized_mesh_id;
+    instance_view.transforms = &instances[0].transform;
+    instance_view.stride = sizeof(BenchmarkInstance);
+    instance_view.count = instances.size();
+
+    glm::mat4 projection = glm::perspective(glm::radians(fov_y), 16.0f / 9.0f, 0.1f, 10000.0f);
+    LoDSelection selection;
+    double select_ms = 0.0, min_select_ms = 1.e30;
+    size_t visible = 0, culled_frustum = 0, culled_distance = 0;
+    std::vector<size_t> lod_histogram(lod_count, 0);
+    for (int frame = 0; frame < frame_count; ++frame) {
+        float angle = 6.28318530718f * float(frame) / float(frame_count);
+        view.eye = glm::vec3(0.0f, 2.0f, 0.0f);
+        glm::vec3 target = view.eye + glm::vec3(std::cos(angle), -0.05f, std::sin(angle));
+        view.view_projection = projection * glm::lookAt(view.eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+
+        BasicProfilingScope select_timer;
+        lod_system.select_instances(selection, view, instance_view);
+        select_timer.end();
+        select_ms += select_timer.elapsedMS();
+        min_select_ms = std::min(min_select_ms, select_timer.elapsedMS());
+
+        visible += selection.instances.size();
+        culled_frustum += selection.culled_frustum;
+        culled_distance += selection.culled_distance;
+        for (auto const& entry : selection.instances)
+            ++lod_histogram[entry.lod];
+    }
+
+    double inv_frames = 1.0 / double(frame_count);
+    printf("per frame: select %.3f ms (min %.3f ms), %.1f ns/instance\n"
+        , select_ms * inv_frames, min_select_ms, select_ms * inv_frames * 1.e6 / double(instance_count));
+    printf("per frame: %.0f visible, %.0f frustum culled, %.0f distance culled\n"
+        , double(visible) * inv_frames, double(culled_frustum) * inv_frames, double(culled_distance) * inv_frames);
+    for (int lod = 0; lod < lod_count; ++lod)
+        printf("  LoD %d: %.1f%%\n", lod, visible ? 100.0 * double(lod_histogram[lod]) / double(visible) : 0.0);
+    return 0;
+}
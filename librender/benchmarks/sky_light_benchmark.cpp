@@ -0,0 +1,135 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Sky light update benchmark: compares the sky and sun parameters interpolated
+// from the precomputed model table against the direct evaluation of the
+// Hosek-Wilkie model for random sun directions, turbidities and albedos, and
+// measures the cost of one sky update with either method.
+
+#include "sky_light.h"
+#include "parallel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace glsl {
+    using namespace glm;
+    #include "../rendering/language.hpp"
+    #include "../rendering/lights/sky_model_arhosek/sky_model.h.glsl"
+    #include "../rendering/lights/sky_model_arhosek/sky_model.glsl"
+}
+
+namespace {
+
+void print_usage(char const* exe) {
+    printf("Usage: %s [options]\n"
+           "  --configs <n>   random sky configurations (default 10000)\n"
+           "  --threads <n>   number of worker threads for the table generation (default all)\n", exe);
+}
+
+glsl::SkyModelParams sky_params(SkyLight const& sky) {
+    glsl::SkyModelParams params;
+    for (int i = 0; i < 9; ++i)
+        params.configs[i] = sky.configs[i];
+    params.radiances = sky.radiances;
+    return params;
+}
+
+float max_component(glm::vec3 v) {
+    return std::max(std::max(std::fabs(v.x), std::fabs(v.y)), std::fabs(v.z));
+}
+
+// largest difference of the sky radiance over the upper hemisphere, relative to its peak
+float sky_radiance_error(SkyLight const& table, SkyLight const& direct, std::vector<glm::vec3> const& view_dirs) {
+    glsl::SkyModelParams table_params = sky_params(table), direct_params = sky_params(direct);
+    float max_radiance = 0.0f, max_difference = 0.0f;
+    for (glm::vec3 const& dir : view_dirs) {
+        glm::vec3 reference = glsl::skymodel_radiance(direct_params, direct.sun_dir, dir);
+        glm::vec3 interpolated = glsl::skymodel_radiance(table_params, table.sun_dir, dir);
+        max_radiance = std::max(max_radiance, max_component(reference));
+        max_difference = std::max(max_difference, max_component(interpolated - reference));
+    }
+    return max_radiance > 0.0f ? max_difference / max_radiance : max_difference;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int num_configs = 10000;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--configs") && i + 1 < argc)
+            num_configs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    std::vector<SceneConfig> configs(num_configs);
+    for (SceneConfig& config : configs) {
+        float elevation = u01(rng) * float(M_PI / 2);
+        float azimuth = u01(rng) * float(2 * M_PI);
+        config.sun_dir = glm::vec3(std::cos(elevation) * std::cos(azimuth), std::sin(elevation), std::cos(elevation) * std::sin(azimuth));
+        config.turbidity = 1.0f + 9.0f * u01(rng);
+        config.albedo = glm::vec3(u01(rng), u01(rng), u01(rng));
+    }
+    std::vector<glm::vec3> view_dirs;
+    for (int i = 0; i < 256; ++i) {
+        float z = u01(rng), phi = u01(rng) * float(2 * M_PI);
+        float r = std::sqrt(1.0f - z * z);
+        view_dirs.push_back(glm::vec3(r * std::cos(phi), z, r * std::sin(phi)));
+    }
+
+    // the first update generates or maps the table
+    auto start = std::chrono::steady_clock::now();
+    compute_sky_light(configs[0], false);
+    auto end = std::chrono::steady_clock::now();
+    printf("table setup: %.1f ms\n", std::chrono::duration<double, std::milli>(end - start).count());
+
+    std::vector<SkyLight> direct(num_configs), table(num_configs);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_configs; ++i)
+        direct[i] = compute_sky_light_direct(configs[i], false);
+    end = std::chrono::steady_clock::now();
+    double direct_us = std::chrono::duration<double, std::micro>(end - start).count() / num_configs;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_configs; ++i)
+        table[i] = compute_sky_light(configs[i], false);
+    end = std::chrono::steady_clock::now();
+    double table_us = std::chrono::duration<double, std::micro>(end - start).count() / num_configs;
+    printf("sky update: direct %.2f us, table %.3f us (%.0fx)\n", direct_us, table_us, direct_us / table_us);
+
+    float max_sky_error = 0.0f, max_sun_error = 0.0f;
+    double mean_sky_error = 0.0, mean_sun_error = 0.0;
+    int worst_sun = 0;
+    for (int i = 0; i < num_configs; ++i) {
+        float sky_error = sky_radiance_error(table[i], direct[i], view_dirs);
+        glm::vec3 sun = glm::vec3(table[i].sun_radiance), sun_reference = glm::vec3(direct[i].sun_radiance);
+        float sun_error = max_component(sun - sun_reference) / std::max(max_component(sun_reference), 1.e-6f);
+        if (sun_error > max_sun_error)
+            worst_sun = i;
+        max_sky_error = std::max(max_sky_error, sky_error);
+        max_sun_error = std::max(max_sun_error, sun_error);
+        mean_sky_error += sky_error;
+        mean_sun_error += sun_error;
+    }
+    printf("sky radiance error: mean %.2e, max %.2e\n", mean_sky_error / num_configs, max_sky_error);
+    printf("sun radiance error: mean %.2e, max %.2e (sun elevation %.4f, turbidity %.2f)\n", mean_sun_error / num_configs, max_sun_error
+        , configs[worst_sun].sun_dir.y, configs[worst_sun].turbidity);
+
+    if (max_sky_error > SKY_LIGHT_TABLE_TOLERANCE || max_sun_error > SKY_LIGHT_TABLE_TOLERANCE) {
+        printf("FAILED: tolerance %.2e exceeded\n", SKY_LIGHT_TABLE_TOLERANCE);
+        return 1;
+    }
+    return 0;
+}
@@ -81,3 +81,49 @@ Sphere Sphere::boundPoints(const glm::vec3* positions, int num_positions) {
     return bounding_sphere;
 }
 
+
+AABB::AABB(const glm::vec3 &_lower, const glm::vec3 &_upper)
+    : lower(_lower), upper(_upper) {}
+
+bool AABB::empty() const {
+    return !(lower.x <= upper.x && lower.y <= upper.y && lower.z <= upper.z);
+}
+
+glm::vec3 AABB::extent() const {
+    return upper - lower;
+}
+
+glm::vec3 AABB::center() const {
+    return 0.5f * (lower + upper);
+}
+
+const AABB& AABB::operator+=(const glm::vec3& point) {
+    lower = glm::min(lower, point);
+    upper = glm::max(upper, point);
+    return *this;
+}
+
+const AABB& AABB::operator+=(const AABB& other) {
+    lower = glm::min(lower, other.lower);
+    upper = glm::max(upper, other.upper);
+    return *this;
+}
+
+AABB AABB::operator+(const AABB& other) const {
+    return AABB(*this) += other;
+}
+
+AABB AABB::transformed(const glm::mat4& transform) const {
+    if (empty())
+        return AABB();
+    // Arvo's method: accumulate the extremal contributions of each matrix column
+    glm::vec3 t = glm::vec3(transform[3]);
+    AABB result(t, t);
+    for (int i = 0; i < 3; i++) {
+        glm::vec3 a = glm::vec3(transform[i]) * lower[i];
+        glm::vec3 b = glm::vec3(transform[i]) * upper[i];
+        result.lower += glm::min(a, b);
+        result.upper += glm::max(a, b);
+    }
+    return result;
+}
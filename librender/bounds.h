@@ -4,6 +4,7 @@
 #pragma once
 
 #include <vector>
+#include <cfloat>
 #include <glm/glm.hpp>
 
 struct Sphere {
@@ -20,3 +21,22 @@ struct Sphere {
     static Sphere boundPoints(const glm::vec3 *positions, int num_positions);
 };
 
+
+struct AABB {
+    glm::vec3 lower = glm::vec3(FLT_MAX);
+    glm::vec3 upper = glm::vec3(-FLT_MAX);
+
+    AABB() = default;
+    AABB(const glm::vec3 &_lower, const glm::vec3 &_upper);
+
+    bool empty() const;
+    glm::vec3 extent() const;
+    glm::vec3 center() const;
+
+    const AABB &operator+=(const glm::vec3 &point);
+    const AABB &operator+=(const AABB &other);
+    AABB operator+(const AABB &other) const;
+
+    // Computes the bounds of this box after applying an affine transform
+    AABB transformed(const glm::mat4 &transform) const;
+};
@@ -0,0 +1,454 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "cpu_bvh.h"
+#include "parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+namespace {
+
+// beyond this depth, nodes are split at the object median to bound the tree depth
+const int SAH_MAX_DEPTH = 64;
+const int MAX_BINS = 64;
+
+struct BuildNode {
+    AABB bounds;
+    int32_t left = -1, right = -1;
+    uint32_t first = 0, count = 0; // leaf if count > 0
+};
+
+float half_area(const AABB &box) {
+    if (box.empty())
+        return 0.0f;
+    glm::vec3 e = box.extent();
+    return e.x * e.y + e.y * e.z + e.z * e.x;
+}
+
+struct Bins {
+    AABB bounds[3][MAX_BINS];
+    uint32_t counts[3][MAX_BINS] = { };
+
+    void merge(const Bins &other, int bin_count) {
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int b = 0; b < bin_count; ++b) {
+                bounds[axis][b] += other.bounds[axis][b];
+                counts[axis][b] += other.counts[axis][b];
+            }
+        }
+    }
+};
+
+// Node of the top levels whose primitive range is built as an independent subtree
+struct DeferredSubtree {
+    uint32_t begin, end;
+    int level;
+    int32_t node_index;
+};
+
+struct BVH2Builder {
+    const AABB *primitive_bounds;
+    const glm::vec3 *centroids;
+    uint32_t *indices; // shared by all subtree builders, which partition disjoint ranges
+    std::vector<BuildNode> nodes;
+    BVHBuildParams params;
+    int depth = 0;
+    // if set, ranges of at most parallel_subtree_threshold primitives are only reserved a node
+    std::vector<DeferredSubtree> *deferred_subtrees = nullptr;
+
+    struct Split {
+        int axis = -1;
+        int bin = 0;
+        float cost = 0.0f;
+    };
+
+    int bin_of(const glm::vec3 &centroid, int axis, const AABB &centroid_bounds, float scale) const {
+        int b = int((centroid[axis] - centroid_bounds.lower[axis]) * scale);
+        return std::min(std::max(b, 0), params.bin_count - 1);
+    }
+
+    void bin_range(Bins &bins, uint32_t begin, uint32_t end, const AABB &centroid_bounds, const glm::vec3 &scale) const {
+        for (uint32_t i = begin; i < end; ++i) {
+            uint32_t prim = indices[i];
+            for (int axis = 0; axis < 3; ++axis) {
+                int b = bin_of(centroids[prim], axis, centroid_bounds, scale[axis]);
+                bins.bounds[axis][b] += primitive_bounds[prim];
+                ++bins.counts[axis][b];
+            }
+        }
+    }
+
+    Split find_split(uint32_t begin, uint32_t end, const AABB &centroid_bounds) const {
+        glm::vec3 extent = centroid_bounds.extent();
+        glm::vec3 scale;
+        for (int axis = 0; axis < 3; ++axis)
+            scale[axis] = extent[axis] > 0.0f ? float(params.bin_count) / extent[axis] : 0.0f;
+
+        Bins bins;
+        uint32_t count = end - begin;
+        if (count >= params.parallel_binning_threshold) {
+            const uint32_t grain = params.parallel_binning_threshold / 4;
+            std::vector<Bins> chunk_bins((count + grain - 1) / grain);
+            parallel_for_ranges(begin, end, grain, [&](index_t range_begin, index_t range_end, int) {
+                bin_range(chunk_bins[(range_begin - begin) / grain], uint32_t(range_begin), uint32_t(range_end), centroid_bounds, scale);
+            });
+            for (auto const &chunk : chunk_bins)
+                bins.merge(chunk, params.bin_count);
+        } else
+            bin_range(bins, begin, end, centroid_bounds, scale);
+
+        Split best;
+        float right_area[MAX_BINS];
+        uint32_t right_count[MAX_BINS];
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!(extent[axis] > 0.0f))
+                continue;
+            AABB accum;
+            uint32_t n = 0;
+            for (int b = params.bin_count - 1; b > 0; --b) {
+                accum += bins.bounds[axis][b];
+                n += bins.counts[axis][b];
+                right_area[b] = half_area(accum);
+                right_count[b] = n;
+            }
+            accum = AABB();
+            n = 0;
+            for (int b = 1; b < params.bin_count; ++b) {
+                accum += bins.bounds[axis][b - 1];
+                n += bins.counts[axis][b - 1];
+                if (n == 0 || right_count[b] == 0)
+                    continue;
+                float cost = half_area(accum) * float(n) + right_area[b] * float(right_count[b]);
+                if (best.axis < 0 || cost < best.cost) {
+                    best.axis = axis;
+                    best.bin = b;
+                    best.cost = cost;
+                }
+            }
+        }
+        return best;
+    }
+
+    int32_t make_leaf(BuildNode &node, uint32_t begin, uint32_t end) {
+        node.first = begin;
+        node.count = end - begin;
+        nodes.push_back(node);
+        return int32_t(nodes.size()) - 1;
+    }
+
+    int32_t build(uint32_t begin, uint32_t end, int level) {
+        uint32_t count = end - begin;
+        if (deferred_subtrees && count <= params.parallel_subtree_threshold) {
+            deferred_subtrees->push_back({ begin, end, level, int32_t(nodes.size()) });
+            nodes.emplace_back();
+            return int32_t(nodes.size()) - 1;
+        }
+        depth = std::max(depth, level + 1);
+
+        BuildNode node;
+        AABB centroid_bounds;
+        for (uint32_t i = begin; i < end; ++i) {
+            node.bounds += primitive_bounds[indices[i]];
+            centroid_bounds += centroids[indices[i]];
+        }
+        if (count <= 1)
+            return make_leaf(node, begin, end);
+
+        uint32_t mid = begin;
+        Split split;
+        if (level < SAH_MAX_DEPTH)
+            split = find_split(begin, end, centroid_bounds);
+        if (split.axis >= 0) {
+            // SAH termination: compare against intersecting all primitives in a single leaf
+            float split_cost = params.traversal_cost + split.cost / std::max(half_area(node.bounds), 1.e-30f);
+            if (count <= uint32_t(params.max_leaf_size) && split_cost >= float(count))
+                return make_leaf(node, begin, end);
+
+            glm::vec3 extent = centroid_bounds.extent();
+            float scale = float(params.bin_count) / extent[split.axis];
+            mid = uint32_t(std::partition(indices + begin, indices + end, [&](uint32_t prim) {
+                return bin_of(centroids[prim], split.axis, centroid_bounds, scale) < split.bin;
+            }) - indices);
+        } else if (count <= uint32_t(params.max_leaf_size))
+            return make_leaf(node, begin, end);
+
+        if (mid == begin || mid == end) {
+            // coincident centroids or depth limit: object median on the largest axis
+            glm::vec3 extent = centroid_bounds.extent();
+            int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+            mid = begin + count / 2;
+            std::nth_element(indices + begin, indices + mid, indices + end, [&](uint32_t a, uint32_t b) {
+                return centroids[a][axis] < centroids[b][axis];
+            });
+        }
+
+        int32_t node_index = int32_t(nodes.size());
+        nodes.push_back(node);
+        int32_t left = build(begin, mid, level + 1);
+        int32_t right = build(mid, end, level + 1);
+        nodes[node_index].left = left;
+        nodes[node_index].right = right;
+        return node_index;
+    }
+};
+
+// Opens the largest inner nodes below a BVH2 node until max_children nodes are gathered
+int gather_children(const std::vector<BuildNode> &bvh2, int32_t bvh2_index, int max_children, int32_t *children) {
+    int child_count = 0;
+    const BuildNode &root = bvh2[bvh2_index];
+    if (root.count)
+        children[child_count++] = bvh2_index;
+    else {
+        children[child_count++] = root.left;
+        children[child_count++] = root.right;
+    }
+    while (child_count < max_children) {
+        int open = -1;
+        float open_area = -1.0f;
+        for (int i = 0; i < child_count; ++i) {
+            const BuildNode &child = bvh2[children[i]];
+            if (!child.count && half_area(child.bounds) > open_area) {
+                open = i;
+                open_area = half_area(child.bounds);
+            }
+        }
+        if (open < 0)
+            break;
+        const BuildNode &opened = bvh2[children[open]];
+        children[open] = opened.left;
+        children[child_count++] = opened.right;
+    }
+    return child_count;
+}
+
+struct BVH4Collapser {
+    const std::vector<BuildNode> &bvh2;
+    BVH4 &bvh4;
+
+    static void set_child_bounds(BVH4Node &node, int slot, const AABB &box) {
+        node.lower_x[slot] = box.lower.x; node.upper_x[slot] = box.upper.x;
+        node.lower_y[slot] = box.lower.y; node.upper_y[slot] = box.upper.y;
+        node.lower_z[slot] = box.lower.z; node.upper_z[slot] = box.upper.z;
+    }
+
+    int collapse(int32_t bvh2_index, int level) {
+        int32_t node_index = int32_t(bvh4.nodes.size());
+        bvh4.nodes.emplace_back();
+        bvh4.depth = std::max(bvh4.depth, level + 1);
+
+        int32_t children[4];
+        int child_count = gather_children(bvh2, bvh2_index, 4, children);
+
+        BVH4Node node;
+        for (int slot = 0; slot < 4; ++slot) {
+            node.child[slot] = -1;
+            node.count[slot] = 0;
+            set_child_bounds(node, slot, AABB(glm::vec3(0.0f), glm::vec3(0.0f)));
+        }
+        for (int slot = 0; slot < child_count; ++slot) {
+            const BuildNode &child = bvh2[children[slot]];
+            set_child_bounds(node, slot, child.bounds);
+            if (child.count) {
+                node.child[slot] = int32_t(child.first);
+                node.count[slot] = child.count;
+            } else
+                node.child[slot] = collapse(children[slot], level + 1);
+        }
+        bvh4.nodes[node_index] = node;
+        return node_index;
+    }
+};
+
+float exponent_scale(int exponent) {
+    uint32_t bits = uint32_t(exponent + 127) << 23;
+    float scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return scale;
+}
+
+struct BVH8Collapser {
+    const std::vector<BuildNode> &bvh2;
+    const std::vector<uint32_t> &bvh2_primitive_indices;
+    BVH8 &bvh8;
+
+    // smallest power of two that maps the node extent to 8 bits
+    static int quantization_exponent(float extent) {
+        if (!(extent > 0.0f))
+            return -126;
+        int exponent = std::max(int(std::ceil(std::log2(extent / 255.0f))), -126);
+        while (extent > 255.0f * exponent_scale(exponent))
+            ++exponent;
+        return exponent;
+    }
+
+    void collapse(int32_t bvh2_index, uint32_t node_index, int level) {
+        bvh8.depth = std::max(bvh8.depth, level + 1);
+
+        int32_t children[8];
+        int child_count = gather_children(bvh2, bvh2_index, 8, children);
+
+        const AABB &bounds = bvh2[bvh2_index].bounds;
+        BVH8Node node;
+        memset(&node, 0, sizeof(node));
+        node.origin = bounds.lower;
+        glm::vec3 scale;
+        for (int axis = 0; axis < 3; ++axis) {
+            int exponent = quantization_exponent(bounds.upper[axis] - bounds.lower[axis]);
+            node.exponent[axis] = int8_t(exponent);
+            scale[axis] = exponent_scale(exponent);
+        }
+
+        int inner_count = 0;
+        for (int slot = 0; slot < child_count; ++slot)
+            inner_count += bvh2[children[slot]].count ? 0 : 1;
+        node.child_base = uint32_t(bvh8.nodes.size());
+        bvh8.nodes.resize(bvh8.nodes.size() + inner_count);
+        node.primitive_base = uint32_t(bvh8.primitive_indices.size());
+
+        for (int slot = 0; slot < child_count; ++slot) {
+            const BuildNode &child = bvh2[children[slot]];
+            uint8_t *lower[3] = {node.lower_x, node.lower_y, node.lower_z};
+            uint8_t *upper[3] = {node.upper_x, node.upper_y, node.upper_z};
+            for (int axis = 0; axis < 3; ++axis) {
+                // conservative rounding, verified against the decoded bounds
+                float origin = node.origin[axis];
+                int lo = int(std::floor((child.bounds.lower[axis] - origin) / scale[axis]));
+                int hi = int(std::ceil((child.bounds.upper[axis] - origin) / scale[axis]));
+                lo = std::min(std::max(lo, 0), 255);
+                hi = std::min(std::max(hi, 0), 255);
+                while (lo > 0 && origin + float(lo) * scale[axis] > child.bounds.lower[axis])
+                    --lo;
+                while (hi < 255 && origin + float(hi) * scale[axis] < child.bounds.upper[axis])
+                    ++hi;
+                lower[axis][slot] = uint8_t(lo);
+                upper[axis][slot] = uint8_t(hi);
+            }
+            if (child.count) {
+                uint32_t offset = uint32_t(bvh8.primitive_indices.size()) - node.primitive_base;
+                node.meta[slot] = uint8_t(child.count << 5 | offset);
+                for (uint32_t i = 0; i < child.count; ++i)
+                    bvh8.primitive_indices.push_back(bvh2_primitive_indices[child.first + i]);
+            } else
+                node.inner_mask |= uint8_t(1 << slot);
+        }
+        bvh8.nodes[node_index] = node;
+
+        uint32_t inner_rank = 0;
+        for (int slot = 0; slot < child_count; ++slot) {
+            if (!bvh2[children[slot]].count)
+                collapse(children[slot], node.child_base + inner_rank++, level + 1);
+        }
+    }
+};
+
+struct BVH2 {
+    std::vector<BuildNode> nodes;
+    std::vector<uint32_t> indices;
+    int32_t root = -1;
+};
+
+// The top levels are built first, deferring all ranges below parallel_subtree_threshold
+// primitives, which are then built in parallel and spliced into the node array.
+BVH2 build_bvh2(const AABB *primitive_bounds, size_t primitive_count, BVHBuildParams const &params) {
+    BVH2 bvh2;
+    std::vector<glm::vec3> centroids(primitive_count);
+    bvh2.indices.resize(primitive_count);
+    std::iota(bvh2.indices.begin(), bvh2.indices.end(), 0u);
+    parallel_for(0, index_t(primitive_count), 16 * 1024, [&](index_t i, int) {
+        centroids[i] = primitive_bounds[i].center();
+    });
+
+    BVH2Builder builder;
+    builder.primitive_bounds = primitive_bounds;
+    builder.centroids = centroids.data();
+    builder.indices = bvh2.indices.data();
+    builder.params = params;
+    builder.params.bin_count = std::min(std::max(params.bin_count, 2), MAX_BINS);
+    builder.params.max_leaf_size = std::max(params.max_leaf_size, 1);
+    builder.params.parallel_binning_threshold = std::max(params.parallel_binning_threshold, 1024u);
+    builder.params.parallel_subtree_threshold = std::max(params.parallel_subtree_threshold, 256u);
+    BVH2Builder subtree_builder = builder;
+    std::vector<DeferredSubtree> deferred_subtrees;
+    if (primitive_count > builder.params.parallel_subtree_threshold && parallel_thread_count() > 1)
+        builder.deferred_subtrees = &deferred_subtrees;
+    builder.nodes.reserve(2 * primitive_count / std::max(builder.params.max_leaf_size / 2, 1) + 1);
+    bvh2.root = builder.build(0, uint32_t(primitive_count), 0);
+    if (deferred_subtrees.empty()) {
+        bvh2.nodes = std::move(builder.nodes);
+        return bvh2;
+    }
+
+    // largest subtrees first for load balancing
+    std::sort(deferred_subtrees.begin(), deferred_subtrees.end(), [](DeferredSubtree const &a, DeferredSubtree const &b) {
+        return a.end - a.begin > b.end - b.begin;
+    });
+    std::vector<BVH2Builder> subtree_builders(deferred_subtrees.size(), subtree_builder);
+    std::vector<int32_t> subtree_roots(deferred_subtrees.size());
+    parallel_for(0, index_t(deferred_subtrees.size()), 1, [&](index_t i, int) {
+        BVH2Builder &subtree = subtree_builders[i];
+        DeferredSubtree const &range = deferred_subtrees[i];
+        subtree.nodes.reserve(2 * (range.end - range.begin) / std::max(builder.params.max_leaf_size / 2, 1) + 1);
+        subtree_roots[i] = subtree.build(range.begin, range.end, range.level);
+    });
+
+    // splice the subtrees, the placeholder node of each subtree takes its root
+    for (size_t i = 0; i < deferred_subtrees.size(); ++i) {
+        BVH2Builder const &subtree = subtree_builders[i];
+        int32_t offset = int32_t(builder.nodes.size());
+        for (BuildNode node : subtree.nodes) {
+            if (!node.count) {
+                node.left += offset;
+                node.right += offset;
+            }
+            builder.nodes.push_back(node);
+        }
+        builder.nodes[deferred_subtrees[i].node_index] = builder.nodes[offset + subtree_roots[i]];
+        builder.depth = std::max(builder.depth, subtree.depth);
+    }
+    bvh2.nodes = std::move(builder.nodes);
+    return bvh2;
+}
+
+} // namespace
+
+size_t BVH4::memory_bytes() const {
+    return nodes.size() * sizeof(BVH4Node) + primitive_indices.size() * sizeof(uint32_t);
+}
+
+BVH4 build_bvh4(const AABB *primitive_bounds, size_t primitive_count, BVHBuildParams const &params) {
+    BVH4 bvh;
+    if (primitive_count == 0)
+        return bvh;
+
+    BVH2 bvh2 = build_bvh2(primitive_bounds, primitive_count, params);
+    bvh.bounds = bvh2.nodes[bvh2.root].bounds;
+    bvh.primitive_indices = std::move(bvh2.indices);
+    bvh.nodes.reserve(bvh2.nodes.size() / 2 + 1);
+    BVH4Collapser collapser{bvh2.nodes, bvh};
+    collapser.collapse(bvh2.root, 0);
+    return bvh;
+}
+
+size_t BVH8::memory_bytes() const {
+    return nodes.size() * sizeof(BVH8Node) + primitive_indices.size() * sizeof(uint32_t);
+}
+
+BVH8 build_bvh8(const AABB *primitive_bounds, size_t primitive_count, BVHBuildParams const &params) {
+    BVH8 bvh;
+    if (primitive_count == 0)
+        return bvh;
+
+    // leaf ranges are encoded in 3 bits of count and 5 bits of offset per slot
+    BVHBuildParams bvh8_params = params;
+    bvh8_params.max_leaf_size = std::min(params.max_leaf_size, 4);
+    BVH2 bvh2 = build_bvh2(primitive_bounds, primitive_count, bvh8_params);
+    bvh.bounds = bvh2.nodes[bvh2.root].bounds;
+    bvh.primitive_indices.reserve(primitive_count);
+    bvh.nodes.reserve(bvh2.nodes.size() / 4 + 1);
+    bvh.nodes.resize(1);
+    BVH8Collapser collapser{bvh2.nodes, bvh2.indices, bvh};
+    collapser.collapse(bvh2.root, 0, 0);
+    return bvh;
+}
@@ -0,0 +1,264 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <glm/glm.hpp>
+#include "bounds.h"
+
+/* Inner node of a 4-wide BVH. The child bounds are stored per axis (SoA), so
+ * that all four slab tests run as straight-line code the compiler vectorizes.
+ * Inner children reference their node, leaf children the first of `count`
+ * consecutive primitives, unused slots have child = -1.
+ */
+struct BVH4Node {
+    float lower_x[4], upper_x[4];
+    float lower_y[4], upper_y[4];
+    float lower_z[4], upper_z[4];
+    int32_t child[4];
+    uint32_t count[4]; // 0 for inner children
+};
+
+struct BVH4 {
+    std::vector<BVH4Node> nodes; // root at index 0, empty if there are no primitives
+    std::vector<uint32_t> primitive_indices; // leaf ranges index into this array
+    AABB bounds;
+    int depth = 0;
+
+    size_t memory_bytes() const;
+};
+
+struct BVHBuildParams {
+    int max_leaf_size = 4;
+    int bin_count = 16;
+    float traversal_cost = 1.0f; // relative to the cost of one primitive intersection
+    // nodes with more primitives are binned in parallel
+    uint32_t parallel_binning_threshold = 64 * 1024;
+    // nodes with at most this many primitives are built as independent subtrees in parallel
+    uint32_t parallel_subtree_threshold = 4 * 1024;
+};
+
+// Binned SAH build over primitive bounding boxes, collapsed into a 4-wide tree
+BVH4 build_bvh4(const AABB *primitive_bounds, size_t primitive_count, BVHBuildParams const &params = {});
+
+/* Compressed inner node of an 8-wide BVH. Child bounds are quantized to 8 bits
+ * per axis on a power-of-two grid anchored at the node origin, inner children
+ * are stored consecutively from child_base (in slot order), and the primitives
+ * of all leaf children are consecutive from primitive_base. A leaf child has
+ * meta = count << 5 | offset to primitive_base, unused slots have meta = 0.
+ */
+struct BVH8Node {
+    glm::vec3 origin;
+    int8_t exponent[3];
+    uint8_t inner_mask;
+    uint32_t child_base;
+    uint32_t primitive_base;
+    uint8_t meta[8];
+    uint8_t lower_x[8], lower_y[8], lower_z[8];
+    uint8_t upper_x[8], upper_y[8], upper_z[8];
+};
+
+struct BVH8 {
+    std::vector<BVH8Node> nodes; // root at index 0, empty if there are no primitives
+    std::vector<uint32_t> primitive_indices;
+    AABB bounds;
+    int depth = 0;
+
+    size_t memory_bytes() const;
+};
+
+// Same build as build_bvh4, collapsed into compressed 8-wide nodes with at most 4 primitives per leaf
+BVH8 build_bvh8(const AABB *primitive_bounds, size_t primitive_count, BVHBuildParams const &params = {});
+
+// sufficient for the depth limit enforced by build_bvh4
+#define BVH4_TRAVERSAL_STACK_SIZE 320
+#define BVH8_TRAVERSAL_STACK_SIZE 704
+
+struct BVHRay {
+    glm::vec3 origin;
+    glm::vec3 dir;
+    glm::vec3 inv_dir;
+    float t_min;
+
+    BVHRay() = default;
+    BVHRay(const glm::vec3 &origin, const glm::vec3 &dir, float t_min = 0.0f)
+        : origin(origin), dir(dir), inv_dir(safe_inverse(dir.x), safe_inverse(dir.y), safe_inverse(dir.z)), t_min(t_min) {
+    }
+
+    // finite for axis-parallel rays, avoids 0 * inf in the slab tests
+    static float safe_inverse(float d) {
+        return 1.0f / (std::abs(d) > 1.e-20f ? d : std::copysign(1.e-20f, d));
+    }
+};
+
+// Slab tests against all four children, returns the mask of children entered before t_max
+inline int intersect_bvh4_children(const BVH4Node &node, const BVHRay &ray, float t_max, float t_entry[4]) {
+    float t_exit[4];
+    for (int i = 0; i < 4; ++i) {
+        float tx0 = (node.lower_x[i] - ray.origin.x) * ray.inv_dir.x;
+        float tx1 = (node.upper_x[i] - ray.origin.x) * ray.inv_dir.x;
+        float ty0 = (node.lower_y[i] - ray.origin.y) * ray.inv_dir.y;
+        float ty1 = (node.upper_y[i] - ray.origin.y) * ray.inv_dir.y;
+        float tz0 = (node.lower_z[i] - ray.origin.z) * ray.inv_dir.z;
+        float tz1 = (node.upper_z[i] - ray.origin.z) * ray.inv_dir.z;
+        float t_near = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), ray.t_min));
+        float t_far = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), t_max));
+        t_entry[i] = t_near;
+        t_exit[i] = t_far;
+    }
+    int mask = 0;
+    for (int i = 0; i < 4; ++i)
+        mask |= int(t_entry[i] <= t_exit[i] && node.child[i] >= 0) << i;
+    return mask;
+}
+
+/* Front-to-back traversal. leaf_fn(first_primitive, primitive_count, t_max)
+ * intersects a leaf range and shortens t_max on hits, returning true ends the
+ * traversal early (e.g. for any-hit queries).
+ */
+template <class LeafFn>
+inline void traverse_bvh4(const BVH4 &bvh, const BVHRay &ray, float &t_max, LeafFn &&leaf_fn) {
+    if (bvh.nodes.empty())
+        return;
+    struct StackEntry {
+        int32_t child;
+        uint32_t count;
+        float t_entry;
+    };
+    StackEntry stack[BVH4_TRAVERSAL_STACK_SIZE];
+    int stack_size = 0;
+    stack[stack_size++] = StackEntry{0, 0, ray.t_min};
+
+    while (stack_size > 0) {
+        StackEntry entry = stack[--stack_size];
+        if (entry.t_entry > t_max)
+            continue;
+        if (entry.count) {
+            if (leaf_fn(uint32_t(entry.child), entry.count, t_max))
+                return;
+            continue;
+        }
+
+        const BVH4Node &node = bvh.nodes[entry.child];
+        float t_entry[4];
+        int mask = intersect_bvh4_children(node, ray, t_max, t_entry);
+        // push far children first, so the nearest one is popped next
+        int base = stack_size;
+        for (int i = 0; i < 4; ++i) {
+            if (!(mask & (1 << i)))
+                continue;
+            StackEntry child{node.child[i], node.count[i], t_entry[i]};
+            int j = stack_size++;
+            for (; j > base && stack[j - 1].t_entry < child.t_entry; --j)
+                stack[j] = stack[j - 1];
+            stack[j] = child;
+        }
+    }
+}
+
+// Moeller-Trumbore ray/triangle test, updates t_max and the barycentrics on hits
+inline bool intersect_triangle(const BVHRay &ray, const glm::vec3 &v0, const glm::vec3 &e1, const glm::vec3 &e2,
+    float &t_max, glm::vec2 &barycentrics) {
+    glm::vec3 p = glm::cross(ray.dir, e2);
+    float det = glm::dot(e1, p);
+    if (det == 0.0f)
+        return false;
+    float inv_det = 1.0f / det;
+    glm::vec3 s = ray.origin - v0;
+    float u = glm::dot(s, p) * inv_det;
+    if (u < 0.0f || u > 1.0f)
+        return false;
+    glm::vec3 q = glm::cross(s, e1);
+    float v = glm::dot(ray.dir, q) * inv_det;
+    if (v < 0.0f || u + v > 1.0f)
+        return false;
+    float t = glm::dot(e2, q) * inv_det;
+    if (!(t > ray.t_min && t < t_max))
+        return false;
+    t_max = t;
+    barycentrics = glm::vec2(u, v);
+    return true;
+}
+
+// Slab tests against the decoded bounds of all eight children, returns the mask of children entered before t_max
+inline int intersect_bvh8_children(const BVH8Node &node, const BVHRay &ray, float t_max, float t_entry[8]) {
+    // child bounds are origin + q * 2^exponent, folded into the ray parameterization
+    float scale[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        uint32_t bits = uint32_t(node.exponent[axis] + 127) << 23;
+        memcpy(&scale[axis], &bits, sizeof(float));
+    }
+    float sx = scale[0] * ray.inv_dir.x, ox = (node.origin.x - ray.origin.x) * ray.inv_dir.x;
+    float sy = scale[1] * ray.inv_dir.y, oy = (node.origin.y - ray.origin.y) * ray.inv_dir.y;
+    float sz = scale[2] * ray.inv_dir.z, oz = (node.origin.z - ray.origin.z) * ray.inv_dir.z;
+
+    float t_exit[8];
+    for (int i = 0; i < 8; ++i) {
+        float tx0 = float(node.lower_x[i]) * sx + ox;
+        float tx1 = float(node.upper_x[i]) * sx + ox;
+        float ty0 = float(node.lower_y[i]) * sy + oy;
+        float ty1 = float(node.upper_y[i]) * sy + oy;
+        float tz0 = float(node.lower_z[i]) * sz + oz;
+        float tz1 = float(node.upper_z[i]) * sz + oz;
+        float t_near = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), ray.t_min));
+        float t_far = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), t_max));
+        t_entry[i] = t_near;
+        t_exit[i] = t_far;
+    }
+    int mask = 0;
+    for (int i = 0; i < 8; ++i)
+        mask |= int(t_entry[i] <= t_exit[i] && (node.meta[i] || (node.inner_mask & (1 << i)))) << i;
+    return mask;
+}
+
+// Same contract as traverse_bvh4, leaf ranges index BVH8::primitive_indices
+template <class LeafFn>
+inline void traverse_bvh8(const BVH8 &bvh, const BVHRay &ray, float &t_max, LeafFn &&leaf_fn) {
+    if (bvh.nodes.empty())
+        return;
+    struct StackEntry {
+        uint32_t index;
+        uint32_t count; // 0 for inner nodes
+        float t_entry;
+    };
+    StackEntry stack[BVH8_TRAVERSAL_STACK_SIZE];
+    int stack_size = 0;
+    stack[stack_size++] = StackEntry{0, 0, ray.t_min};
+
+    while (stack_size > 0) {
+        StackEntry entry = stack[--stack_size];
+        if (entry.t_entry > t_max)
+            continue;
+        if (entry.count) {
+            if (leaf_fn(entry.index, entry.count, t_max))
+                return;
+            continue;
+        }
+
+        const BVH8Node &node = bvh.nodes[entry.index];
+        float t_entry[8];
+        int mask = intersect_bvh8_children(node, ray, t_max, t_entry);
+        int base = stack_size;
+        uint32_t inner_rank = 0;
+        for (int i = 0; i < 8; ++i) {
+            bool inner = (node.inner_mask & (1 << i)) != 0;
+            StackEntry child;
+            if (inner)
+                child = StackEntry{node.child_base + inner_rank++, 0, t_entry[i]};
+            else
+                child = StackEntry{node.primitive_base + (node.meta[i] & 0x1Fu), uint32_t(node.meta[i]) >> 5, t_entry[i]};
+            if (!(mask & (1 << i)))
+                continue;
+            // push far children first, so the nearest one is popped next
+            int j = stack_size++;
+            for (; j > base && stack[j - 1].t_entry < child.t_entry; --j)
+                stack[j] = stack[j - 1];
+            stack[j] = child;
+        }
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "raytrace_backend.h"
+#include "cpu_raytracer.h"
+#include "parallel.h"
+#include "error_io.h"
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+/* Data capture ray tracing on the CPU, for machines without a ray tracing
+ * capable Vulkan device. Queries are traced in parallel; hits shorten the
+ * query's t_max to the hit distance, and the number of hits is returned.
+ * Auxiliary per-hit results are not supported and raise an error when requested.
+ */
+struct CpuRaytraceBackend : RaytraceBackend {
+    CpuRaytracer raytracer;
+
+    std::string name() const override {
+        return "CPU";
+    }
+
+    void set_scene(const Scene &scene) override {
+        raytracer.set_scene(scene);
+    }
+
+    int trace_ray(RayQuery* queries, int num_queries, RaytraceResults aux_results) override {
+        // only the hit distance is reported, through the query's t_max; refuse requests for
+        // auxiliary results instead of silently leaving them unwritten
+        static_assert(std::is_trivially_copyable<RaytraceResults>::value, "auxiliary results are compared bytewise");
+        RaytraceResults no_results = {};
+        if (std::memcmp(&aux_results, &no_results, sizeof(no_results)) != 0)
+            throw_error("The %s ray tracing backend does not provide auxiliary ray tracing results", name().c_str());
+        std::atomic<int> num_hits(0);
+        parallel_for_ranges(0, num_queries, 256, [&](index_t begin, index_t end, int) {
+            int range_hits = 0;
+            for (index_t i = begin; i < end; ++i) {
+                RayQuery &query = queries[i];
+                CpuRayHit hit = raytracer.trace_ray(query.origin, query.dir, query.t_max);
+                if (hit.hit()) {
+                    query.t_max = hit.t;
+                    ++range_hits;
+                }
+            }
+            num_hits += range_hits;
+        });
+        return num_hits;
+    }
+};
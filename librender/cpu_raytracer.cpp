@@ -0,0 +1,242 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "cpu_raytracer.h"
+#include "scene.h"
+#include "parallel.h"
+#include "profiling.h"
+#include <algorithm>
+
+namespace {
+
+// meshes with more triangles are built one after another, with parallel binning inside
+const int LARGE_MESH_TRIANGLES = 256 * 1024;
+
+// decodes a triangle straight from the quantized geometry, see DEQUANTIZE_POSITION
+inline glm::vec3 dequantize_position(uint64_t v, const Geometry &geom) {
+    glm::vec3 lanes(float(uint32_t(v) & 0x1FFFFF), float(uint32_t(v >> 21) & 0x1FFFFF), float(uint32_t(v >> 42) & 0x1FFFFF));
+    return lanes * geom.quantized_scaling + geom.quantized_offset;
+}
+
+inline void fetch_triangle(const Geometry &geom, uint32_t tri_idx, glm::vec3 &a, glm::vec3 &b, glm::vec3 &c) {
+    glm::uvec3 indices = (geom.format_flags & Geometry::ImplicitIndices)
+        ? glm::uvec3(tri_idx * 3, tri_idx * 3 + 1, tri_idx * 3 + 2)
+        : geom.indices.data()[tri_idx];
+    if (geom.format_flags & Geometry::QuantizedPositions) {
+        const uint64_t *vertices = geom.vertices.as_range<uint64_t>().first;
+        a = dequantize_position(vertices[indices.x], geom);
+        b = dequantize_position(vertices[indices.y], geom);
+        c = dequantize_position(vertices[indices.z], geom);
+    } else {
+        const glm::vec3 *vertices = geom.vertices.as_range<glm::vec3>().first;
+        a = vertices[indices.x];
+        b = vertices[indices.y];
+        c = vertices[indices.z];
+    }
+}
+
+} // namespace
+
+void CpuRaytracer::set_scene(const Scene &scene, uint32_t animation_frame) {
+    BasicProfilingScope build_timer;
+    _stats = CpuRaytracerStats();
+
+    // mesh BVHs are only kept across calls for the same scene
+    if (_unique_scene_id != scene.unqiue_id)
+        _meshes.clear();
+    _unique_scene_id = scene.unqiue_id;
+    _meshes.resize(scene.meshes.size());
+
+    std::vector<int> large_meshes, small_meshes;
+    for (int i = 0; i < ilen(scene.meshes); ++i) {
+        if (_meshes[i].revision == scene.meshes[i].model_vertex_revision())
+            continue;
+        if (scene.meshes[i].num_tris() >= LARGE_MESH_TRIANGLES)
+            large_meshes.push_back(i);
+        else
+            small_meshes.push_back(i);
+    }
+    _stats.rebuilt_meshes = ilen(large_meshes) + ilen(small_meshes);
+
+    auto build_mesh = [&](int mesh_id, int) {
+        const Mesh &mesh = scene.meshes[mesh_id];
+        MeshBVH &mesh_bvh = _meshes[mesh_id];
+        bool compressed = _layout == CpuBVHLayout::Compressed;
+
+        std::vector<Triangle> triangles(compressed ? 0 : mesh.num_tris());
+        std::vector<TriangleRef> triangle_refs(compressed ? mesh.num_tris() : 0);
+        std::vector<AABB> triangle_bounds(mesh.num_tris());
+        index_t triangle_offset = 0;
+        for (int geometry_id = 0; geometry_id < mesh.num_geometries(); ++geometry_id) {
+            const Geometry &geom = mesh.geometries[geometry_id];
+            parallel_for(0, geom.num_tris(), 4096, [&](index_t tri_idx, int) {
+                glm::vec3 a, b, c;
+                geom.tri_positions(int(tri_idx), a, b, c);
+                if (compressed)
+                    triangle_refs[triangle_offset + tri_idx] = TriangleRef{uint32_t(geometry_id), uint32_t(tri_idx)};
+                else
+                    triangles[triangle_offset + tri_idx] = Triangle{a, b - a, c - a, geometry_id, int32_t(tri_idx)};
+                AABB &box = triangle_bounds[triangle_offset + tri_idx];
+                box += a;
+                box += b;
+                box += c;
+            });
+            triangle_offset += geom.num_tris();
+        }
+
+        // reorder the triangles to the leaf order, so leaves reference them directly
+        if (compressed) {
+            mesh_bvh.compressed_bvh = build_bvh8(triangle_bounds.data(), triangle_bounds.size());
+            mesh_bvh.triangle_refs.resize(triangle_refs.size());
+            for (size_t i = 0; i < triangle_refs.size(); ++i)
+                mesh_bvh.triangle_refs[i] = triangle_refs[mesh_bvh.compressed_bvh.primitive_indices[i]];
+            mesh_bvh.compressed_bvh.primitive_indices = std::vector<uint32_t>();
+            mesh_bvh.bounds = mesh_bvh.compressed_bvh.bounds;
+        } else {
+            mesh_bvh.bvh = build_bvh4(triangle_bounds.data(), triangle_bounds.size());
+            mesh_bvh.triangles.resize(triangles.size());
+            for (size_t i = 0; i < triangles.size(); ++i)
+                mesh_bvh.triangles[i] = triangles[mesh_bvh.bvh.primitive_indices[i]];
+            mesh_bvh.bvh.primitive_indices = std::vector<uint32_t>();
+            mesh_bvh.bounds = mesh_bvh.bvh.bounds;
+        }
+        mesh_bvh.revision = mesh.model_vertex_revision();
+    };
+    for (int mesh_id : large_meshes)
+        build_mesh(mesh_id, 0);
+    // largest first for better load balancing
+    std::sort(small_meshes.begin(), small_meshes.end(), [&](int a, int b) {
+        return scene.meshes[a].num_tris() > scene.meshes[b].num_tris();
+    });
+    parallel_for(0, ilen(small_meshes), 1, [&](index_t i, int thread_idx) {
+        build_mesh(small_meshes[i], thread_idx);
+    });
+    // the compressed layout keeps its own references to the geometry buffers, which may be
+    // shared across meshes, so the non-atomic reference counts are only touched here
+    if (_layout == CpuBVHLayout::Compressed) {
+        for (auto mesh_ids : { &large_meshes, &small_meshes })
+            for (int mesh_id : *mesh_ids)
+                _meshes[mesh_id].geometries = scene.meshes[mesh_id].geometries;
+    }
+
+    // top level over the world-space bounds of all instances
+    std::vector<InstanceBVH> instances(scene.instances.size());
+    std::vector<AABB> instance_bounds(scene.instances.size());
+    parallel_for(0, ilen(scene.instances), 1024, [&](index_t i, int) {
+        const Instance &inst = scene.instances[i];
+        const AnimationData &anim = scene.animation_data[inst.animation_data_index];
+        uint32_t frame = anim.numFrames ? std::min(animation_frame, uint32_t(anim.numFrames - 1)) : 0;
+        glm::mat4 transform = anim.dequantize(inst.transform_index, frame);
+        int mesh_id = scene.parameterized_meshes[inst.parameterized_mesh_id].mesh_id;
+        instances[i].world_to_object = glm::inverse(transform);
+        instances[i].mesh_id = mesh_id;
+        if (!_meshes[mesh_id].bounds.empty())
+            instance_bounds[i] = _meshes[mesh_id].bounds.transformed(transform);
+    });
+    // instances of empty meshes are not added to the top level
+    std::vector<int32_t> instance_ids;
+    std::vector<AABB> tlas_bounds;
+    for (int i = 0; i < ilen(instances); ++i) {
+        if (instance_bounds[i].empty())
+            continue;
+        instance_ids.push_back(i);
+        tlas_bounds.push_back(instance_bounds[i]);
+    }
+
+    _tlas = build_bvh4(tlas_bounds.data(), tlas_bounds.size());
+    _instances.resize(instance_ids.size());
+    _instance_ids.resize(instance_ids.size());
+    for (size_t i = 0; i < instance_ids.size(); ++i) {
+        int32_t instance_id = instance_ids[_tlas.primitive_indices[i]];
+        _instances[i] = instances[instance_id];
+        _instance_ids[i] = instance_id;
+    }
+    _tlas.primitive_indices = std::vector<uint32_t>();
+
+    build_timer.end();
+    _stats.build_ms = build_timer.elapsedMS();
+    _stats.memory_bytes = _tlas.memory_bytes() + _instances.size() * (sizeof(InstanceBVH) + sizeof(int32_t));
+    for (auto const &mesh_bvh : _meshes) {
+        _stats.triangles += mesh_bvh.triangles.size() + mesh_bvh.triangle_refs.size();
+        _stats.memory_bytes += mesh_bvh.bvh.memory_bytes() + mesh_bvh.triangles.size() * sizeof(Triangle);
+        _stats.memory_bytes += mesh_bvh.compressed_bvh.memory_bytes() + mesh_bvh.triangle_refs.size() * sizeof(TriangleRef);
+    }
+}
+
+template <bool ANY_HIT>
+bool CpuRaytracer::trace(const glm::vec3 &origin, const glm::vec3 &dir, float &t_max, CpuRayHit *hit) const {
+    BVHRay ray(origin, dir);
+    bool found = false;
+    traverse_bvh4(_tlas, ray, t_max, [&](uint32_t first, uint32_t count, float &tlas_t_max) {
+        for (uint32_t k = first; k < first + count; ++k) {
+            const InstanceBVH &inst = _instances[k];
+            const MeshBVH &mesh_bvh = _meshes[inst.mesh_id];
+            // object-space rays keep the world-space parameterization, t is shared across levels
+            BVHRay local_ray(glm::vec3(inst.world_to_object * glm::vec4(origin, 1.0f))
+                , glm::vec3(inst.world_to_object * glm::vec4(dir, 0.0f)));
+
+            bool terminated = false;
+            auto report_hit = [&](int32_t geometry_id, int32_t primitive_id, const glm::vec2 &barycentrics) {
+                found = true;
+                if (ANY_HIT)
+                    return terminated = true;
+                hit->instance_id = _instance_ids[k];
+                hit->geometry_id = geometry_id;
+                hit->primitive_id = primitive_id;
+                hit->barycentrics = barycentrics;
+                return false;
+            };
+            if (_layout == CpuBVHLayout::Compressed) {
+                traverse_bvh8(mesh_bvh.compressed_bvh, local_ray, tlas_t_max, [&](uint32_t tri_first, uint32_t tri_count, float &blas_t_max) {
+                    for (uint32_t j = tri_first; j < tri_first + tri_count; ++j) {
+                        TriangleRef ref = mesh_bvh.triangle_refs[j];
+                        glm::vec3 a, b, c;
+                        fetch_triangle(mesh_bvh.geometries[ref.geometry_id], ref.primitive_id, a, b, c);
+                        glm::vec2 barycentrics;
+                        if (intersect_triangle(local_ray, a, b - a, c - a, blas_t_max, barycentrics)
+                            && report_hit(int32_t(ref.geometry_id), int32_t(ref.primitive_id), barycentrics))
+                            return true;
+                    }
+                    return false;
+                });
+            } else {
+                traverse_bvh4(mesh_bvh.bvh, local_ray, tlas_t_max, [&](uint32_t tri_first, uint32_t tri_count, float &blas_t_max) {
+                    for (uint32_t j = tri_first; j < tri_first + tri_count; ++j) {
+                        const Triangle &tri = mesh_bvh.triangles[j];
+                        glm::vec2 barycentrics;
+                        if (intersect_triangle(local_ray, tri.v0, tri.e1, tri.e2, blas_t_max, barycentrics)
+                            && report_hit(tri.geometry_id, tri.primitive_id, barycentrics))
+                            return true;
+                    }
+                    return false;
+                });
+            }
+            if (terminated)
+                return true;
+        }
+        return false;
+    });
+    return found;
+}
+
+CpuRayHit CpuRaytracer::trace_ray(const glm::vec3 &origin, const glm::vec3 &dir, float t_max) const {
+    CpuRayHit hit = {t_max, -1, -1, -1, glm::vec2(0.0f)};
+    trace<false>(origin, dir, hit.t, &hit);
+    return hit;
+}
+
+bool CpuRaytracer::occluded(const glm::vec3 &origin, const glm::vec3 &dir, float t_max) const {
+    return trace<true>(origin, dir, t_max, nullptr);
+}
+
+void CpuRaytracer::trace_rays(const RenderRayQuery *queries, int num_queries, CpuRayHit *hits) const {
+    parallel_for(0, num_queries, 256, [&](index_t i, int) {
+        hits[i] = trace_ray(queries[i].origin, queries[i].dir, queries[i].t_max);
+    });
+}
+
+void CpuRaytracer::trace_occlusion(const RenderRayQuery *queries, int num_queries, uint8_t *occluded) const {
+    parallel_for(0, num_queries, 256, [&](index_t i, int) {
+        occluded[i] = this->occluded(queries[i].origin, queries[i].dir, queries[i].t_max) ? 1 : 0;
+    });
+}
@@ -0,0 +1,101 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "cpu_bvh.h"
+#include "mesh.h"
+#include "render_params.glsl.h"
+
+struct Scene;
+
+enum class CpuBVHLayout {
+    Float, // 4-wide float nodes over dequantized triangles
+    Compressed, // 8-wide quantized nodes over references into the quantized geometry
+};
+
+struct CpuRayHit {
+    float t; // t_max of the query on a miss
+    int32_t instance_id; // -1 on a miss
+    int32_t geometry_id;
+    int32_t primitive_id;
+    glm::vec2 barycentrics;
+
+    bool hit() const { return instance_id >= 0; }
+};
+
+struct CpuRaytracerStats {
+    double build_ms = 0.0;
+    int rebuilt_meshes = 0;
+    uint64_t triangles = 0;
+    size_t memory_bytes = 0; // excludes the geometry buffers shared with the scene by the compressed layout
+};
+
+/* CPU ray tracer for headless tools and GPU-less machines: one BVH per mesh
+ * over the dequantized triangles, and a top-level BVH over the scene instances.
+ * Mesh BVHs are only rebuilt when the mesh vertices changed. The compressed
+ * layout decodes triangles during traversal from the quantized geometry, whose
+ * ref-counted buffers it shares with the scene, so it stays valid after the
+ * scene is destroyed.
+ */
+class CpuRaytracer {
+public:
+    explicit CpuRaytracer(CpuBVHLayout layout = CpuBVHLayout::Float)
+        : _layout(layout) {
+    }
+
+    void set_scene(const Scene &scene, uint32_t animation_frame = 0);
+
+    // closest hits for a batch of queries, traced in parallel
+    void trace_rays(const RenderRayQuery *queries, int num_queries, CpuRayHit *hits) const;
+    // any-hit visibility for a batch of queries, 1 if anything is hit before t_max
+    void trace_occlusion(const RenderRayQuery *queries, int num_queries, uint8_t *occluded) const;
+
+    CpuRayHit trace_ray(const glm::vec3 &origin, const glm::vec3 &dir, float t_max) const;
+    bool occluded(const glm::vec3 &origin, const glm::vec3 &dir, float t_max) const;
+
+    CpuBVHLayout layout() const { return _layout; }
+    const AABB &bounds() const { return _tlas.bounds; }
+    const CpuRaytracerStats &stats() const { return _stats; }
+
+private:
+    struct Triangle {
+        glm::vec3 v0, e1, e2;
+        int32_t geometry_id;
+        int32_t primitive_id;
+    };
+    struct TriangleRef {
+        uint32_t geometry_id;
+        uint32_t primitive_id;
+    };
+    struct MeshBVH {
+        // float layout
+        BVH4 bvh;
+        std::vector<Triangle> triangles; // in leaf order
+        // compressed layout
+        BVH8 compressed_bvh;
+        std::vector<TriangleRef> triangle_refs; // in leaf order
+        std::vector<Geometry> geometries; // shares the vertex and index buffers of the scene mesh
+
+        AABB bounds;
+        unsigned revision = ~0u;
+    };
+    struct InstanceBVH {
+        glm::mat4 world_to_object;
+        int32_t mesh_id;
+    };
+
+    template <bool ANY_HIT>
+    bool trace(const glm::vec3 &origin, const glm::vec3 &dir, float &t_max, CpuRayHit *hit) const;
+
+    CpuBVHLayout _layout;
+    unsigned _unique_scene_id = 0;
+    std::vector<MeshBVH> _meshes;
+    std::vector<InstanceBVH> _instances; // in leaf order of the top-level BVH
+    std::vector<int32_t> _instance_ids;
+    BVH4 _tlas;
+    CpuRaytracerStats _stats;
+};
@@ -0,0 +1,77 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "instance_animation.h"
+#include "scene.h"
+#include "parallel.h"
+#include "types.h"
+#include <cstring>
+
+void InstanceAnimation::initialize(Scene const& scene, double time) {
+    animation_data = scene.animation_data;
+    playback.assign(animation_data.size(), PlaybackState{});
+
+    transforms.resize(scene.instances.size());
+    animated_instances.clear();
+    instances.clear();
+    for (int i = 0, ie = ilen(scene.instances); i < ie; ++i) {
+        auto const& inst = scene.instances[i];
+        if (animation_data.at(inst.animation_data_index).is_animated(inst.transform_index)) {
+            animated_instances.push_back(uint32_t(i));
+            instances.push_back(inst);
+        }
+    }
+    moved.resize(animated_instances.size());
+
+    parallel_for(0, index_t(scene.instances.size()), 1024, [&](index_t i, int) {
+        auto const& inst = scene.instances[i];
+        transforms[i] = animation_data[inst.animation_data_index].transform_at(inst.transform_index, time, interpolate);
+    });
+    for (int a = 0, ae = ilen(animation_data); a < ae; ++a) {
+        playback[a].frame = animation_data[a].frame_at(time, playback[a].blend);
+        if (!interpolate)
+            playback[a].blend = 0.0f;
+    }
+    moved_instances.clear();
+}
+
+bool InstanceAnimation::update(double time) {
+    moved_instances.clear();
+    if (animated_instances.empty())
+        return false;
+
+    // all instances of one animation data advance in lockstep, skip the ones whose frame did not change
+    std::vector<char> advanced(animation_data.size(), 0);
+    bool any_advanced = false;
+    for (int a = 0, ae = ilen(animation_data); a < ae; ++a) {
+        PlaybackState state;
+        state.frame = animation_data[a].frame_at(time, state.blend);
+        if (!interpolate)
+            state.blend = 0.0f;
+        if (state.frame == playback[a].frame && state.blend == playback[a].blend)
+            continue;
+        playback[a] = state;
+        advanced[a] = 1;
+        any_advanced = true;
+    }
+    if (!any_advanced)
+        return false;
+
+    parallel_for(0, index_t(animated_instances.size()), 1024, [&](index_t k, int) {
+        auto const& inst = instances[k];
+        if (!advanced[inst.animation_data_index]) {
+            moved[k] = 0;
+            return;
+        }
+        glm::mat4 transform = animation_data[inst.animation_data_index].transform_at(inst.transform_index, time, interpolate);
+        glm::mat4& current = transforms[animated_instances[k]];
+        // instances holding still on their animation track are not reported
+        moved[k] = std::memcmp(&transform, &current, sizeof(transform)) != 0;
+        current = transform;
+    });
+
+    for (size_t k = 0, ke = animated_instances.size(); k < ke; ++k)
+        if (moved[k])
+            moved_instances.push_back(animated_instances[k]);
+    return !moved_instances.empty();
+}
@@ -0,0 +1,41 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "mesh.h"
+
+struct Scene;
+struct AnimationData;
+
+/* Plays back the animated instance transforms of a scene. Keeps the current
+ * world transform of every instance and, on each update, the list of instances
+ * that actually moved, so that backends only re-upload those and refit their
+ * top-level acceleration structures instead of rebuilding them.
+ * The quantized transforms are shared with the scene, which may be released.
+ */
+struct InstanceAnimation {
+    bool interpolate = true; // blend between animation frames instead of stepping
+
+    std::vector<glm::mat4> transforms; // world transform per scene instance
+    std::vector<uint32_t> animated_instances; // instances with animated transforms
+    std::vector<uint32_t> moved_instances; // moved by the last update, ascending
+
+    void initialize(Scene const& scene, double time = 0.0);
+    bool has_animation() const { return !animated_instances.empty(); }
+    // re-evaluates animated instances at the given time, returns true if any moved
+    bool update(double time);
+
+private:
+    struct PlaybackState {
+        uint32_t frame = ~0u;
+        float blend = 0.0f;
+    };
+    std::vector<AnimationData> animation_data;
+    std::vector<PlaybackState> playback; // per animation data
+    std::vector<Instance> instances; // same order as animated_instances
+    std::vector<uint8_t> moved;
+};
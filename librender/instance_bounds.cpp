@@ -0,0 +1,128 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "instance_bounds.h"
+#include "scene.h"
+#include "parallel.h"
+#include "types.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr int BOUNDS_LANES = 8;
+
+/* Arvo's method in center/extent form: the world center is the transformed
+ * local center, the world half extent the local half extent transformed by the
+ * absolute linear part. The lane loops have a fixed trip count and no branches,
+ * so that they map to vector instructions; gather and scatter stay scalar.
+ */
+void transform_block(InstanceBounds &ib, glm::mat4 const* transforms, uint32_t const* instance_ids, index_t begin, index_t end) {
+    for (index_t block = begin; block < end; block += BOUNDS_LANES) {
+        int n = int(std::min(index_t(BOUNDS_LANES), end - block));
+
+        uint32_t ids[BOUNDS_LANES];
+        float m[12][BOUNDS_LANES]; // column-major 3x4
+        float c[3][BOUNDS_LANES], e[3][BOUNDS_LANES];
+        bool valid[BOUNDS_LANES];
+        for (int l = 0; l < BOUNDS_LANES; ++l) {
+            ids[l] = l < n ? (instance_ids ? instance_ids[block + l] : uint32_t(block + l)) : 0;
+            AABB const& box = ib.local_bounds[ib.parameterized_mesh_ids[ids[l]]];
+            valid[l] = l < n && !box.empty();
+            glm::vec3 center = valid[l] ? box.center() : glm::vec3(0.0f);
+            glm::vec3 half_extent = valid[l] ? 0.5f * box.extent() : glm::vec3(0.0f);
+            glm::mat4 const& t = transforms[ids[l]];
+            for (int col = 0; col < 4; ++col)
+                for (int row = 0; row < 3; ++row)
+                    m[col * 3 + row][l] = t[col][row];
+            for (int axis = 0; axis < 3; ++axis) {
+                c[axis][l] = center[axis];
+                e[axis][l] = half_extent[axis];
+            }
+        }
+
+        float wc[3][BOUNDS_LANES], we[3][BOUNDS_LANES];
+        for (int row = 0; row < 3; ++row) {
+            for (int l = 0; l < BOUNDS_LANES; ++l) {
+                wc[row][l] = m[row][l] * c[0][l] + m[3 + row][l] * c[1][l] + m[6 + row][l] * c[2][l] + m[9 + row][l];
+                we[row][l] = std::abs(m[row][l]) * e[0][l] + std::abs(m[3 + row][l]) * e[1][l] + std::abs(m[6 + row][l]) * e[2][l];
+            }
+        }
+
+        float* lower[3] = { ib.lower_x.data(), ib.lower_y.data(), ib.lower_z.data() };
+        float* upper[3] = { ib.upper_x.data(), ib.upper_y.data(), ib.upper_z.data() };
+        for (int l = 0; l < n; ++l) {
+            for (int axis = 0; axis < 3; ++axis) {
+                lower[axis][ids[l]] = valid[l] ? wc[axis][l] - we[axis][l] : FLT_MAX;
+                upper[axis][ids[l]] = valid[l] ? wc[axis][l] + we[axis][l] : -FLT_MAX;
+            }
+        }
+    }
+}
+
+} // namespace
+
+void InstanceBounds::initialize(Scene const& scene) {
+    const int num_pmeshes = ilen(scene.parameterized_meshes);
+    std::vector<AABB> mesh_bounds(scene.meshes.size());
+    parallel_for(0, ilen(scene.meshes), 64, [&](index_t i, int) {
+        auto const& mesh = scene.meshes[i];
+        if (mesh.has_current_bounds()) {
+            mesh_bounds[i] = mesh.bounds.box;
+            return;
+        }
+        for (auto const& geom : mesh.geometries)
+            mesh_bounds[i] += AABB(geom.base, geom.base + geom.extent);
+    });
+
+    local_bounds.assign(num_pmeshes, AABB());
+    for (int i = 0; i < num_pmeshes; ++i) {
+        auto const& pmesh = scene.parameterized_meshes[i];
+        local_bounds[i] = mesh_bounds[pmesh.mesh_id];
+        // instances reference the leading parameterized mesh of a LoD group
+        if (pmesh.lod_group > 0) {
+            auto const& lod_group = scene.lod_groups[pmesh.lod_group];
+            if (!lod_group.mesh_ids.empty() && lod_group.mesh_ids[0] == i) {
+                for (int lod_pmesh : lod_group.mesh_ids)
+                    local_bounds[i] += mesh_bounds[scene.parameterized_meshes[lod_pmesh].mesh_id];
+            }
+        }
+    }
+
+    const size_t num_instances = scene.instances.size();
+    parameterized_mesh_ids.resize(num_instances);
+    for (size_t i = 0; i < num_instances; ++i)
+        parameterized_mesh_ids[i] = scene.instances[i].parameterized_mesh_id;
+    for (auto* v : { &lower_x, &lower_y, &lower_z })
+        v->assign(num_instances, FLT_MAX);
+    for (auto* v : { &upper_x, &upper_y, &upper_z })
+        v->assign(num_instances, -FLT_MAX);
+}
+
+void InstanceBounds::transform(glm::mat4 const* transforms) {
+    parallel_for_ranges(0, index_t(size()), 64 * BOUNDS_LANES, [&](index_t begin, index_t end, int) {
+        transform_block(*this, transforms, nullptr, begin, end);
+    });
+}
+
+void InstanceBounds::transform(glm::mat4 const* transforms, uint32_t const* instance_ids, size_t count) {
+    parallel_for_ranges(0, index_t(count), 64 * BOUNDS_LANES, [&](index_t begin, index_t end, int) {
+        transform_block(*this, transforms, instance_ids, begin, end);
+    });
+}
+
+AABB InstanceBounds::scene_bounds() const {
+    std::vector<AABB> thread_bounds(parallel_thread_count());
+    parallel_for_ranges(0, index_t(size()), 4096, [&](index_t begin, index_t end, int thread_idx) {
+        glm::vec3 lower(FLT_MAX), upper(-FLT_MAX);
+        for (index_t i = begin; i < end; ++i) {
+            lower = glm::min(lower, glm::vec3(lower_x[i], lower_y[i], lower_z[i]));
+            upper = glm::max(upper, glm::vec3(upper_x[i], upper_y[i], upper_z[i]));
+        }
+        thread_bounds[thread_idx] += AABB(lower, upper);
+    });
+    AABB bounds;
+    for (auto const& b : thread_bounds)
+        bounds += b;
+    return bounds;
+}
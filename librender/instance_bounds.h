@@ -0,0 +1,41 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "bounds.h"
+
+struct Scene;
+
+/* World-space bounds of all scene instances. The object-space bounds are cached
+ * per parameterized mesh (the leading mesh of a LoD group bounds the whole
+ * group), so updating instances only transforms one box each. Results are
+ * stored per axis (SoA) and computed in blocks of lanes that the compiler
+ * vectorizes, in parallel over instances.
+ */
+struct InstanceBounds {
+    std::vector<AABB> local_bounds; // per parameterized mesh
+    std::vector<int32_t> parameterized_mesh_ids; // per instance
+    // world-space bounds per instance, empty boxes for instances of empty meshes
+    std::vector<float> lower_x, lower_y, lower_z;
+    std::vector<float> upper_x, upper_y, upper_z;
+
+    // caches the object-space bounds, uses current mesh bounds or the geometry quantization boxes
+    void initialize(Scene const& scene);
+    // transforms the bounds of all instances, transforms are indexed by instance
+    void transform(glm::mat4 const* transforms);
+    // only updates the given instances, e.g. those moved by an InstanceAnimation update
+    void transform(glm::mat4 const* transforms, uint32_t const* instance_ids, size_t count);
+
+    size_t size() const { return parameterized_mesh_ids.size(); }
+    AABB bounds(size_t instance) const {
+        return AABB(glm::vec3(lower_x[instance], lower_y[instance], lower_z[instance])
+            , glm::vec3(upper_x[instance], upper_y[instance], upper_z[instance]));
+    }
+    // union of all instance bounds
+    AABB scene_bounds() const;
+};
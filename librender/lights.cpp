@@ -9,9 +9,11 @@
 #include "compute_util.h"
 #include "types.h"
 #include "error_io.h"
+#include "parallel.h"
 #include <algorithm>
+#include <numeric>
 
-std::vector<TriLight> collect_emitters(Scene const& scene) {
+std::vector<TriLight> collect_emitters(Scene const& scene, double time) {
     std::vector<char> pmesh_nonemissive(scene.parameterized_meshes.size());
     std::vector<TriLight> emitters;
     for (auto& i : scene.instances) {
@@ -19,8 +21,7 @@ std::vector<TriLight> collect_emitters(Scene const& scene) {
             continue;
         auto& pm = scene.parameterized_meshes[i.parameterized_mesh_id];
         const auto &animData = scene.animation_data.at(i.animation_data_index);
-        constexpr uint32_t frame = 0;
-        const glm::mat4 transform = animData.dequantize(i.transform_index, frame);
+        const glm::mat4 transform = animData.dequantize(i.transform_index, animData.frame_at(time));
         auto next = collect_emitters(transform, pm, scene.meshes[pm.mesh_id], scene.materials);
         if (!next.empty())
             emitters.insert(emitters.begin(), next.begin(), next.end());
@@ -79,16 +80,136 @@ void update_light_sampling(BinnedLightSampling& binned, std::vector<TriLight> co
         invalidated) {
         binned.radiances = estimate_normalized_radiance(nullptr, emitters, params.min_perceived_receiver_dist);
         binned.emitters = emitters;
+        binned.source_indices.resize(emitters.size());
+        std::iota(binned.source_indices.begin(), binned.source_indices.end(), 0u);
         if (params.min_radiance > 0.0f)
-            trim_dim_emitters(binned.emitters, binned.radiances, params.min_radiance);
+            trim_dim_emitters(binned.emitters, binned.radiances, params.min_radiance, &binned.source_indices);
+        binned.source_scales.assign(binned.emitters.size(), 1.0f);
         invalidated = true;
     }
     if (binned.params.bin_size != params.bin_size || invalidated) {
-        equalize_emitter_bins(binned.emitters, binned.radiances, params.bin_size);
+        equalize_emitter_bins(binned.emitters, binned.radiances, params.bin_size, &binned.source_indices, &binned.source_scales);
     }
     binned.params = params;
 }
 
+// refit binned emitters to moved or toggled source emitters without re-binning
+void refit_light_sampling(BinnedLightSampling& binned, std::vector<TriLight> const& emitters, std::vector<uint32_t> const& changed_emitters, std::vector<glm::uvec2>& dirty_ranges) {
+    dirty_ranges.clear();
+    if (changed_emitters.empty() || binned.emitters.empty())
+        return;
+
+    std::vector<char> source_changed(emitters.size());
+    for (uint32_t src : changed_emitters)
+        source_changed[src] = 1;
+
+    // note: normalized radiances only depend on triangle shape and remain valid under rigid motion
+    int binned_count = ilen(binned.emitters);
+    std::vector<char> binned_changed(binned_count);
+    parallel_for(0, binned_count, 1024, [&](index_t i, int) {
+        uint32_t src = binned.source_indices[i];
+        if (!source_changed[src])
+            return;
+        TriLight light = emitters[src];
+        light.radiance *= binned.source_scales[i];
+        binned.emitters[i] = light;
+        binned_changed[i] = 1;
+    });
+
+    // merge nearby changes to limit the number of copy regions
+    int const merge_gap = 64;
+    for (int i = 0; i < binned_count; ++i) {
+        if (!binned_changed[i])
+            continue;
+        if (!dirty_ranges.empty() && int(dirty_ranges.back().y) + merge_gap >= i)
+            dirty_ranges.back().y = uint32_t(i + 1);
+        else
+            dirty_ranges.push_back(glm::uvec2(i, i + 1));
+    }
+}
+
+void DynamicEmitters::initialize(Scene const& scene, double time) {
+    ranges.clear();
+    local_emitters.clear();
+    changed_emitters.clear();
+
+    std::vector<char> pmesh_nonemissive(scene.parameterized_meshes.size());
+    for (uint32_t instance_id = 0, ie = uint_bound(scene.instances.size()); instance_id < ie; ++instance_id) {
+        auto& i = scene.instances[instance_id];
+        if (pmesh_nonemissive[i.parameterized_mesh_id])
+            continue;
+        auto& pm = scene.parameterized_meshes[i.parameterized_mesh_id];
+        auto local = collect_emitters(glm::mat4(1.0f), pm, scene.meshes[pm.mesh_id], scene.materials);
+        if (local.empty()) {
+            pmesh_nonemissive[i.parameterized_mesh_id] = 1; // skip next time
+            continue;
+        }
+        auto const& animData = scene.animation_data.at(i.animation_data_index);
+        InstanceRange range;
+        range.instance_id = instance_id;
+        range.first_emitter = uint_bound(local_emitters.size());
+        range.emitter_count = uint_bound(local.size());
+        range.animated = animData.is_animated(i.transform_index);
+        range.frame = range.animated ? animData.frame_at(time) : 0;
+        ranges.push_back(range);
+        local_emitters.insert(local_emitters.end(), local.begin(), local.end());
+    }
+
+    emitters.resize(local_emitters.size());
+    for (int r = 0, re = ilen(ranges); r < re; ++r) {
+        auto& i = scene.instances[ranges[r].instance_id];
+        set_transform(r, scene.animation_data.at(i.animation_data_index).dequantize(i.transform_index, ranges[r].frame));
+    }
+    changed_emitters.clear();
+}
+
+bool DynamicEmitters::has_animated_emitters() const {
+    for (auto& range : ranges)
+        if (range.animated)
+            return true;
+    return false;
+}
+
+void DynamicEmitters::update(Scene const& scene, double time) {
+    for (int r = 0, re = ilen(ranges); r < re; ++r) {
+        auto& range = ranges[r];
+        if (!range.animated)
+            continue;
+        auto& i = scene.instances[range.instance_id];
+        auto const& animData = scene.animation_data.at(i.animation_data_index);
+        uint32_t frame = animData.frame_at(time);
+        if (frame == range.frame)
+            continue;
+        range.frame = frame;
+        set_transform(r, animData.dequantize(i.transform_index, frame));
+    }
+}
+
+void DynamicEmitters::set_transform(int range_idx, glm::mat4 const& transform) {
+    auto const& range = ranges[range_idx];
+    glm::vec3 radiance_scale = glm::vec3(range.enabled ? 1.0f : 0.0f);
+    for (uint32_t e = range.first_emitter, ee = e + range.emitter_count; e < ee; ++e) {
+        TriLight const& local = local_emitters[e];
+        TriLight& light = emitters[e];
+        light.v0 = glm::vec3(transform * glm::vec4(local.v0, 1.0f));
+        light.v1 = glm::vec3(transform * glm::vec4(local.v1, 1.0f));
+        light.v2 = glm::vec3(transform * glm::vec4(local.v2, 1.0f));
+        light.radiance = local.radiance * radiance_scale;
+        changed_emitters.push_back(e);
+    }
+}
+
+void DynamicEmitters::set_enabled(int range_idx, bool enabled) {
+    auto& range = ranges[range_idx];
+    if (range.enabled == enabled)
+        return;
+    range.enabled = enabled;
+    for (uint32_t e = range.first_emitter, ee = e + range.emitter_count; e < ee; ++e) {
+        emitters[e].radiance = enabled ? local_emitters[e].radiance : glm::vec3(0.0f);
+        changed_emitters.push_back(e);
+    }
+}
+
 namespace glsl { namespace {
 
 // "BRDF Importance Sampling for Polygonal Lights"
@@ -199,7 +320,8 @@ std::vector<float> estimate_normalized_radiance(Scene const* scene, std::vector<
 }
 
 // remove short-range emitters that contribute no noticeable light outside their local environment (depends on camera exposure)
-void trim_dim_emitters(std::vector<TriLight>& emitters, std::vector<float> &radiances, float min_radiance) {
+void trim_dim_emitters(std::vector<TriLight>& emitters, std::vector<float> &radiances, float min_radiance
+    , std::vector<uint32_t>* source_indices) {
     size_t newCount = 0;
 
     for (size_t i = 0, ie = emitters.size(); i < ie; ++i) {
@@ -207,6 +329,8 @@ void trim_dim_emitters(std::vector<TriLight>& emitters, std::vector<float> &radi
             if (i != newCount) {
                 emitters[newCount] = emitters[i];
                 radiances[newCount] = radiances[i];
+                if (source_indices)
+                    (*source_indices)[newCount] = (*source_indices)[i];
             }
             ++newCount;
         }
@@ -214,10 +338,13 @@ void trim_dim_emitters(std::vector<TriLight>& emitters, std::vector<float> &radi
 
     emitters.resize(newCount);
     radiances.resize(newCount);
+    if (source_indices)
+        source_indices->resize(newCount);
 }
 
 // partition emitters into approx. equal-weight bins for importance sampling
-void equalize_emitter_bins(std::vector<TriLight>& emitters, std::vector<float> &radiances, int bin_size) {
+void equalize_emitter_bins(std::vector<TriLight>& emitters, std::vector<float> &radiances, int bin_size
+    , std::vector<uint32_t>* source_indices, std::vector<float>* source_scales) {
     if (bin_size <= 1 || radiances.empty())
         return;
 
@@ -339,15 +466,121 @@ void equalize_emitter_bins(std::vector<TriLight>& emitters, std::vector<float> &
         , (int) bins.size(), (int) emitters.size());
 
     std::vector<TriLight> reordered_emitters(bins.size());
+    std::vector<uint32_t> reordered_indices(source_indices ? bins.size() : 0);
+    std::vector<float> reordered_scales(source_scales ? bins.size() : 0);
     radiances.resize(bins.size());
     for (int i = 0, ie = ilen(bins); i < ie; ++i) {
         radiances[i] = bins[i].radiance;
         reordered_emitters[i] = emitters[bins[i].source_idx];
         reordered_emitters[i].radiance /= float(bins[i].split_count);
+        if (source_indices)
+            reordered_indices[i] = (*source_indices)[bins[i].source_idx];
+        if (source_scales)
+            reordered_scales[i] = (*source_scales)[bins[i].source_idx] / float(bins[i].split_count);
     }
     emitters = std::move(reordered_emitters);
+    if (source_indices)
+        *source_indices = std::move(reordered_indices);
+    if (source_scales)
+        *source_scales = std::move(reordered_scales);
 }
 
 int BinnedLightSampling::bin_count() const {
     return int(emitters.size() + (params.bin_size - 1)) / params.bin_size;
 }
+
+size_t LightGrid::size_in_bytes() const {
+    return cells.size() * sizeof(LightGridCell) + entries.size() * sizeof(LightGridEntry);
+}
+
+// build per-cell importance-weighted lists over the given (binned) emitters and their normalized radiances
+void update_light_grid(LightGrid& grid, std::vector<TriLight> const& emitters, std::vector<float> const& radiances, AABB const& bounds, LightGridConfig const& config) {
+    int lights_per_cell = std::max(std::min(config.lights_per_cell, LIGHT_GRID_MAX_CELL_LIGHTS), 1);
+
+    glm::vec3 extent = bounds.empty() ? glm::vec3(1.0f) : glm::max(bounds.extent(), glm::vec3(1.e-6f));
+    float cell_size = std::max(extent.x, std::max(extent.y, extent.z)) / float(std::max(config.max_resolution, 1));
+    glm::ivec3 resolution = glm::max(glm::ivec3(glm::ceil(extent / cell_size)), glm::ivec3(1));
+    glm::vec3 cell_extent = extent / glm::vec3(resolution);
+
+    grid.params.lower = bounds.empty() ? glm::vec3(0.0f) : bounds.lower;
+    grid.params.inv_cell_extent = 1.0f / cell_extent;
+    grid.params.resolution = resolution;
+    // lights missing from a cell list are only reachable through global selection, keep it unbiased
+    grid.params.global_fraction = glm::clamp(config.global_fraction, 1.e-3f, 1.0f);
+    grid.params.cell_count = resolution.x * resolution.y * resolution.z;
+
+    // precompute emitter centroids and (unnormalized) normals
+    struct EmitterInfo {
+        glm::vec3 center;
+        glm::vec3 n;
+    };
+    std::vector<EmitterInfo> infos(emitters.size());
+    for (size_t i = 0, ie = emitters.size(); i < ie; ++i) {
+        auto const& light = emitters[i];
+        infos[i].center = (light.v0 + light.v1 + light.v2) / 3.0f;
+        infos[i].n = cross(light.v1 - light.v0, light.v2 - light.v0);
+    }
+
+    // each cell writes into its own fixed-size slot, compacted afterwards
+    int cell_count = grid.params.cell_count;
+    grid.cells.resize(cell_count);
+    std::vector<LightGridEntry> cell_entries(size_t(cell_count) * lights_per_cell);
+
+    struct Candidate {
+        float importance;
+        uint32_t light_index;
+    };
+    std::vector<std::vector<Candidate>> thread_candidates(parallel_thread_count());
+
+    glm::vec3 half_cell = 0.5f * cell_extent;
+    float min_dist2 = dot(half_cell, half_cell);
+    parallel_for(0, cell_count, 8, [&](index_t cell_idx, int thread_idx) {
+        int x = int(cell_idx % resolution.x);
+        int y = int(cell_idx / resolution.x % resolution.y);
+        int z = int(cell_idx / (resolution.x * resolution.y));
+        glm::vec3 center = grid.params.lower + (glm::vec3(x, y, z) + 0.5f) * cell_extent;
+
+        auto& candidates = thread_candidates[thread_idx];
+        candidates.clear();
+        for (size_t i = 0, ie = emitters.size(); i < ie; ++i) {
+            auto const& info = infos[i];
+            // skip emitters facing away from the entire cell
+            if (dot(center - emitters[i].v0, info.n) + dot(glm::abs(info.n), half_cell) <= 0.0f)
+                continue;
+            glm::vec3 d = info.center - center;
+            float importance = radiances[i] / std::max(dot(d, d), min_dist2);
+            if (importance > 0.0f)
+                candidates.push_back({ importance, uint32_t(i) });
+        }
+
+        int count = std::min(ilen(candidates), lights_per_cell);
+        auto by_importance = [](Candidate const& a, Candidate const& b) { return a.importance > b.importance; };
+        std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(), by_importance);
+
+        float total = 0.0f;
+        for (int i = 0; i < count; ++i)
+            total += candidates[i].importance;
+        LightGridEntry* entries = cell_entries.data() + size_t(cell_idx) * lights_per_cell;
+        float cdf = 0.0f;
+        for (int i = 0; i < count; ++i) {
+            cdf += candidates[i].importance / total;
+            entries[i].light_index = candidates[i].light_index;
+            entries[i].cdf = cdf;
+        }
+        if (count > 0)
+            entries[count - 1].cdf = 1.0f;
+        grid.cells[cell_idx].entry_count = uint32_t(count);
+    });
+
+    uint32_t entry_count = 0;
+    for (auto& cell : grid.cells) {
+        cell.first_entry = entry_count;
+        entry_count += cell.entry_count;
+    }
+    grid.entries.resize(entry_count);
+    parallel_for(0, cell_count, 64, [&](index_t cell_idx, int) {
+        auto const& cell = grid.cells[cell_idx];
+        std::copy_n(cell_entries.data() + size_t(cell_idx) * lights_per_cell, cell.entry_count, grid.entries.data() + cell.first_entry);
+    });
+    grid.params.entry_count = int(entry_count);
+}
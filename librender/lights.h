@@ -14,19 +14,24 @@
 #include "../rendering/lights/quad.h.glsl"
 #include "../rendering/lights/point.h.glsl"
 #include "../rendering/lights/light.h.glsl"
+#include "../rendering/lights/light_grid.h.glsl"
+#include "bounds.h"
 
 struct Scene;
 struct ParameterizedMesh;
 struct Mesh;
 struct BaseMaterial;
 
-std::vector<TriLight> collect_emitters(Scene const& scene);
+std::vector<TriLight> collect_emitters(Scene const& scene, double time = 0.0);
 std::vector<TriLight> collect_emitters(glm::mat4 const& transform, ParameterizedMesh const& pm, Mesh const& mesh, std::vector<BaseMaterial> const& materials);
 
 // importance sampling tools
 struct BinnedLightSampling {
     std::vector<TriLight> emitters;
     std::vector<float> radiances;
+    // source emitter of each binned emitter, and the radiance fraction of split (cloned) emitters
+    std::vector<uint32_t> source_indices;
+    std::vector<float> source_scales;
     LightSamplingConfig params;
     BinnedLightSampling() {
         params.bin_size = 0; // mark uninitialized
@@ -34,15 +39,65 @@ struct BinnedLightSampling {
     int bin_count() const;
 };
 void update_light_sampling(BinnedLightSampling& binned, std::vector<TriLight> const& emitters, LightSamplingConfig params);
+// refit binned emitters to moved or toggled source emitters without re-binning,
+// outputs the merged [begin, end) ranges of binned emitters that changed
+void refit_light_sampling(BinnedLightSampling& binned, std::vector<TriLight> const& emitters, std::vector<uint32_t> const& changed_emitters, std::vector<glm::uvec2>& dirty_ranges);
+
+// tracks world-space emitters per instance, so that animated and toggled lights can be updated incrementally
+struct DynamicEmitters {
+    struct InstanceRange {
+        uint32_t instance_id;
+        uint32_t first_emitter;
+        uint32_t emitter_count;
+        uint32_t frame;
+        bool animated;
+        bool enabled = true;
+    };
+    std::vector<InstanceRange> ranges;
+    std::vector<TriLight> local_emitters; // object space
+    std::vector<TriLight> emitters; // world space
+    std::vector<uint32_t> changed_emitters; // accumulated until consumed by the caller
+
+    void initialize(Scene const& scene, double time = 0.0);
+    bool has_animated_emitters() const;
+    // re-transform emitters of animated instances whose animation frame changed
+    void update(Scene const& scene, double time);
+    void set_transform(int range_idx, glm::mat4 const& transform);
+    void set_enabled(int range_idx, bool enabled);
+};
+
+// spatial light lists: each grid cell references the emitters that matter most inside it
+struct LightGridConfig {
+    int max_resolution = 16; // cells along the longest axis of the bounds
+    int lights_per_cell = LIGHT_GRID_MAX_CELL_LIGHTS;
+    float global_fraction = 0.25f;
+};
+struct LightGrid {
+    LightGridParams params;
+    std::vector<LightGridCell> cells;
+    std::vector<LightGridEntry> entries;
+    LightGrid() {
+        params.cell_count = 0; // mark uninitialized
+    }
+    size_t size_in_bytes() const;
+};
+// build per-cell importance-weighted lists over the given (binned) emitters and their normalized radiances
+void update_light_grid(LightGrid& grid, std::vector<TriLight> const& emitters, std::vector<float> const& radiances, AABB const& bounds, LightGridConfig const& config);
 
 struct LightSamplingSetup {
     std::vector<TriLight> emitters;
     BinnedLightSampling binned;
+    DynamicEmitters dynamic;
+    AABB scene_bounds;
+    LightGridConfig grid_config;
+    LightGrid grid;
 };
 
 // compute representative radiance value based on closest shading points to light source where variance is still visibly perceived (depends on viewer scale)
 std::vector<float> estimate_normalized_radiance(Scene const* scene, std::vector<TriLight> const& emitters, float min_perceived_receiver_dist);
 // remove short-range emitters that contribute no noticeable light outside their local environment (depends on camera exposure)
-void trim_dim_emitters(std::vector<TriLight>& emitters, std::vector<float> &radiances, float min_radiance);
+void trim_dim_emitters(std::vector<TriLight>& emitters, std::vector<float> &radiances, float min_radiance
+    , std::vector<uint32_t>* source_indices = nullptr);
 // partition emitters into approx. equal-weight bins for importance sampling
-void equalize_emitter_bins(std::vector<TriLight>& emitters, std::vector<float> &radiances, int bin_size);
+void equalize_emitter_bins(std::vector<TriLight>& emitters, std::vector<float> &radiances, int bin_size
+    , std::vector<uint32_t>* source_indices = nullptr, std::vector<float>* source_scales = nullptr);
@@ -0,0 +1,371 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "lod_generation.h"
+#include "scene.h"
+#include "error_io.h"
+#include "parallel.h"
+#include "profiling.h"
+#include "util.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#ifdef ENABLE_LOD_GENERATION
+#include <meshoptimizer.h>
+#endif
+
+bool lod_generation_available() {
+#ifdef ENABLE_LOD_GENERATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef ENABLE_LOD_GENERATION
+namespace {
+
+// bump whenever the simplification or the cache layout changes
+constexpr uint32_t LOD_CACHE_VERSION = 1;
+constexpr char LOD_CACHE_MAGIC[8] = { 'R', 'P', 'T', 'R', 'L', 'O', 'D', '\0' };
+
+// quantized position and normal/uv pair of a triangle corner, the unit of vertex welding
+struct QuantizedCorner {
+    uint64_t position;
+    uint64_t normal_uv;
+};
+
+struct GeneratedGeometry {
+    std::vector<uint64_t> positions; // unrolled, 3 per triangle
+    std::vector<uint64_t> normals_uvs;
+};
+
+struct GeneratedLevel {
+    float detail_reduction = 0.0f;
+    std::vector<GeneratedGeometry> geometries;
+
+    uint64_t num_tris() const {
+        uint64_t n = 0;
+        for (auto const& g : geometries)
+            n += g.positions.size() / 3;
+        return n;
+    }
+};
+
+struct GeneratedLoDs {
+    std::vector<GeneratedLevel> levels;
+    bool from_cache = false;
+};
+
+bool is_lod_candidate(Mesh const& mesh, LoDGenerationParams const& params) {
+    if (mesh.flags & (Mesh::Dynamic | Mesh::SubtlyDynamic) || !mesh.mesh_shader_names.empty())
+        return false;
+    if (mesh.geometries.empty() || uint64_t(mesh.num_tris()) < params.min_triangles)
+        return false;
+    uint32_t const required_flags = Geometry::QuantizedPositions | Geometry::QuantizedNormalsAndUV;
+    for (auto const& geom : mesh.geometries) {
+        if ((geom.format_flags & required_flags) != required_flags)
+            return false;
+        if (geom.normals.count<uint64_t>() != geom.vertices.count<uint64_t>())
+            return false;
+    }
+    return true;
+}
+
+std::string lod_cache_key(Mesh const& mesh, LoDGenerationParams const& params) {
+    std::string digests;
+    for (auto const& geom : mesh.geometries) {
+        digests += sha1_hash((char const*) geom.vertices.bytes(), geom.vertices.nbytes());
+        digests += sha1_hash((char const*) geom.normals.bytes(), geom.normals.nbytes());
+        if (!(geom.format_flags & Geometry::ImplicitIndices))
+            digests += sha1_hash((char const*) geom.indices.bytes(), geom.indices.nbytes());
+        char geom_params[128];
+        snprintf(geom_params, sizeof(geom_params), "%x;%a,%a,%a;%a,%a,%a;"
+            , geom.format_flags
+            , geom.quantized_scaling.x, geom.quantized_scaling.y, geom.quantized_scaling.z
+            , geom.quantized_offset.x, geom.quantized_offset.y, geom.quantized_offset.z);
+        digests += geom_params;
+    }
+    char settings[128];
+    snprintf(settings, sizeof(settings), "v%u;%d;%a;%a", LOD_CACHE_VERSION
+        , params.max_levels, params.level_triangle_ratio, params.max_error);
+    digests += settings;
+    return sha1_hash(digests.data(), digests.size());
+}
+
+bool read_lod_cache(std::string const& file, size_t num_geometries, GeneratedLoDs& lods) {
+    FILE* f = fopen(file.c_str(), "rb");
+    if (!f)
+        return false;
+    bool valid = true;
+    char magic[sizeof(LOD_CACHE_MAGIC)];
+    uint32_t header[3] = { };
+    valid = fread(magic, sizeof(magic), 1, f) == 1 && memcmp(magic, LOD_CACHE_MAGIC, sizeof(magic)) == 0
+        && fread(header, sizeof(header), 1, f) == 1
+        && header[0] == LOD_CACHE_VERSION && header[1] == num_geometries;
+    if (valid) {
+        lods.levels.resize(header[2]);
+        for (auto& level : lods.levels) {
+            level.geometries.resize(num_geometries);
+            valid &= fread(&level.detail_reduction, sizeof(float), 1, f) == 1;
+            for (auto& geom : level.geometries) {
+                uint64_t num_corners = 0;
+                valid = valid && fread(&num_corners, sizeof(num_corners), 1, f) == 1 && num_corners % 3 == 0;
+                if (!valid)
+                    break;
+                geom.positions.resize(num_corners);
+                geom.normals_uvs.resize(num_corners);
+                valid = fread(geom.positions.data(), sizeof(uint64_t), num_corners, f) == num_corners
+                    && fread(geom.normals_uvs.data(), sizeof(uint64_t), num_corners, f) == num_corners;
+            }
+            if (!valid)
+                break;
+        }
+    }
+    fclose(f);
+    if (!valid) {
+        warning("Ignoring corrupt LoD cache file %s", file.c_str());
+        lods.levels.clear();
+    }
+    return valid;
+}
+
+void write_lod_cache(std::string const& file, GeneratedLoDs const& lods) {
+    bool success = write_file_atomically(file, [&lods](FILE* f) {
+        uint32_t num_geometries = lods.levels.empty() ? 0 : uint32_t(lods.levels[0].geometries.size());
+        uint32_t header[3] = { LOD_CACHE_VERSION, num_geometries, uint32_t(lods.levels.size()) };
+        bool written = fwrite(LOD_CACHE_MAGIC, sizeof(LOD_CACHE_MAGIC), 1, f) == 1
+            && fwrite(header, sizeof(header), 1, f) == 1;
+        for (auto const& level : lods.levels) {
+            written = written && fwrite(&level.detail_reduction, sizeof(float), 1, f) == 1;
+            for (auto const& geom : level.geometries) {
+                uint64_t num_corners = geom.positions.size();
+                written = written && fwrite(&num_corners, sizeof(num_corners), 1, f) == 1
+                    && fwrite(geom.positions.data(), sizeof(uint64_t), num_corners, f) == num_corners
+                    && fwrite(geom.normals_uvs.data(), sizeof(uint64_t), num_corners, f) == num_corners;
+            }
+        }
+        return written;
+    });
+    if (!success)
+        warning("Failed to write LoD cache file %s", file.c_str());
+}
+
+// welded, indexed representation of one geometry for simplification
+struct IndexedGeometry {
+    std::vector<QuantizedCorner> vertices;
+    std::vector<glm::vec3> positions;
+    std::vector<unsigned> indices;
+};
+
+IndexedGeometry weld_geometry(Geometry const& geom) {
+    int num_tris = geom.num_tris();
+    auto positions = geom.vertices.as_range<uint64_t>().first;
+    auto normals_uvs = geom.normals.as_range<uint64_t>().first;
+
+    std::vector<QuantizedCorner> corners(size_t(num_tris) * 3);
+    for (int tri_idx = 0; tri_idx < num_tris; ++tri_idx) {
+        auto indices = glm::uvec3(tri_idx * 3) + glm::uvec3(0, 1, 2);
+        if (!(geom.format_flags & Geometry::ImplicitIndices))
+            indices = geom.indices.data()[tri_idx];
+        for (int c = 0; c < 3; ++c)
+            corners[tri_idx * 3 + c] = { positions[indices[c]], normals_uvs[indices[c]] };
+    }
+
+    IndexedGeometry indexed;
+    indexed.indices.resize(corners.size());
+    size_t num_vertices = meshopt_generateVertexRemap(indexed.indices.data(), nullptr, corners.size()
+        , corners.data(), corners.size(), sizeof(QuantizedCorner));
+    indexed.vertices.resize(num_vertices);
+    meshopt_remapVertexBuffer(indexed.vertices.data(), corners.data(), corners.size(), sizeof(QuantizedCorner), indexed.indices.data());
+
+    indexed.positions.resize(num_vertices);
+    for (size_t i = 0; i < num_vertices; ++i) {
+        uint64_t v = indexed.vertices[i].position;
+        indexed.positions[i] = glm::vec3(
+              uint32_t(v) & 0x1FFFFF
+            , uint32_t(v >> 21) & 0x1FFFFF
+            , uint32_t(v >> 42) & 0x1FFFFF) * geom.quantized_scaling + geom.quantized_offset;
+    }
+    return indexed;
+}
+
+GeneratedLoDs simplify_mesh(Mesh const& mesh, LoDGenerationParams const& params) {
+    std::vector<IndexedGeometry> indexed;
+    indexed.reserve(mesh.geometries.size());
+    for (auto const& geom : mesh.geometries)
+        indexed.push_back(weld_geometry(geom));
+
+    uint64_t const base_tris = uint64_t(mesh.num_tris());
+    uint64_t prev_tris = base_tris;
+    std::vector<std::vector<unsigned>> prev_indices(indexed.size());
+    for (size_t g = 0; g < indexed.size(); ++g)
+        prev_indices[g] = indexed[g].indices;
+
+    GeneratedLoDs lods;
+    for (int level_idx = 0; level_idx < params.max_levels; ++level_idx) {
+        GeneratedLevel level;
+        level.geometries.resize(indexed.size());
+        std::vector<std::vector<unsigned>> level_indices(indexed.size());
+        for (size_t g = 0; g < indexed.size(); ++g) {
+            auto const& src = prev_indices[g];
+            size_t target_index_count = std::max(size_t(float(src.size() / 3) * params.level_triangle_ratio), size_t(1)) * 3;
+            std::vector<unsigned>& dst = level_indices[g];
+            dst.resize(src.size());
+            // geometries are simplified separately, lock their borders to avoid cracks
+            size_t index_count = meshopt_simplify(dst.data(), src.data(), src.size()
+                , &indexed[g].positions[0].x, indexed[g].positions.size(), sizeof(glm::vec3)
+                , target_index_count, params.max_error, meshopt_SimplifyLockBorder, nullptr);
+            // keep the previous level rather than dropping a geometry (and its material slot)
+            if (index_count == 0)
+                dst = src;
+            else
+                dst.resize(index_count);
+
+            auto& out = level.geometries[g];
+            out.positions.resize(dst.size());
+            out.normals_uvs.resize(dst.size());
+            for (size_t i = 0; i < dst.size(); ++i) {
+                out.positions[i] = indexed[g].vertices[dst[i]].position;
+                out.normals_uvs[i] = indexed[g].vertices[dst[i]].normal_uv;
+            }
+        }
+
+        uint64_t level_tris = level.num_tris();
+        // stop when the error bound prevents meaningful further reduction
+        if (float(level_tris) > 0.8f * float(prev_tris))
+            break;
+        // linear detail scales with the square root of the triangle count
+        level.detail_reduction = std::min(1.0f - std::sqrt(float(level_tris) / float(base_tris)), 0.99f);
+        lods.levels.push_back(std::move(level));
+        prev_indices = std::move(level_indices);
+        prev_tris = level_tris;
+    }
+    return lods;
+}
+
+} // namespace
+#endif
+
+LoDGenerationStats generate_lods(Scene &scene, LoDGenerationParams const &params) {
+    LoDGenerationStats stats;
+#ifdef ENABLE_LOD_GENERATION
+    ProfilingScope profile_lods("Generate LoDs");
+
+    // meshes referenced by parameterized meshes without LoDs
+    std::vector<int> candidates;
+    {
+        std::vector<bool> is_candidate(scene.meshes.size(), false);
+        for (auto const& pmesh : scene.parameterized_meshes) {
+            if (pmesh.lod_group != 0 || pmesh.per_triangle_materials())
+                continue;
+            if (!is_candidate[pmesh.mesh_id] && is_lod_candidate(scene.meshes[pmesh.mesh_id], params)) {
+                is_candidate[pmesh.mesh_id] = true;
+                candidates.push_back(pmesh.mesh_id);
+            }
+        }
+    }
+    if (candidates.empty())
+        return stats;
+
+    std::string cache_dir;
+    if (!params.cache_dir.empty()) {
+        cache_dir = binary_path(params.cache_dir);
+        if (!create_directories(cache_dir)) {
+            warning("Failed to create LoD cache directory %s", cache_dir.c_str());
+            cache_dir.clear();
+        }
+    }
+
+    std::vector<GeneratedLoDs> generated(candidates.size());
+    parallel_for(0, ilen(candidates), 1, [&](index_t i, int) {
+        Mesh const& mesh = scene.meshes[candidates[i]];
+        std::string cache_file;
+        if (!cache_dir.empty()) {
+            cache_file = cache_dir + '/' + lod_cache_key(mesh, params) + ".lod";
+            if (read_lod_cache(cache_file, mesh.geometries.size(), generated[i])) {
+                generated[i].from_cache = true;
+                return;
+            }
+        }
+        generated[i] = simplify_mesh(mesh, params);
+        if (!cache_file.empty())
+            write_lod_cache(cache_file, generated[i]);
+    });
+
+    // register the new meshes, note that candidate meshes are referenced by index as meshes grows
+    std::vector<int> candidate_index(scene.meshes.size(), -1);
+    std::vector<std::vector<int>> level_mesh_ids(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        candidate_index[candidates[i]] = int(i);
+        auto& lods = generated[i];
+        if (lods.levels.empty())
+            continue;
+        stats.cached_meshes += int(lods.from_cache);
+        for (int level_idx = 0; level_idx < ilen(lods.levels); ++level_idx) {
+            auto& level = lods.levels[level_idx];
+            Mesh lod_mesh;
+            Mesh const& src = scene.meshes[candidates[i]];
+            lod_mesh.mesh_name = src.mesh_name + "_LOD" + std::to_string(level_idx + 1);
+            lod_mesh.geometries.resize(src.geometries.size());
+            for (size_t g = 0; g < src.geometries.size(); ++g) {
+                Geometry const& src_geom = src.geometries[g];
+                Geometry& geom = lod_mesh.geometries[g];
+                geom.base = src_geom.base;
+                geom.extent = src_geom.extent;
+                geom.quantized_scaling = src_geom.quantized_scaling;
+                geom.quantized_offset = src_geom.quantized_offset;
+                geom.format_flags = Geometry::QuantizedPositions | Geometry::QuantizedNormalsAndUV | Geometry::NoIndices;
+                geom.vertices.make_vector<uint64_t>() = std::move(level.geometries[g].positions);
+                geom.normals.make_vector<uint64_t>() = std::move(level.geometries[g].normals_uvs);
+                geom.uvs = geom.normals;
+            }
+            stats.generated_triangles += uint64_t(lod_mesh.num_tris());
+            scene.meshes.push_back(std::move(lod_mesh));
+            level_mesh_ids[i].push_back(ilen(scene.meshes) - 1);
+            ++stats.generated_meshes;
+        }
+    }
+
+    // one LoD group per parameterized mesh, sharing the generated meshes
+    for (int pm_idx = 0, pm_count = ilen(scene.parameterized_meshes); pm_idx < pm_count; ++pm_idx) {
+        if (scene.parameterized_meshes[pm_idx].lod_group != 0)
+            continue;
+        int mesh_id = scene.parameterized_meshes[pm_idx].mesh_id;
+        int i = mesh_id < ilen(candidate_index) ? candidate_index[mesh_id] : -1;
+        if (i < 0 || level_mesh_ids[i].empty() || scene.parameterized_meshes[pm_idx].per_triangle_materials())
+            continue;
+
+        int lod_group_id = ilen(scene.lod_groups);
+        LodGroup group;
+        group.mesh_ids.push_back(pm_idx);
+        group.detail_reduction.push_back(0.0f);
+        for (size_t level_idx = 0; level_idx < level_mesh_ids[i].size(); ++level_idx) {
+            ParameterizedMesh lod_pmesh = scene.parameterized_meshes[pm_idx];
+            lod_pmesh.mesh_id = level_mesh_ids[i][level_idx];
+            lod_pmesh.mesh_name += "_LOD" + std::to_string(level_idx + 1);
+            lod_pmesh.lod_group = lod_group_id;
+            scene.parameterized_meshes.push_back(std::move(lod_pmesh));
+            group.mesh_ids.push_back(ilen(scene.parameterized_meshes) - 1);
+            group.detail_reduction.push_back(generated[i].levels[level_idx].detail_reduction);
+        }
+        scene.parameterized_meshes[pm_idx].lod_group = lod_group_id;
+        scene.lod_groups.push_back(std::move(group));
+        ++stats.generated_groups;
+    }
+
+    if (stats.generated_meshes) {
+        ++scene.meshes_revision;
+        ++scene.parameterized_meshes_revision;
+    }
+    println(CLL::INFORMATION, "Generated %d LoD groups with %d meshes (%d from cache), %s triangles"
+        , stats.generated_groups, stats.generated_meshes, stats.cached_meshes
+        , pretty_print_count(double(stats.generated_triangles)).c_str());
+#else
+    (void) scene;
+    (void) params;
+    warning("LoD generation requested, but the mesh simplifier is not available in this build");
+#endif
+    return stats;
+}
@@ -0,0 +1,32 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+struct Scene;
+
+struct LoDGenerationParams {
+    uint64_t min_triangles = 100000; // only meshes above this triangle count are simplified
+    int max_levels = 3; // simplified levels in addition to the original mesh
+    float level_triangle_ratio = 0.25f; // target triangle count of each level relative to the previous one
+    float max_error = 0.02f; // simplification error bound relative to the mesh extent
+    std::string cache_dir = "lod_cache"; // relative to the binary directory, empty disables caching
+};
+
+struct LoDGenerationStats {
+    int generated_groups = 0;
+    int generated_meshes = 0;
+    int cached_meshes = 0; // source meshes whose levels were loaded from the cache
+    uint64_t generated_triangles = 0;
+};
+
+// true if the build includes the mesh simplifier
+bool lod_generation_available();
+
+// Builds simplified levels of detail for large static meshes that are not part of a LoD group yet,
+// in parallel per mesh, and registers them as new LoD groups. Meshes with per-triangle materials
+// or mesh shaders are skipped. Results are cached on disk, keyed by the mesh content hash.
+LoDGenerationStats generate_lods(Scene &scene, LoDGenerationParams const &params = {});
@@ -20,6 +20,33 @@ Mesh::Mesh(std::vector<Geometry> geometries)
     : geometries(std::move(geometries)) {
 }
 
+MeshBounds Mesh::compute_bounds(bool conservative_quantization_bounds) const
+{
+    MeshBounds result;
+    if (conservative_quantization_bounds) {
+        for (auto const& g : geometries)
+            result.box += AABB(g.base, g.base + g.extent);
+        result.sphere = Sphere(result.box.center(), 0.5f * glm::length(result.box.extent()));
+        return result;
+    }
+
+    for (auto const& g : geometries)
+        result.box += g.compute_bounds();
+    // second streaming pass to fit the sphere radius around the box center
+    glm::vec3 center = result.box.empty() ? glm::vec3(0.0f) : result.box.center();
+    float radius = 0.0f;
+    for (auto const& g : geometries)
+        radius = std::max(radius, g.max_distance(center));
+    result.sphere = Sphere(center, radius);
+    return result;
+}
+
+void Mesh::update_bounds(bool conservative_quantization_bounds)
+{
+    bounds = compute_bounds(conservative_quantization_bounds);
+    bounds_revision = model_vertex_revision();
+}
+
 len_t Mesh::num_tris() const
 {
     len_t n = 0;
@@ -6,6 +6,7 @@
 #include <vector>
 #include <glm/glm.hpp>
 #include "file_mapping.h"
+#include "bounds.h"
 
 struct Geometry {
     enum FormatFlags {
@@ -38,12 +39,22 @@ struct Geometry {
     void tri_positions(int tri_idx, glm::vec3& v1, glm::vec3& v2, glm::vec3& v3) const;
     void tri_normals(int tri_idx, glm::vec3& v1, glm::vec3& v2, glm::vec3& v3) const;
     void tri_uvs(int tri_idx, glm::vec2& v1, glm::vec2& v2, glm::vec2& v3) const;
+
+    // streaming bounds computation, without unpacking vertices
+    AABB compute_bounds() const;
+    float max_distance(const glm::vec3 &point) const;
+};
+
+struct MeshBounds {
+    AABB box;
+    Sphere sphere;
 };
 
 struct Mesh {
     enum Flags {
         Dynamic = 0x01,
         SubtlyDynamic = 0x02,
+        Optimized = 0x04, // triangle order optimized for quad formation
     };
 
     std::vector<Geometry> geometries;
@@ -59,6 +70,10 @@ struct Mesh {
     unsigned optimize_revision = 0; // re-optimize for vertices
     unsigned model_revision = 0; // completely replace with new data
 
+    // cached object-space bounds, valid while bounds_revision matches model_vertex_revision()
+    MeshBounds bounds;
+    unsigned bounds_revision = ~0u;
+
     Mesh() = default;
     // legacy
     Mesh(std::vector<Geometry> geometries);
@@ -69,6 +84,11 @@ struct Mesh {
     unsigned model_vertex_revision() const { return (vertices_revision & 0xffff) + (model_revision << 16); };
     unsigned model_attribute_revision() const { return (attributes_revision & 0xffff) + (model_revision << 16); };
     unsigned model_optimize_revision() const { return (optimize_revision & 0xffff) + (model_revision << 16); };
+
+    // exact bounds from the vertex data, or the conservative quantization boxes of the geometries
+    MeshBounds compute_bounds(bool conservative_quantization_bounds = false) const;
+    bool has_current_bounds() const { return bounds_revision == model_vertex_revision(); }
+    void update_bounds(bool conservative_quantization_bounds = false);
 };
 
 /* A parameterized mesh is a combination of a mesh containing the geometries
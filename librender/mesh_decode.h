@@ -4,6 +4,7 @@
 #pragma once
 
 #include "mesh.h"
+#include <algorithm>
 
 namespace glsl {
     using namespace glm;
@@ -28,6 +29,118 @@ void Geometry::get_vertex_positions(glm::vec3* dst_array) const {
     }
 }
 
+// vertices are scanned in blocks of lanes with per-lane accumulators, the lane
+// loops have a fixed trip count and no branches so that they map to vector
+// instructions (same block layout as InstanceBounds)
+constexpr int GEOMETRY_BOUNDS_LANES = 8;
+
+AABB Geometry::compute_bounds() const {
+    AABB box;
+    if (format_flags & Geometry::QuantizedPositions) {
+        const auto vertices = this->vertices.as_range<uint64_t>();
+        const size_t count = vertices.last - vertices.first;
+        if (count == 0)
+            return box;
+
+        // min/max on the quantized lanes, only the resulting corners need dequantization
+        uint32_t lo[3][GEOMETRY_BOUNDS_LANES], hi[3][GEOMETRY_BOUNDS_LANES];
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int l = 0; l < GEOMETRY_BOUNDS_LANES; ++l) {
+                lo[axis][l] = 0x1FFFFF;
+                hi[axis][l] = 0;
+            }
+        }
+        const size_t block_end = count - count % GEOMETRY_BOUNDS_LANES;
+        for (size_t block = 0; block < block_end; block += GEOMETRY_BOUNDS_LANES) {
+            const uint64_t* v = vertices.first + block;
+            for (int axis = 0; axis < 3; ++axis) {
+                for (int l = 0; l < GEOMETRY_BOUNDS_LANES; ++l) {
+                    const uint32_t q = uint32_t(v[l] >> (21 * axis)) & 0x1FFFFF;
+                    lo[axis][l] = std::min(lo[axis][l], q);
+                    hi[axis][l] = std::max(hi[axis][l], q);
+                }
+            }
+        }
+        for (size_t i = block_end; i < count; ++i) {
+            const uint64_t v = vertices.first[i];
+            for (int axis = 0; axis < 3; ++axis) {
+                const uint32_t q = uint32_t(v >> (21 * axis)) & 0x1FFFFF;
+                lo[axis][0] = std::min(lo[axis][0], q);
+                hi[axis][0] = std::max(hi[axis][0], q);
+            }
+        }
+
+        uint32_t lo_xyz[3], hi_xyz[3];
+        for (int axis = 0; axis < 3; ++axis) {
+            lo_xyz[axis] = *std::min_element(lo[axis], lo[axis] + GEOMETRY_BOUNDS_LANES);
+            hi_xyz[axis] = *std::max_element(hi[axis], hi[axis] + GEOMETRY_BOUNDS_LANES);
+        }
+
+        using namespace glm;
+        const vec3 p0 = DEQUANTIZE_POSITION_XYZ(lo_xyz[0], lo_xyz[1], lo_xyz[2], this->quantized_scaling, this->quantized_offset);
+        const vec3 p1 = DEQUANTIZE_POSITION_XYZ(hi_xyz[0], hi_xyz[1], hi_xyz[2], this->quantized_scaling, this->quantized_offset);
+        box += p0;
+        box += p1;
+    } else {
+        const auto vertices = this->vertices.as_range<glm::vec3>();
+        const size_t count = vertices.last - vertices.first;
+        if (count == 0)
+            return box;
+
+        const float* v = &vertices.first->x;
+        float lo[3][GEOMETRY_BOUNDS_LANES], hi[3][GEOMETRY_BOUNDS_LANES];
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int l = 0; l < GEOMETRY_BOUNDS_LANES; ++l) {
+                lo[axis][l] = v[axis];
+                hi[axis][l] = v[axis];
+            }
+        }
+        const size_t block_end = count - count % GEOMETRY_BOUNDS_LANES;
+        for (size_t block = 0; block < block_end; block += GEOMETRY_BOUNDS_LANES) {
+            const float* b = v + 3 * block;
+            for (int axis = 0; axis < 3; ++axis) {
+                for (int l = 0; l < GEOMETRY_BOUNDS_LANES; ++l) {
+                    lo[axis][l] = std::min(lo[axis][l], b[3 * l + axis]);
+                    hi[axis][l] = std::max(hi[axis][l], b[3 * l + axis]);
+                }
+            }
+        }
+        for (size_t i = block_end; i < count; ++i) {
+            for (int axis = 0; axis < 3; ++axis) {
+                lo[axis][0] = std::min(lo[axis][0], v[3 * i + axis]);
+                hi[axis][0] = std::max(hi[axis][0], v[3 * i + axis]);
+            }
+        }
+
+        glm::vec3 lower, upper;
+        for (int axis = 0; axis < 3; ++axis) {
+            lower[axis] = *std::min_element(lo[axis], lo[axis] + GEOMETRY_BOUNDS_LANES);
+            upper[axis] = *std::max_element(hi[axis], hi[axis] + GEOMETRY_BOUNDS_LANES);
+        }
+        box = AABB(lower, upper);
+    }
+    return box;
+}
+
+float Geometry::max_distance(const glm::vec3 &point) const {
+    float max_dist_squared = 0.0f;
+    if (format_flags & Geometry::QuantizedPositions) {
+        const auto vertices = this->vertices.as_range<uint64_t>();
+        using namespace glm;
+        for (auto vertex_curr = vertices.first; vertex_curr != vertices.last; ++vertex_curr) {
+            const vec3 delta = DEQUANTIZE_POSITION(*vertex_curr, this->quantized_scaling, this->quantized_offset) - point;
+            max_dist_squared = std::max(max_dist_squared, dot(delta, delta));
+        }
+    } else {
+        const auto vertices = this->vertices.as_range<glm::vec3>();
+        for (auto vertex_curr = vertices.first; vertex_curr != vertices.last; ++vertex_curr) {
+            const glm::vec3 delta = *vertex_curr - point;
+            max_dist_squared = std::max(max_dist_squared, glm::dot(delta, delta));
+        }
+    }
+    return std::sqrt(max_dist_squared);
+}
+
 void Geometry::tri_positions(int tri_idx, glm::vec3& v1, glm::vec3& v2, glm::vec3& v3) const {
     auto indices = glm::uvec3(tri_idx * 3) + glm::uvec3(0, 1, 2);
     if (!(format_flags & Geometry::ImplicitIndices))
@@ -0,0 +1,296 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "mesh_optimization.h"
+#include "scene.h"
+#include "error_io.h"
+#include "parallel.h"
+#include "profiling.h"
+#include "util.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#ifdef ENABLE_MESH_OPTIMIZATION
+#include <vkr.h>
+#include <meshoptimizer.h>
+#endif
+
+bool mesh_optimization_available() {
+#ifdef ENABLE_MESH_OPTIMIZATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef ENABLE_MESH_OPTIMIZATION
+namespace {
+
+// bump whenever the optimization or the cache layout changes
+constexpr uint32_t OPT_CACHE_VERSION = 1;
+constexpr char OPT_CACHE_MAGIC[8] = { 'R', 'P', 'T', 'R', 'O', 'P', 'T', '\0' };
+
+struct OptimizedGeometry {
+    std::vector<uint32_t> triangle_order; // source triangle of each output triangle
+    std::vector<glm::uvec3> indices; // shared-vertex indices into the reordered corners
+};
+
+struct OptimizedMesh {
+    std::vector<OptimizedGeometry> geometries;
+    bool from_cache = false;
+    bool valid = false;
+};
+
+bool is_optimization_candidate(Mesh const& mesh, MeshOptimizationParams const& params) {
+    if (mesh.flags & (Mesh::Optimized | Mesh::Dynamic | Mesh::SubtlyDynamic) || !mesh.mesh_shader_names.empty())
+        return false;
+    if (mesh.geometries.empty() || uint64_t(mesh.num_tris()) < params.min_triangles)
+        return false;
+    uint32_t const required_flags = Geometry::QuantizedPositions | Geometry::QuantizedNormalsAndUV | Geometry::ImplicitIndices;
+    for (auto const& geom : mesh.geometries) {
+        if ((geom.format_flags & required_flags) != required_flags)
+            return false;
+        if (geom.vertices.count<uint64_t>() != size_t(geom.num_tris()) * 3
+            || geom.normals.count<uint64_t>() != geom.vertices.count<uint64_t>())
+            return false;
+    }
+    return true;
+}
+
+bool has_index_buffer(Geometry const& geom) {
+    return !geom.indices.empty() && (geom.format_flags & Geometry::NoIndices) != Geometry::NoIndices;
+}
+
+std::string optimization_cache_key(Mesh const& mesh) {
+    std::string digests;
+    for (auto const& geom : mesh.geometries) {
+        digests += sha1_hash((char const*) geom.vertices.bytes(), geom.vertices.nbytes());
+        digests += sha1_hash((char const*) geom.normals.bytes(), geom.normals.nbytes());
+        if (has_index_buffer(geom))
+            digests += sha1_hash((char const*) geom.indices.bytes(), geom.indices.nbytes());
+        char geom_params[64];
+        snprintf(geom_params, sizeof(geom_params), "%x;%d;", geom.format_flags, geom.index_offset);
+        digests += geom_params;
+    }
+    char settings[32];
+    snprintf(settings, sizeof(settings), "v%u", OPT_CACHE_VERSION);
+    digests += settings;
+    return sha1_hash(digests.data(), digests.size());
+}
+
+bool read_optimization_cache(std::string const& file, Mesh const& mesh, OptimizedMesh& optimized) {
+    FILE* f = fopen(file.c_str(), "rb");
+    if (!f)
+        return false;
+    char magic[sizeof(OPT_CACHE_MAGIC)];
+    uint32_t header[2] = { };
+    bool valid = fread(magic, sizeof(magic), 1, f) == 1 && memcmp(magic, OPT_CACHE_MAGIC, sizeof(magic)) == 0
+        && fread(header, sizeof(header), 1, f) == 1
+        && header[0] == OPT_CACHE_VERSION && header[1] == mesh.geometries.size();
+    if (valid) {
+        optimized.geometries.resize(mesh.geometries.size());
+        for (size_t g = 0; g < mesh.geometries.size() && valid; ++g) {
+            auto& geom = optimized.geometries[g];
+            uint64_t num_tris = 0;
+            valid = fread(&num_tris, sizeof(num_tris), 1, f) == 1 && num_tris == uint64_t(mesh.geometries[g].num_tris());
+            if (!valid)
+                break;
+            geom.triangle_order.resize(num_tris);
+            geom.indices.resize(num_tris);
+            valid = fread(geom.triangle_order.data(), sizeof(uint32_t), num_tris, f) == num_tris
+                && fread(geom.indices.data(), sizeof(glm::uvec3), num_tris, f) == num_tris;
+            for (size_t t = 0; t < num_tris && valid; ++t)
+                valid = geom.triangle_order[t] < num_tris && glm::all(glm::lessThan(geom.indices[t], glm::uvec3(3 * num_tris)));
+        }
+    }
+    fclose(f);
+    if (!valid) {
+        warning("Ignoring corrupt mesh optimization cache file %s", file.c_str());
+        optimized.geometries.clear();
+    }
+    return valid;
+}
+
+void write_optimization_cache(std::string const& file, OptimizedMesh const& optimized) {
+    bool success = write_file_atomically(file, [&optimized](FILE* f) {
+        uint32_t header[2] = { OPT_CACHE_VERSION, uint32_t(optimized.geometries.size()) };
+        bool written = fwrite(OPT_CACHE_MAGIC, sizeof(OPT_CACHE_MAGIC), 1, f) == 1
+            && fwrite(header, sizeof(header), 1, f) == 1;
+        for (auto const& geom : optimized.geometries) {
+            uint64_t num_tris = geom.triangle_order.size();
+            written = written && fwrite(&num_tris, sizeof(num_tris), 1, f) == 1
+                && fwrite(geom.triangle_order.data(), sizeof(uint32_t), num_tris, f) == num_tris
+                && fwrite(geom.indices.data(), sizeof(glm::uvec3), num_tris, f) == num_tris;
+        }
+        return written;
+    });
+    if (!success)
+        warning("Failed to write mesh optimization cache file %s", file.c_str());
+}
+
+// shared vertex id per corner, from the exported index buffer or by welding equal positions
+std::vector<uint32_t> shared_vertex_ids(Geometry const& geom, size_t& num_vertices) {
+    size_t const num_corners = size_t(geom.num_tris()) * 3;
+    std::vector<uint32_t> ids(num_corners);
+    if (has_index_buffer(geom)) {
+        glm::uvec3 const* indices = geom.indices.data();
+        bool in_range = true;
+        for (size_t t = 0; t < num_corners / 3 && in_range; ++t) {
+            for (int c = 0; c < 3; ++c) {
+                int64_t corner = int64_t(indices[t][c]) + geom.index_offset;
+                in_range &= corner >= 0 && corner < int64_t(num_corners);
+                ids[t * 3 + c] = uint32_t(corner);
+            }
+        }
+        if (in_range) {
+            num_vertices = num_corners;
+            return ids;
+        }
+    }
+    num_vertices = meshopt_generateVertexRemap(ids.data(), nullptr, num_corners
+        , geom.vertices.data(), num_corners, sizeof(uint64_t));
+    return ids;
+}
+
+OptimizedMesh optimize_mesh(Mesh const& mesh) {
+    auto error_handler = [](VkrResult, const char *msg) {
+        warning("Mesh optimization failed: %s", msg);
+    };
+
+    OptimizedMesh optimized;
+    optimized.geometries.resize(mesh.geometries.size());
+    for (size_t g = 0; g < mesh.geometries.size(); ++g) {
+        Geometry const& geom = mesh.geometries[g];
+        size_t const num_tris = size_t(geom.num_tris());
+        size_t num_vertices = 0;
+        std::vector<uint32_t> ids = shared_vertex_ids(geom, num_vertices);
+
+        std::vector<uint32_t> optimized_ids = ids;
+        std::vector<uint32_t> triangle_order(num_tris);
+        if (vkr_optimize_mesh(num_tris, optimized_ids.data(), num_vertices, triangle_order.data(), error_handler) != VKR_SUCCESS)
+            return optimized;
+
+        // reference the first reordered corner of each shared vertex, like the exporter does
+        std::vector<uint32_t> first_corner(num_vertices, ~0u);
+        auto& out = optimized.geometries[g];
+        out.triangle_order = std::move(triangle_order);
+        out.indices.resize(num_tris);
+        for (size_t t = 0; t < num_tris; ++t) {
+            for (int c = 0; c < 3; ++c) {
+                uint32_t id = ids[out.triangle_order[t] * 3 + c];
+                if (first_corner[id] == ~0u)
+                    first_corner[id] = uint32_t(t * 3 + c);
+                out.indices[t][c] = first_corner[id];
+            }
+        }
+    }
+    optimized.valid = true;
+    return optimized;
+}
+
+void apply_optimization(Mesh& mesh, OptimizedMesh& optimized) {
+    for (size_t g = 0; g < mesh.geometries.size(); ++g) {
+        Geometry& geom = mesh.geometries[g];
+        auto& opt = optimized.geometries[g];
+        uint64_t const* positions = geom.vertices.as_range<uint64_t>().first;
+        uint64_t const* normals_uvs = geom.normals.as_range<uint64_t>().first;
+
+        size_t const num_corners = opt.triangle_order.size() * 3;
+        std::vector<uint64_t> new_positions(num_corners), new_normals_uvs(num_corners);
+        for (size_t t = 0; t < opt.triangle_order.size(); ++t) {
+            for (int c = 0; c < 3; ++c) {
+                new_positions[t * 3 + c] = positions[opt.triangle_order[t] * 3 + c];
+                new_normals_uvs[t * 3 + c] = normals_uvs[opt.triangle_order[t] * 3 + c];
+            }
+        }
+        geom.vertices.make_vector<uint64_t>() = std::move(new_positions);
+        geom.normals.make_vector<uint64_t>() = std::move(new_normals_uvs);
+        geom.uvs = geom.normals;
+        geom.indices.make_vector() = std::move(opt.indices);
+        geom.index_offset = 0;
+        // rendering keeps using implicit indices, the index buffer is for quad formation in BVH builds
+        geom.format_flags = (geom.format_flags & ~uint32_t(Geometry::NoIndices)) | Geometry::ImplicitIndices;
+    }
+    mesh.flags |= Mesh::Optimized;
+    ++mesh.vertices_revision;
+    ++mesh.attributes_revision;
+    ++mesh.optimize_revision;
+}
+
+} // namespace
+#endif
+
+MeshOptimizationStats optimize_meshes(Scene &scene, MeshOptimizationParams const &params) {
+    MeshOptimizationStats stats;
+#ifdef ENABLE_MESH_OPTIMIZATION
+    ProfilingScope profile_optimize("Optimize meshes");
+
+    // triangle reordering would invalidate per-triangle material assignments
+    std::vector<bool> excluded(scene.meshes.size(), false);
+    for (auto const& pmesh : scene.parameterized_meshes) {
+        if (pmesh.per_triangle_materials())
+            excluded[pmesh.mesh_id] = true;
+    }
+    std::vector<int> candidates;
+    for (int mesh_id = 0; mesh_id < ilen(scene.meshes); ++mesh_id) {
+        if (!excluded[mesh_id] && is_optimization_candidate(scene.meshes[mesh_id], params))
+            candidates.push_back(mesh_id);
+    }
+    if (candidates.empty())
+        return stats;
+
+    std::string cache_dir;
+    if (!params.cache_dir.empty()) {
+        cache_dir = binary_path(params.cache_dir);
+        if (!create_directories(cache_dir)) {
+            warning("Failed to create mesh optimization cache directory %s", cache_dir.c_str());
+            cache_dir.clear();
+        }
+    }
+
+    // largest first for better load balancing
+    std::sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+        return scene.meshes[a].num_tris() > scene.meshes[b].num_tris();
+    });
+    std::vector<OptimizedMesh> optimized(candidates.size());
+    parallel_for(0, ilen(candidates), 1, [&](index_t i, int) {
+        Mesh& mesh = scene.meshes[candidates[i]];
+        std::string cache_file;
+        if (!cache_dir.empty()) {
+            cache_file = cache_dir + '/' + optimization_cache_key(mesh) + ".opt";
+            if (read_optimization_cache(cache_file, mesh, optimized[i])) {
+                optimized[i].from_cache = true;
+                optimized[i].valid = true;
+            }
+        }
+        if (!optimized[i].valid) {
+            optimized[i] = optimize_mesh(mesh);
+            if (!optimized[i].valid)
+                return;
+            if (!cache_file.empty())
+                write_optimization_cache(cache_file, optimized[i]);
+        }
+        // meshes are independent, apply in place while the source data is hot
+        apply_optimization(mesh, optimized[i]);
+    });
+
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (!optimized[i].valid)
+            continue;
+        ++stats.optimized_meshes;
+        stats.cached_meshes += int(optimized[i].from_cache);
+        stats.optimized_triangles += uint64_t(scene.meshes[candidates[i]].num_tris());
+    }
+    if (stats.optimized_meshes)
+        ++scene.meshes_revision;
+    println(CLL::INFORMATION, "Optimized triangle order of %d meshes (%d from cache), %s triangles"
+        , stats.optimized_meshes, stats.cached_meshes
+        , pretty_print_count(double(stats.optimized_triangles)).c_str());
+#else
+    (void) scene;
+    (void) params;
+    warning("Mesh optimization requested, but vkr_optimize_mesh is not available in this build");
+#endif
+    return stats;
+}
@@ -0,0 +1,29 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+struct Scene;
+
+struct MeshOptimizationParams {
+    uint64_t min_triangles = 64; // smaller meshes are left in file order
+    std::string cache_dir = "mesh_opt_cache"; // relative to the binary directory, empty disables caching
+};
+
+struct MeshOptimizationStats {
+    int optimized_meshes = 0;
+    int cached_meshes = 0; // meshes whose triangle order was loaded from the cache
+    uint64_t optimized_triangles = 0;
+};
+
+// true if the build includes vkr_optimize_mesh
+bool mesh_optimization_available();
+
+// Reorders the triangles of static meshes that are not marked Mesh::Optimized yet with
+// vkr_optimize_mesh, so that adjacent triangles can be paired into quads by BVH builders.
+// Runs in parallel per mesh, adds shared-vertex index buffers and bumps the optimize
+// revision of changed meshes. Results are cached on disk, keyed by the mesh content hash.
+MeshOptimizationStats optimize_meshes(Scene &scene, MeshOptimizationParams const &params = {});
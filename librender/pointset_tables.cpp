@@ -0,0 +1,371 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "pointset_tables.h"
+#include "error_io.h"
+#include "parallel.h"
+#include "util.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "../rendering/pointsets/sobol_direction_numbers.h"
+#include "../rendering/pointsets/sobol_data.h"
+#include "../rendering/pointsets/bn_data.h"
+
+namespace glsl {
+    using namespace glm;
+    #include "../rendering/language.hpp"
+    #include "../rendering/pointsets/hashing.glsl"
+}
+
+constexpr uint32_t POINTSET_CACHE_VERSION = 1;
+constexpr char POINTSET_CACHE_MAGIC[8] = { 'R', 'P', 'T', 'R', 'P', 'T', 'S', '\0' };
+
+enum PointsetTableKind : uint32_t {
+    POINTSET_TABLE_SOBOL = 1,
+    POINTSET_TABLE_BN,
+    POINTSET_TABLE_BN_SEED
+};
+
+struct PointsetTableHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t kind;
+    uint32_t config[4];
+    uint64_t source_timestamp; // last modification of the seed file the tables were expanded from
+    uint64_t num_elements;
+};
+
+static PointsetTableHeader make_header(PointsetTableKind kind, int const (&config)[4], size_t num_elements, uint64_t source_timestamp = 0) {
+    PointsetTableHeader header = { };
+    memcpy(header.magic, POINTSET_CACHE_MAGIC, sizeof(header.magic));
+    header.version = POINTSET_CACHE_VERSION;
+    header.kind = kind;
+    for (int i = 0; i < 4; ++i)
+        header.config[i] = uint32_t(config[i]);
+    header.source_timestamp = source_timestamp;
+    header.num_elements = num_elements;
+    return header;
+}
+
+static bool is_power_of_two(int x) {
+    return x > 0 && (x & (x - 1)) == 0;
+}
+
+static int log2_of_power_of_two(int x) {
+    int bits = 0;
+    while ((1 << bits) < x)
+        ++bits;
+    return bits;
+}
+
+static uint32_t sobol_point(uint32_t const* matrices, int dimension, uint32_t index) {
+    uint32_t result = 0;
+    for (uint32_t const* column = matrices + dimension * SobolData_MatrixSize; index != 0; index >>= 1, ++column) {
+        if ((index & 1) != 0)
+            result ^= *column;
+    }
+    return result;
+}
+
+SobolTableConfig SobolTableConfig::compiled() {
+    return { SobolData_Dimensions, SobolData_TileSize, SobolData_InvertDim0, SobolData_InvertDim1 };
+}
+
+size_t SobolTableConfig::num_elements() const {
+    return size_t(dimensions) * SobolData_MatrixSize + size_t(tile_size) * tile_size;
+}
+
+std::string SobolTableConfig::name() const {
+    return to_stringf("sobol_d%d_t%d_i%d_%d", dimensions, tile_size, invert_dim_0, invert_dim_1);
+}
+
+BNTableConfig BNTableConfig::compiled() {
+    return { BNData_SampleCount, BNData_Dimensions, BNData_ScramblingDimensions, BNData_TileSize };
+}
+
+size_t BNTableConfig::tile_elements() const {
+    return size_t(tile_size) * tile_size * scrambling_dimensions;
+}
+
+size_t BNTableConfig::num_elements() const {
+    // sequence, 1 spp scrambling, scrambling and ranking for 4, 16, 256 spp
+    return size_t(sample_count) * dimensions + 7 * tile_elements();
+}
+
+std::string BNTableConfig::name() const {
+    return to_stringf("bn_t%d_s%d_d%d_x%d", tile_size, sample_count, dimensions, scrambling_dimensions);
+}
+
+static void validate_config(SobolTableConfig const& config) {
+    if (!is_power_of_two(config.dimensions) || config.dimensions > SobolDirectionNumbers_Dimensions)
+        throw_error("Sobol dimensions must be a power of two up to %d, got %d", SobolDirectionNumbers_Dimensions, config.dimensions);
+    if (!is_power_of_two(config.tile_size) || config.tile_size < 2 || config.tile_size > 1 << (SobolData_MatrixSize / 2))
+        throw_error("Sobol tile size must be a power of two from 2 to %d, got %d", 1 << (SobolData_MatrixSize / 2), config.tile_size);
+    if (config.invert_dim_0 >= config.dimensions || config.invert_dim_1 >= config.dimensions)
+        throw_error("Sobol tile inversion dimensions %d, %d out of range", config.invert_dim_0, config.invert_dim_1);
+}
+
+static void validate_config(BNTableConfig const& config) {
+    // sequence values are stored in 8 bits, pixel IDs are packed into 16 bits of the random state
+    if (!is_power_of_two(config.sample_count) || config.sample_count > 256)
+        throw_error("Blue noise sample count must be a power of two up to 256, got %d", config.sample_count);
+    if (!is_power_of_two(config.dimensions) || config.dimensions > SobolDirectionNumbers_Dimensions)
+        throw_error("Blue noise dimensions must be a power of two up to %d, got %d", SobolDirectionNumbers_Dimensions, config.dimensions);
+    if (!is_power_of_two(config.scrambling_dimensions) || config.scrambling_dimensions > config.dimensions)
+        throw_error("Blue noise scrambling dimensions must be a power of two up to %d, got %d", config.dimensions, config.scrambling_dimensions);
+    if (!is_power_of_two(config.tile_size) || config.tile_size < 2 || config.tile_size > 256)
+        throw_error("Blue noise tile size must be a power of two from 2 to 256, got %d", config.tile_size);
+}
+
+void generate_sobol_matrices(uint32_t* matrices, int dimensions) {
+    // locate the direction numbers of each dimension, entries are variable-length
+    std::vector<uint32_t const*> direction_numbers(dimensions);
+    {
+        uint32_t const* entry = SobolDirectionNumbers;
+        for (int d = 1; d < dimensions; ++d) {
+            direction_numbers[d] = entry;
+            entry += 2 + entry[0];
+        }
+    }
+
+    parallel_for(0, dimensions, 64, [&](index_t d, int) {
+        uint32_t* columns = matrices + d * SobolData_MatrixSize;
+        if (d == 0) {
+            for (int j = 0; j < SobolData_MatrixSize; ++j)
+                columns[j] = 1u << (31 - j);
+            return;
+        }
+        uint32_t const* entry = direction_numbers[d];
+        int s = int(entry[0]);
+        uint32_t a = entry[1];
+        uint32_t m[SobolData_MatrixSize];
+        for (int k = 0; k < SobolData_MatrixSize; ++k) {
+            if (k < s) {
+                m[k] = entry[2 + k];
+                continue;
+            }
+            // m_k = 2 a_1 m_k-1 ^ 4 a_2 m_k-2 ^ ... ^ 2^s m_k-s ^ m_k-s
+            m[k] = m[k - s] ^ (m[k - s] << s);
+            for (int i = 1; i < s; ++i) {
+                if ((a >> (s - 1 - i)) & 1)
+                    m[k] ^= m[k - i] << i;
+            }
+        }
+        for (int j = 0; j < SobolData_MatrixSize; ++j)
+            columns[j] = m[j] << (31 - j);
+    });
+}
+
+void generate_sobol_tile_inversion(uint32_t* inversion_y_x, uint32_t const* matrices, int tile_size, int dim_x, int dim_y) {
+    int tile_bits = log2_of_power_of_two(tile_size);
+    size_t num_cells = size_t(tile_size) * tile_size;
+
+    std::vector<uint32_t> cell_of_index(num_cells);
+    parallel_for(0, num_cells, 4096, [&](index_t i, int) {
+        uint32_t x = sobol_point(matrices, dim_x, uint32_t(i)) >> (32 - tile_bits);
+        uint32_t y = sobol_point(matrices, dim_y, uint32_t(i)) >> (32 - tile_bits);
+        cell_of_index[i] = y * uint32_t(tile_size) + x;
+    });
+
+    // every cell receives exactly one point for dimension pairs forming a (0,2)-sequence
+    std::vector<bool> covered(num_cells, false);
+    for (size_t i = 0; i < num_cells; ++i) {
+        if (covered[cell_of_index[i]])
+            throw_error("Sobol dimensions %d, %d do not stratify a %d x %d tile", dim_x, dim_y, tile_size, tile_size);
+        covered[cell_of_index[i]] = true;
+        inversion_y_x[cell_of_index[i]] = uint32_t(i);
+    }
+}
+
+void generate_sobol_tables(uint32_t* tables, SobolTableConfig const& config) {
+    validate_config(config);
+    generate_sobol_matrices(tables, config.dimensions);
+    generate_sobol_tile_inversion(tables + config.dimensions * SobolData_MatrixSize, tables
+        , config.tile_size, config.invert_dim_0, config.invert_dim_1);
+}
+
+static uint32_t reverse_bits(uint32_t x) {
+    x = (x << 16) | (x >> 16);
+    x = ((x & 0x00ff00ffu) << 8) | ((x & 0xff00ff00u) >> 8);
+    x = ((x & 0x0f0f0f0fu) << 4) | ((x & 0xf0f0f0f0u) >> 4);
+    x = ((x & 0x33333333u) << 2) | ((x & 0xccccccccu) >> 2);
+    x = ((x & 0x55555555u) << 1) | ((x & 0xaaaaaaaau) >> 1);
+    return x;
+}
+
+// hash-based nested uniform scrambling, see
+// "Practical Hash-based Owen Scrambling" by Brent Burley, JCGT 2020
+static uint32_t owen_scramble(uint32_t x, uint32_t seed) {
+    x = reverse_bits(x);
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return reverse_bits(x);
+}
+
+static uint32_t hash_3(uint32_t a, uint32_t b, uint32_t c) {
+    uint32_t hash = glsl::murmur_hash3_mix(0, a);
+    hash = glsl::murmur_hash3_mix(hash, b);
+    hash = glsl::murmur_hash3_mix(hash, c);
+    return glsl::murmur_hash3_finalize(hash);
+}
+
+void generate_bn_sequence(uint32_t* sobol_spp_d, int sample_count, int dimensions, uint32_t seed) {
+    std::vector<uint32_t> matrices(size_t(dimensions) * SobolData_MatrixSize);
+    generate_sobol_matrices(matrices.data(), dimensions);
+    parallel_for(0, dimensions, 8, [&](index_t d, int) {
+        uint32_t dimension_seed = hash_3(seed, uint32_t(d), 0);
+        for (int i = 0; i < sample_count; ++i)
+            sobol_spp_d[d + size_t(i) * dimensions] = owen_scramble(sobol_point(matrices.data(), int(d), uint32_t(i)), dimension_seed) >> 24;
+    });
+}
+
+static std::string pointset_cache_dir() {
+    return binary_path("pointset_cache");
+}
+
+// read-only seed shipped with the sources, used until the optimizer wrote one into the cache
+static std::string bn_shipped_seed_path(BNTableConfig const& config) {
+    return rooted_path("rendering/pointsets/" + config.name() + ".seed");
+}
+
+void generate_bn_tables(uint32_t* tables, BNTableConfig const& config) {
+    validate_config(config);
+    if (read_bn_seed(bn_seed_path(config), tables, config)
+        || read_bn_seed(bn_shipped_seed_path(config), tables, config))
+        return;
+    println(CLL::INFORMATION, "No optimized blue noise tables for %s, initializing with white noise", config.name().c_str());
+
+    generate_bn_sequence(tables, config.sample_count, config.dimensions, 0);
+    uint32_t* tiles = tables + size_t(config.sample_count) * config.dimensions;
+    size_t tile_elements = config.tile_elements();
+    // scrambling for 1 spp, then scrambling and ranking pairs for 4, 16, 256 spp
+    int const ranking_spp[7] = { 0, 0, 4, 0, 16, 0, 256 };
+    parallel_for(0, tile_elements, 4096, [&](index_t i, int) {
+        for (int t = 0; t < 7; ++t) {
+            uint32_t value = hash_3(uint32_t(i), uint32_t(t), 0x5eed);
+            if (ranking_spp[t])
+                value &= uint32_t(std::min(ranking_spp[t], config.sample_count) - 1);
+            else
+                value &= 0xffu;
+            tiles[t * tile_elements + i] = value;
+        }
+    });
+}
+
+std::string bn_seed_path(BNTableConfig const& config) {
+    return pointset_cache_dir() + '/' + config.name() + ".seed";
+}
+
+bool read_bn_seed(std::string const& file, uint32_t* tables, BNTableConfig const& config) {
+    if (!file_exists(file))
+        return false;
+    size_t num_elements = config.num_elements();
+    int const config_values[4] = { config.sample_count, config.dimensions, config.scrambling_dimensions, config.tile_size };
+    PointsetTableHeader expected = make_header(POINTSET_TABLE_BN_SEED, config_values, num_elements);
+    try {
+        FileMapping mapping(file);
+        if (mapping.nbytes() != sizeof(expected) + num_elements
+            || memcmp(mapping.data(), &expected, sizeof(expected)) != 0) {
+            warning("Ignoring blue noise seed file %s that does not match %s", file.c_str(), config.name().c_str());
+            return false;
+        }
+        uint8_t const* values = mapping.data() + sizeof(expected);
+        parallel_for(0, num_elements, 1 << 16, [&](index_t i, int) {
+            tables[i] = values[i];
+        });
+    } catch (std::exception const& e) {
+        warning("Failed to read blue noise seed file %s: %s", file.c_str(), e.what());
+        return false;
+    }
+    return true;
+}
+
+void write_bn_seed(std::string const& file, uint32_t const* tables, BNTableConfig const& config) {
+    size_t num_elements = config.num_elements();
+    int const config_values[4] = { config.sample_count, config.dimensions, config.scrambling_dimensions, config.tile_size };
+    PointsetTableHeader header = make_header(POINTSET_TABLE_BN_SEED, config_values, num_elements);
+    std::vector<uint8_t> values(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        if (tables[i] > 0xff)
+            throw_error("Blue noise table entry %u at %zu does not fit into a seed file", tables[i], i);
+        values[i] = uint8_t(tables[i]);
+    }
+
+    size_t dir_end = file.find_last_of("/\\");
+    if (dir_end != std::string::npos && !create_directories(file.substr(0, dir_end)))
+        throw_error("Failed to create directory for blue noise seed file %s", file.c_str());
+    bool success = write_file_atomically(file, [&](FILE* f) {
+        return fwrite(&header, sizeof(header), 1, f) == 1
+            && fwrite(values.data(), 1, values.size(), f) == values.size();
+    });
+    if (!success)
+        throw_error("Failed to write blue noise seed file %s", file.c_str());
+}
+
+template <class Generate>
+static mapped_vector<uint32_t> load_cached_tables(std::string const& name, PointsetTableHeader const& expected, Generate&& generate) {
+    size_t num_elements = size_t(expected.num_elements);
+    size_t num_bytes = num_elements * sizeof(uint32_t);
+    std::string cache_dir = pointset_cache_dir();
+    std::string file = cache_dir + '/' + name + ".bin";
+
+    if (file_exists(file)) {
+        try {
+            FileMapping mapping(file);
+            if (mapping.nbytes() == sizeof(expected) + num_bytes
+                && memcmp(mapping.data(), &expected, sizeof(expected)) == 0)
+                return mapped_vector<uint32_t>(mapping, sizeof(expected), num_bytes);
+            println(CLL::VERBOSE, "Regenerating outdated pointset cache file %s", file.c_str());
+        } catch (std::exception const& e) {
+            warning("Ignoring unreadable pointset cache file %s: %s", file.c_str(), e.what());
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<uint32_t> tables(num_elements);
+    generate(tables.data());
+    auto end = std::chrono::steady_clock::now();
+    println(CLL::INFORMATION, "Generated pointset tables %s in %.1f ms", name.c_str()
+        , std::chrono::duration<double, std::milli>(end - start).count());
+
+    if (create_directories(cache_dir)) {
+        bool success = write_file_atomically(file, [&](FILE* f) {
+            return fwrite(&expected, sizeof(expected), 1, f) == 1
+                && fwrite(tables.data(), sizeof(uint32_t), num_elements, f) == num_elements;
+        });
+        if (!success)
+            warning("Failed to write pointset cache file %s", file.c_str());
+    } else
+        warning("Failed to create pointset cache directory %s", cache_dir.c_str());
+
+    return mapped_vector<uint32_t>(Buffer<uint32_t>(std::move(tables)));
+}
+
+mapped_vector<uint32_t> load_sobol_tables(SobolTableConfig const& config) {
+    validate_config(config);
+    int const config_values[4] = { config.dimensions, config.tile_size, config.invert_dim_0, config.invert_dim_1 };
+    PointsetTableHeader expected = make_header(POINTSET_TABLE_SOBOL, config_values, config.num_elements());
+    return load_cached_tables(config.name(), expected, [&](uint32_t* tables) {
+        generate_sobol_tables(tables, config);
+    });
+}
+
+mapped_vector<uint32_t> load_bn_tables(BNTableConfig const& config) {
+    validate_config(config);
+    int const config_values[4] = { config.sample_count, config.dimensions, config.scrambling_dimensions, config.tile_size };
+    // re-expand the cache when the seed file changes, e.g. after running the optimizer
+    uint64_t seed_timestamp = std::max(get_last_modified(bn_seed_path(config).c_str())
+        , get_last_modified(bn_shipped_seed_path(config).c_str()));
+    PointsetTableHeader expected = make_header(POINTSET_TABLE_BN, config_values, config.num_elements(), seed_timestamp);
+    return load_cached_tables(config.name(), expected, [&](uint32_t* tables) {
+        generate_bn_tables(tables, config);
+    });
+}
@@ -0,0 +1,65 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include "file_mapping.h"
+
+/* Runtime generation of the sampler tables in the layouts of SobolData
+ * (rendering/pointsets/sobol_data.h) and BNData (rendering/pointsets/bn_data.h).
+ * Tables are generated in parallel on first use, written to binary cache files
+ * next to the executable, and memory-mapped from there on subsequent runs.
+ */
+
+struct SobolTableConfig {
+    int dimensions;
+    int tile_size;
+    int invert_dim_0;
+    int invert_dim_1;
+
+    // the layout of SobolData the GPU programs are compiled with
+    static SobolTableConfig compiled();
+    // number of uint32_t entries in the SobolData layout
+    size_t num_elements() const;
+    std::string name() const;
+};
+
+struct BNTableConfig {
+    int sample_count;
+    int dimensions;
+    int scrambling_dimensions;
+    int tile_size;
+
+    // the layout of BNData the GPU programs are compiled with
+    static BNTableConfig compiled();
+    // number of uint32_t entries of one scrambling or ranking tile
+    size_t tile_elements() const;
+    // number of uint32_t entries in the BNData layout
+    size_t num_elements() const;
+    std::string name() const;
+};
+
+// Sobol generator matrices from the Joe-Kuo direction numbers, 32 columns per dimension
+void generate_sobol_matrices(uint32_t* matrices, int dimensions);
+// index of the Sobol point among the first tile_size^2 points that falls into each
+// cell of a tile_size x tile_size grid over the given pair of dimensions, row-major
+void generate_sobol_tile_inversion(uint32_t* inversion_y_x, uint32_t const* matrices, int tile_size, int dim_x, int dim_y);
+void generate_sobol_tables(uint32_t* tables, SobolTableConfig const& config);
+
+// 8 bit Owen-scrambled Sobol sequence, sample-major as in BNData::sobol_spp_d
+void generate_bn_sequence(uint32_t* sobol_spp_d, int sample_count, int dimensions, uint32_t seed);
+// Fills all of BNData. Scrambling and ranking tiles are taken from the seed file at
+// bn_seed_path() in the pointset cache, else from the seed shipped in rendering/pointsets/,
+// otherwise they are initialized with white noise.
+void generate_bn_tables(uint32_t* tables, BNTableConfig const& config);
+
+// Seed files store tables optimized offline, one byte per entry in the BNData layout.
+// bn_seed_path() is where optimize_bn writes by default, next to the cached tables.
+std::string bn_seed_path(BNTableConfig const& config);
+bool read_bn_seed(std::string const& file, uint32_t* tables, BNTableConfig const& config);
+void write_bn_seed(std::string const& file, uint32_t const* tables, BNTableConfig const& config);
+
+// returns the cached tables, generating them on first use
+mapped_vector<uint32_t> load_sobol_tables(SobolTableConfig const& config);
+mapped_vector<uint32_t> load_bn_tables(BNTableConfig const& config);
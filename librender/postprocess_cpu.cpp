@@ -0,0 +1,159 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "postprocess_cpu.h"
+#include "parallel.h"
+#include "error_io.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace glsl {
+    using namespace glm;
+    // shadow the generic min/max of types.h, which are ambiguous with glm's
+    using glm::min;
+    using glm::max;
+    #include "../rendering/language.hpp"
+    // uniform of the uber post pass that color_balance() reads, set per row
+    static thread_local struct { vec3 xyz; } color_balance_operator;
+    #include "../rendering/util.glsl"
+    #include "../rendering/postprocess/tonemapping_utils.glsl"
+    #include "../rendering/postprocess/color_grading_utils.glsl"
+}
+
+// round to nearest as the UNORM framebuffer conversion
+static uint8_t quantize_unorm8(float v) {
+    return uint8_t(std::min(std::max(v, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+static uint32_t float_bits(float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+static float bits_float(uint32_t bits) {
+    float v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+/* Exact 8 bit sRGB quantization without evaluating pow() per channel. The range
+ * [2^-13, 1) is split into buckets by exponent and the upper 7 mantissa bits,
+ * each of which contains at most one transition between the codes that the
+ * scalar linear_to_srgb() and quantize_unorm8() produce. A bucket stores the
+ * code at its lower end and the first value of the next code. Values below the
+ * range quantize to 0, values from 1 up to 255.
+ */
+struct SRGB8Table {
+    static constexpr uint32_t FIRST_BITS = 0x39000000; // 2^-13
+    static constexpr uint32_t END_BITS = 0x3f800000; // 1
+    static constexpr int BUCKET_SHIFT = 16;
+    static constexpr int NUM_BUCKETS = (END_BITS - FIRST_BITS) >> BUCKET_SHIFT;
+
+    float thresholds[NUM_BUCKETS];
+    uint8_t codes[NUM_BUCKETS];
+
+    SRGB8Table() {
+        auto code = [](uint32_t bits) { return quantize_unorm8(glsl::linear_to_srgb(bits_float(bits))); };
+        assert(code(FIRST_BITS - 1) == 0 && code(END_BITS) == 255);
+        for (int b = 0; b < NUM_BUCKETS; ++b) {
+            uint32_t begin = FIRST_BITS + (uint32_t(b) << BUCKET_SHIFT);
+            uint32_t last = begin + (1u << BUCKET_SHIFT) - 1;
+            codes[b] = code(begin);
+            thresholds[b] = INFINITY;
+            if (code(last) == codes[b])
+                continue;
+            assert(code(last) == codes[b] + 1);
+            // first value with the next code, linear_to_srgb() is monotonic
+            while (begin < last) {
+                uint32_t mid = begin + (last - begin) / 2;
+                if (code(mid) > codes[b])
+                    last = mid;
+                else
+                    begin = mid + 1;
+            }
+            thresholds[b] = bits_float(last);
+        }
+    }
+
+    uint8_t quantize(float v) const {
+        if (!(v >= bits_float(FIRST_BITS)))
+            return 0;
+        if (v >= 1.0f)
+            return 255;
+        uint32_t bucket = (float_bits(v) - FIRST_BITS) >> BUCKET_SHIFT;
+        return uint8_t(codes[bucket] + (v >= thresholds[bucket]));
+    }
+};
+
+static SRGB8Table const& srgb8_table() {
+    static SRGB8Table const table;
+    return table;
+}
+
+PostProcessParams postprocess_params(RenderParams const& params) {
+    PostProcessParams pp;
+    pp.exposure = params.exposure;
+    pp.tone_mapping_mode = params.early_tone_mapping_mode;
+    return pp;
+}
+
+/* Applies the display transform up to, optionally, the sRGB encoding, pixel by
+ * pixel with the scalar GLSL, and hands each pixel to store() along with
+ * whether it was transformed.
+ */
+template <class Store>
+static void postprocess_rows(PostProcessParams const& params, bool srgb_encode, int width, int height, int channels,
+    float const* hdr, Store const& store) {
+    if (channels != 3 && channels != 4)
+        throw_error("Post-processing requires 3 or 4 channels, got %d", channels);
+
+    float exposure_scale = std::exp2(params.exposure);
+    bool color_balance = params.color_balance != glm::vec3(1.0f);
+    parallel_for(0, height, 4, [&](index_t y, int) {
+        glsl::color_balance_operator.xyz = params.color_balance;
+        float const* row = hdr + size_t(y) * size_t(width) * channels;
+        for (int x = 0; x < width; ++x) {
+            float const* pixel = row + size_t(x) * channels;
+            glm::vec3 c = glm::vec3(pixel[0], pixel[1], pixel[2]);
+            float alpha = channels == 4 ? pixel[3] : 1.0f;
+            bool processed = alpha >= 0.0f;
+            if (processed) {
+                c *= exposure_scale;
+                if (color_balance)
+                    c = glsl::color_balance(c);
+                if (params.tone_mapping_mode >= 0)
+                    c = glsl::tonemap(params.tone_mapping_mode, c);
+                if (srgb_encode)
+                    c = glsl::linear_to_srgb(c);
+            }
+            store(size_t(y) * size_t(width) + size_t(x), processed, c, std::min(alpha, 1.0f));
+        }
+    });
+}
+
+void postprocess_to_rgba8(PostProcessParams const& params, int width, int height, int channels,
+    float const* hdr, uint8_t* rgba8) {
+    SRGB8Table const* srgb8 = params.srgb_encode ? &srgb8_table() : nullptr;
+    postprocess_rows(params, false, width, height, channels, hdr
+        , [rgba8, srgb8](size_t pixel, bool processed, glm::vec3 const& color, float alpha) {
+        uint8_t* out = rgba8 + pixel * 4;
+        for (int c = 0; c < 3; ++c)
+            out[c] = srgb8 && processed ? srgb8->quantize(color[c]) : quantize_unorm8(color[c]);
+        out[3] = quantize_unorm8(alpha);
+    });
+}
+
+void postprocess_to_rgba32f(PostProcessParams const& params, int width, int height, int channels,
+    float const* hdr, float* rgba) {
+    postprocess_rows(params, params.srgb_encode, width, height, channels, hdr
+        , [rgba](size_t pixel, bool, glm::vec3 const& color, float alpha) {
+        float* out = rgba + pixel * 4;
+        out[0] = color.x;
+        out[1] = color.y;
+        out[2] = color.z;
+        out[3] = alpha;
+    });
+}
@@ -0,0 +1,34 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "render_params.glsl.h"
+
+/* Display transform of the GPU resolve pass for captured linear HDR frames:
+ * exposure, color balance, tone mapping and sRGB encoding, compiled from the
+ * shader sources in rendering/postprocess. Rows are processed in parallel, so
+ * that headless captures can be turned into the displayed images offline.
+ */
+struct PostProcessParams {
+    float exposure = 0.0f;
+    // mode of tonemapping.h, negative values skip tone mapping as in the GPU resolve pass
+    int tone_mapping_mode = -1;
+    // white balance multipliers in LMS space, see color_grading_utils.glsl
+    glm::vec3 color_balance = glm::vec3(1.0f);
+    // false keeps display-referred linear values
+    bool srgb_encode = true;
+};
+
+// the display transform the renderer applies for the given render parameters
+PostProcessParams postprocess_params(RenderParams const& params);
+
+// Converts interleaved linear HDR pixels with 3 or 4 channels to 8 bit RGBA.
+// Pixels with negative alpha are passed through, as the debug views do on the GPU.
+void postprocess_to_rgba8(PostProcessParams const& params, int width, int height, int channels,
+    float const* hdr, uint8_t* rgba8);
+// Same transform without quantization.
+void postprocess_to_rgba32f(PostProcessParams const& params, int width, int height, int channels,
+    float const* hdr, float* rgba);
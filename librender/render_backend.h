@@ -122,6 +122,9 @@ typedef RenderBackend* (*create_backend_function)(Display& display);
 #ifdef ENABLE_VULKAN
 RenderBackend* create_vulkan_backend(Display& display);
 #endif
+#ifdef ENABLE_CPU_BACKEND
+RenderBackend* create_cpu_backend(Display& display);
+#endif
 
 struct RenderExtension {
     unsigned last_initialized_generation = unsigned(~0);
@@ -91,6 +91,10 @@ struct RenderBackendOptions {
         RBO_STAGES_CPU_ONLY) \
     declare(int, rebuild_triangle_budget, RBO_rebuild_triangle_budget_DEFAULT, \
         RBO_STAGES_CPU_ONLY) \
+    declare(bool, enable_lod_selection, false, \
+        RBO_STAGES_CPU_ONLY) \
+    declare(bool, lod_frustum_culling, false, \
+        RBO_STAGES_CPU_ONLY) \
     \
     declare(bool, enable_taa, false, \
         RBO_STAGES_CPU_ONLY) \
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: MIT
 
 #include "scene.h"
+#include "instance_bounds.h"
+#include "parallel.h"
 #include "error_io.h"
 #include <algorithm>
 #include <iostream>
@@ -19,6 +21,53 @@
 #include <map>
 #include <unordered_map>
 
+namespace {
+
+glm::mat4 vks_to_world(float const (&transform)[4][3])
+{
+    glm::mat4x3 tx;
+    std::memcpy(&tx, transform, sizeof(tx));
+
+    static const glm::mat4 vks_flip(glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f),
+        glm::vec4(0.0f, 0.0f, 1.0f, 0.0f),
+        glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
+        glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    return vks_flip * glm::mat4(tx);
+}
+
+// mirrors vkr_dequantize_transform, which uses the conjugate rotation for its transposed layout
+glm::mat4 compose_transform(AnimationKey const &key)
+{
+    float x = key.rotation.x, y = key.rotation.y, z = key.rotation.z, w = -key.rotation.w;
+    float s = key.scale;
+    float transform[4][3] = {
+        { s * (1.0f - 2.0f * (y * y + z * z)), s * 2.0f * (x * y - z * w), s * 2.0f * (x * z + y * w) },
+        { s * 2.0f * (x * y + z * w), s * (1.0f - 2.0f * (x * x + z * z)), s * 2.0f * (y * z - x * w) },
+        { s * 2.0f * (x * z - y * w), s * 2.0f * (y * z + x * w), s * (1.0f - 2.0f * (x * x + y * y)) },
+        { key.translation.x, key.translation.y, key.translation.z }
+    };
+    return vks_to_world(transform);
+}
+
+// shortest-arc spherical interpolation, falls back to nlerp for nearly parallel rotations
+glm::vec4 slerp_rotation(glm::vec4 a, glm::vec4 b, float t)
+{
+    a = glm::normalize(a);
+    b = glm::normalize(b);
+    float cos_theta = glm::dot(a, b);
+    if (cos_theta < 0.0f) {
+        b = -b;
+        cos_theta = -cos_theta;
+    }
+    if (cos_theta > 0.9995f)
+        return glm::normalize(a + t * (b - a));
+    float theta = std::acos(cos_theta);
+    float sin_theta = std::sin(theta);
+    return (std::sin((1.0f - t) * theta) * a + std::sin(t * theta) * b) / sin_theta;
+}
+
+} // namespace
+
 glm::mat4 AnimationData::dequantize(uint32_t index, uint32_t frame) const
 {
     const uint64_t offset = vkr_get_transform_offset(
@@ -30,14 +79,72 @@ glm::mat4 AnimationData::dequantize(uint32_t index, uint32_t frame) const
 
     float transform[4][3];
     vkr_dequantize_transform(transform, quantized.data() + byteOffset);
-    glm::mat4x3 tx;
-    std::memcpy(&tx, transform, sizeof(tx));
+    return vks_to_world(transform);
+}
 
-    static const glm::mat4 vks_flip(glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f),
-        glm::vec4(0.0f, 0.0f, 1.0f, 0.0f),
-        glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
-        glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    return vks_flip * glm::mat4(tx);
+AnimationKey AnimationData::decode(uint32_t index, uint32_t frame) const
+{
+    const uint64_t offset = vkr_get_transform_offset(
+        index,
+        numStaticTransforms,
+        numAnimatedTransforms,
+        frame);
+    const unsigned char *data = quantized.data() + offset * VKR_QUANTIZED_TRANSFORM_SIZE;
+
+    // layout of VKR quantized transforms: float translation[3], float scale, uint16 quaternion[4]
+    AnimationKey key;
+    uint16_t quantized_rotation[4];
+    std::memcpy(&key.translation, data, sizeof(float) * 3);
+    std::memcpy(&key.scale, data + sizeof(float) * 3, sizeof(float));
+    std::memcpy(quantized_rotation, data + sizeof(float) * 4, sizeof(quantized_rotation));
+    for (int i = 0; i < 4; ++i)
+        key.rotation[i] = float(quantized_rotation[i]) * (2.0f / float(0xffff)) - 1.0f;
+    return key;
+}
+
+glm::mat4 AnimationData::transform_at(uint32_t index, double time, bool interpolate) const
+{
+    if (!is_animated(index))
+        return dequantize(index, 0);
+    float blend = 0.0f;
+    uint32_t frame = frame_at(time, blend);
+    if (!interpolate || blend == 0.0f)
+        return dequantize(index, frame);
+
+    uint32_t next_frame = frame + 1 < numFrames ? frame + 1 : 0;
+    AnimationKey a = decode(index, frame);
+    AnimationKey b = decode(index, next_frame);
+    AnimationKey key;
+    key.translation = glm::mix(a.translation, b.translation, blend);
+    key.scale = glm::mix(a.scale, b.scale, blend);
+    key.rotation = slerp_rotation(a.rotation, b.rotation, blend);
+    return compose_transform(key);
+}
+
+bool AnimationData::is_animated(uint32_t index) const
+{
+    return index >= numStaticTransforms && numFrames > 1;
+}
+
+uint32_t AnimationData::frame_at(double time) const
+{
+    float blend;
+    return frame_at(time, blend);
+}
+
+uint32_t AnimationData::frame_at(double time, float &blend) const
+{
+    blend = 0.0f;
+    if (numFrames <= 1 || !(animationStep > 0.0f))
+        return 0;
+    double position = (time - animationStart) / animationStep;
+    double frame = std::floor(position);
+    double wrapped = frame - std::floor(frame / double(numFrames)) * double(numFrames);
+    uint32_t frame_index = uint32_t(wrapped);
+    if (frame_index >= numFrames)
+        return uint32_t(numFrames - 1);
+    blend = float(position - frame);
+    return frame_index;
 }
 
 size_t AnimationData::size_in_bytes() const
@@ -98,7 +205,13 @@ Scene::Scene(const std::vector<std::string> &fnames, SceneLoaderParams const &sc
               int_cast(deduplication_info.num_removed_textures));
     }
 
-    
+    if (scene_params.generate_lods && !scene_params.remove_lods)
+        generate_lods(*this, scene_params.lod_generation);
+    if (scene_params.optimize_meshes)
+        optimize_meshes(*this, scene_params.mesh_optimization);
+
+    update_mesh_bounds(scene_params.conservative_mesh_bounds);
+
     validate();
 }
 
@@ -139,6 +252,31 @@ size_t Scene::total_texture_bytes() const
         });
 }
 
+void Scene::update_mesh_bounds(bool conservative_quantization_bounds)
+{
+    ProfilingScope profile_bounds("Mesh bounds");
+    parallel_for(0, ilen(meshes), 16, [&](index_t i, int) {
+        if (!meshes[i].has_current_bounds())
+            meshes[i].update_bounds(conservative_quantization_bounds);
+    });
+}
+
+AABB Scene::compute_bounds(uint32_t frame) const
+{
+    std::vector<glm::mat4> transforms(instances.size());
+    parallel_for(0, ilen(instances), 1024, [&](index_t i, int) {
+        auto const& inst = instances[i];
+        auto const& animData = animation_data.at(inst.animation_data_index);
+        uint32_t inst_frame = animData.numFrames ? std::min(frame, uint32_t(animData.numFrames - 1)) : 0;
+        transforms[i] = animData.dequantize(inst.transform_index, inst_frame);
+    });
+
+    InstanceBounds instance_bounds;
+    instance_bounds.initialize(*this);
+    instance_bounds.transform(transforms.data());
+    return instance_bounds.scene_bounds();
+}
+
 void Scene::deduplicate(DeduplicationInfo &dedup_info)
 {
     unlink_duplicate_instanced_meshes(dedup_info);
@@ -715,6 +853,8 @@ void Scene::load_vkrs(const std::string &file, SceneLoaderParams::PerFile const*
     animationData.numStaticTransforms = vkrs.numStaticTransforms;
     animationData.numAnimatedTransforms = vkrs.numAnimatedTransforms;
     animationData.numFrames = vkrs.numFrames;
+    animationData.animationStart = vkrs.animationStart;
+    animationData.animationStep = vkrs.animationStep;
     if (vkrs.animationData) {
         animationData.quantized = mapped_vector<unsigned char>(
             std::vector<unsigned char>(vkrs.animationData,
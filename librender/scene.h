@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include "bounds.h"
 #include "camera.h"
 #include "lights.h"
 #include "material.h"
@@ -12,6 +13,8 @@
 #include "types.h"
 #include "image.h"
 #include "file_mapping.h"
+#include "lod_generation.h"
+#include "mesh_optimization.h"
 //#include "phmap.h"
 
 
@@ -20,19 +23,41 @@ struct LodGroup {
     std::vector<float> detail_reduction;
 };
 
+// Decoded quantized transform, the rotation is kept in the stored component order (x, y, z, w)
+struct AnimationKey {
+    glm::vec3 translation;
+    float scale;
+    glm::vec4 rotation;
+};
+
 struct AnimationData {
     mapped_vector<unsigned char> quantized;
     uint64_t numStaticTransforms = 0;
     uint64_t numAnimatedTransforms = 0;
     uint64_t numFrames = 0;
+    float animationStart = 0.0f;
+    float animationStep = 0.0f;
 
     size_t size_in_bytes() const;
     glm::mat4 dequantize(uint32_t index, uint32_t frame) const;
+    bool is_animated(uint32_t index) const;
+    // looping frame index for the given time in seconds
+    uint32_t frame_at(double time) const;
+    // same, also returns the blend weight towards the next (looping) frame
+    uint32_t frame_at(double time, float &blend) const;
+    AnimationKey decode(uint32_t index, uint32_t frame) const;
+    // transform at the given time, interpolates between frames (slerp on the rotation) if requested
+    glm::mat4 transform_at(uint32_t index, double time, bool interpolate = true) const;
 };
 
 struct SceneLoaderParams {
     bool use_deduplication = false;
     bool remove_lods = false;
+    bool conservative_mesh_bounds = false; // bound meshes by their quantization boxes instead of scanning vertices
+    bool generate_lods = false; // simplify large meshes without LoDs into new LoD groups
+    LoDGenerationParams lod_generation;
+    bool optimize_meshes = false; // reorder triangles of static meshes for quad formation
+    MeshOptimizationParams mesh_optimization;
     struct PerFile {
         int remove_first_LODs = 0;
         float instance_pruning_probability = 0.0f;
@@ -82,6 +107,11 @@ struct Scene {
     size_t num_geometries() const;
     // Texture memory
     size_t total_texture_bytes() const;
+    // Recompute cached object-space mesh bounds where outdated (in parallel)
+    void update_mesh_bounds(bool conservative_quantization_bounds = false);
+    // World-space bounds of all instances at the given animation frame
+    // (conservative, based on the quantization boxes of the instanced geometry)
+    AABB compute_bounds(uint32_t frame = 0) const;
 
 private:
     void load_vkrs(const std::string &file, SceneLoaderParams::PerFile const* params = nullptr);
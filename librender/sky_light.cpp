@@ -0,0 +1,232 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "sky_light.h"
+#include "error_io.h"
+#include "file_mapping.h"
+#include "parallel.h"
+#include "util.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "../rendering/lights/sky_model_arhosek/sky_model.h"
+
+namespace glsl {
+    using namespace glm;
+    #include "../rendering/language.hpp"
+
+    #include "../rendering/color/color_matching.h"
+    #include "../rendering/color/color_matching.glsl"
+}
+
+namespace {
+
+// model parameters of one (elevation, turbidity, albedo) triple
+struct SkyModelSample {
+    glm::vec3 configs[9];
+    glm::vec3 radiances;
+    glm::vec3 sun_xyz_radiance;
+};
+
+constexpr int SKY_SAMPLE_FLOATS = int(sizeof(SkyModelSample) / sizeof(float));
+static_assert(sizeof(SkyModelSample) == SKY_SAMPLE_FLOATS * sizeof(float), "table entries must be tightly packed floats");
+
+constexpr uint32_t SKY_CACHE_VERSION = 1;
+constexpr char SKY_CACHE_MAGIC[8] = { 'R', 'P', 'T', 'R', 'S', 'K', 'Y', '\0' };
+
+// The sky model interpolates its datasets linearly between integer turbidities and
+// in albedo, and polynomially in the cube root of the elevation, where the solar
+// radiance is split into 45 pieces. Table nodes are aligned with all of these.
+constexpr int SKY_TABLE_ELEVATIONS = 45 * 3 + 1;
+constexpr int SKY_TABLE_TURBIDITIES = 9 + 1;
+constexpr int SKY_TABLE_ALBEDOS = 3;
+constexpr float SKY_TABLE_MIN_TURBIDITY = 1.0f;
+constexpr float SKY_TABLE_MAX_TURBIDITY = 10.0f;
+
+struct SkyCacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t resolution[3];
+    uint64_t num_elements;
+};
+
+SkyModelSample evaluate_sky_model(float elevation, float turbidity, float albedo) {
+    SkyModelSample sample;
+
+    ArHosekSkyModelState state;
+    arhosek_rgb_skymodelstate_alloc_init(turbidity, albedo, elevation, &state);
+    for (int i = 0; i < 9; ++i)
+        sample.configs[i] = glm::vec3(state.configs[0][i], state.configs[1][i], state.configs[2][i]);
+    sample.radiances = glm::vec3(state.radiances[0], state.radiances[1], state.radiances[2]);
+
+    // integrate the sun spectrum
+    ArHosekSkyModelState sunState;
+    arhosekskymodelstate_alloc_init(state.elevation, state.turbidity, state.albedo, &sunState);
+    glm::vec3 xyz_radiance(0.0f);
+    int numSamples = 0;
+    float last_wavelength = CM_CIE_MIN;
+    for (int i = 0; i < CM_CIE_SAMPLES; ++i) {
+        float wavelength = float(i) * float(CM_CIE_MAX - CM_CIE_MIN) / float(CM_CIE_SAMPLES - 1) + float(CM_CIE_MIN);
+        if (wavelength > 720.0f)
+            break; // higher wavelengths not supported by the sky model
+        float radiance = arhosekskymodel_solar_radiance(&sunState, elevation, 0.0, wavelength);
+        // radiace by default includes scattering
+        radiance -= arhosekskymodel_radiance(&sunState, elevation, 0.0, wavelength);
+        {
+            using namespace glsl;
+            xyz_radiance += glm::vec3(CM_TABLE_X[i], CM_TABLE_Y[i], CM_TABLE_Z[i]) * radiance;
+            ++numSamples;
+            last_wavelength = wavelength;
+        }
+    }
+    xyz_radiance *= float(last_wavelength - CM_CIE_MIN) / float(numSamples);
+    sample.sun_xyz_radiance = xyz_radiance;
+
+    return sample;
+}
+
+SkyLight make_sky_light(glm::vec3 sun_dir, SkyModelSample const& sample, bool has_area_lights) {
+    SkyLight sky;
+    sky.sun_dir = sun_dir;
+    sky.sun_cos_angle = std::cos(glm::radians(0.53f) / 2.0f);
+
+    for (int i = 0; i < 9; ++i)
+        sky.configs[i] = glm::vec4(sample.configs[i], 0.0f);
+    sky.radiances = glm::vec4(sample.radiances, 0.0f);
+
+    glm::vec3 xyz_radiance = sample.sun_xyz_radiance;
+    if (sun_dir.y > 0.0f && all(greaterThanEqual(xyz_radiance, glm::vec3(0.0f))))
+        sky.sun_radiance = glm::vec4(0.01f * glsl::xyz_to_srgb(xyz_radiance), 1.0f);
+    else
+        sky.sun_radiance = glm::vec4(0.0f);
+
+    // the sky is still sampled when the sun is below the horizon
+    sky.sun_radiance.w = has_area_lights ? 0.5f : 1.0f;
+    return sky;
+}
+
+// the elevation argument of the model is passed the sine of the elevation, as in the original code
+float table_elevation(int i) {
+    float t = float(i) / float(SKY_TABLE_ELEVATIONS - 1);
+    return t * t * t * float(M_PI / 2);
+}
+
+float table_turbidity(int i) {
+    return SKY_TABLE_MIN_TURBIDITY + (SKY_TABLE_MAX_TURBIDITY - SKY_TABLE_MIN_TURBIDITY) * float(i) / float(SKY_TABLE_TURBIDITIES - 1);
+}
+
+float table_albedo(int i) {
+    return float(i) / float(SKY_TABLE_ALBEDOS - 1);
+}
+
+size_t table_index(int elevation, int turbidity, int albedo) {
+    return (size_t(elevation) * SKY_TABLE_TURBIDITIES + turbidity) * SKY_TABLE_ALBEDOS + albedo;
+}
+
+void generate_sky_table(SkyModelSample* table) {
+    int num_rows = SKY_TABLE_ELEVATIONS * SKY_TABLE_TURBIDITIES;
+    parallel_for(0, num_rows, 1, [&](index_t row, int) {
+        int e = int(row) / SKY_TABLE_TURBIDITIES;
+        int t = int(row) % SKY_TABLE_TURBIDITIES;
+        for (int a = 0; a < SKY_TABLE_ALBEDOS; ++a)
+            table[table_index(e, t, a)] = evaluate_sky_model(table_elevation(e), table_turbidity(t), table_albedo(a));
+    });
+}
+
+mapped_vector<float> load_sky_table() {
+    size_t num_elements = size_t(SKY_TABLE_ELEVATIONS) * SKY_TABLE_TURBIDITIES * SKY_TABLE_ALBEDOS * SKY_SAMPLE_FLOATS;
+    size_t num_bytes = num_elements * sizeof(float);
+    SkyCacheHeader expected = { };
+    memcpy(expected.magic, SKY_CACHE_MAGIC, sizeof(expected.magic));
+    expected.version = SKY_CACHE_VERSION;
+    expected.resolution[0] = SKY_TABLE_ELEVATIONS;
+    expected.resolution[1] = SKY_TABLE_TURBIDITIES;
+    expected.resolution[2] = SKY_TABLE_ALBEDOS;
+    expected.num_elements = num_elements;
+
+    std::string cache_dir = binary_path("sky_cache");
+    std::string file = cache_dir + "/hosek_wilkie_rgb.bin";
+    if (file_exists(file)) {
+        try {
+            FileMapping mapping(file);
+            if (mapping.nbytes() == sizeof(expected) + num_bytes
+                && memcmp(mapping.data(), &expected, sizeof(expected)) == 0)
+                return mapped_vector<float>(mapping, sizeof(expected), num_bytes);
+            println(CLL::VERBOSE, "Regenerating outdated sky cache file %s", file.c_str());
+        } catch (std::exception const& e) {
+            warning("Ignoring unreadable sky cache file %s: %s", file.c_str(), e.what());
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<float> table(num_elements);
+    generate_sky_table(reinterpret_cast<SkyModelSample*>(table.data()));
+    auto end = std::chrono::steady_clock::now();
+    println(CLL::INFORMATION, "Generated sky model table in %.1f ms"
+        , std::chrono::duration<double, std::milli>(end - start).count());
+
+    if (create_directories(cache_dir)) {
+        bool success = write_file_atomically(file, [&](FILE* f) {
+            return fwrite(&expected, sizeof(expected), 1, f) == 1
+                && fwrite(table.data(), sizeof(float), num_elements, f) == num_elements;
+        });
+        if (!success)
+            warning("Failed to write sky cache file %s", file.c_str());
+    } else
+        warning("Failed to create sky cache directory %s", cache_dir.c_str());
+
+    return mapped_vector<float>(Buffer<float>(std::move(table)));
+}
+
+// grid cell and interpolation weight of a value within [0, cells]
+void locate(float x, int cells, int& i, float& w) {
+    i = std::min(int(x), cells - 1);
+    w = x - float(i);
+}
+
+} // namespace
+
+SkyLight compute_sky_light_direct(SceneConfig const& config, bool has_area_lights) {
+    glm::vec3 sun_dir = glm::normalize(config.sun_dir);
+    float albedo = dot(config.albedo, glm::vec3(0.3333f));
+    return make_sky_light(sun_dir, evaluate_sky_model(sun_dir.y, config.turbidity, albedo), has_area_lights);
+}
+
+SkyLight compute_sky_light(SceneConfig const& config, bool has_area_lights) {
+    glm::vec3 sun_dir = glm::normalize(config.sun_dir);
+    float elevation = sun_dir.y;
+    float turbidity = config.turbidity;
+    float albedo = dot(config.albedo, glm::vec3(0.3333f));
+    // outside of the model domain, keep the exact behavior of the model code
+    if (!(elevation >= 0.0f && turbidity >= SKY_TABLE_MIN_TURBIDITY && turbidity <= SKY_TABLE_MAX_TURBIDITY
+        && albedo >= 0.0f && albedo <= 1.0f))
+        return compute_sky_light_direct(config, has_area_lights);
+
+    static mapped_vector<float> const table = load_sky_table();
+    SkyModelSample const* samples = reinterpret_cast<SkyModelSample const*>(table.data());
+
+    int e, t, a;
+    float we, wt, wa;
+    locate(std::cbrt(elevation / float(M_PI / 2)) * float(SKY_TABLE_ELEVATIONS - 1), SKY_TABLE_ELEVATIONS - 1, e, we);
+    locate((turbidity - SKY_TABLE_MIN_TURBIDITY) / (SKY_TABLE_MAX_TURBIDITY - SKY_TABLE_MIN_TURBIDITY) * float(SKY_TABLE_TURBIDITIES - 1)
+        , SKY_TABLE_TURBIDITIES - 1, t, wt);
+    locate(albedo * float(SKY_TABLE_ALBEDOS - 1), SKY_TABLE_ALBEDOS - 1, a, wa);
+
+    // trilinear interpolation of all model parameters
+    float interpolated[SKY_SAMPLE_FLOATS] = { };
+    for (int corner = 0; corner < 8; ++corner) {
+        int ce = corner & 1, ct = (corner >> 1) & 1, ca = corner >> 2;
+        float w = (ce ? we : 1.0f - we) * (ct ? wt : 1.0f - wt) * (ca ? wa : 1.0f - wa);
+        if (w == 0.0f)
+            continue;
+        float const* values = reinterpret_cast<float const*>(&samples[table_index(e + ce, t + ct, a + ca)]);
+        for (int i = 0; i < SKY_SAMPLE_FLOATS; ++i)
+            interpolated[i] += w * values[i];
+    }
+    SkyModelSample sample;
+    memcpy(&sample, interpolated, sizeof(sample));
+    return make_sky_light(sun_dir, sample, has_area_lights);
+}
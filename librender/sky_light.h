@@ -0,0 +1,29 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include "render_params.glsl.h"
+
+/* Parameters of the analytic Hosek-Wilkie sky and sun for a scene
+ * configuration, in the layout of SkyModelParams and the sun fields of the
+ * GPU scene parameters. Shared by the backends that shade the sky.
+ */
+struct SkyLight {
+    glm::vec4 configs[9];
+    glm::vec4 radiances;
+    glm::vec3 sun_dir;
+    float sun_cos_angle;
+    glm::vec4 sun_radiance; // w: probability of sampling the sun or sky rather than area lights
+};
+
+// maximum relative deviation of the tabulated sky and sun radiance from the model
+constexpr float SKY_LIGHT_TABLE_TOLERANCE = 0.005f;
+
+// Interpolates the model parameters from a table over sun elevation, turbidity and
+// albedo, which is generated in parallel on first use and cached next to the executable.
+// Relative differences to the direct evaluation stay below SKY_LIGHT_TABLE_TOLERANCE.
+SkyLight compute_sky_light(SceneConfig const& config, bool has_area_lights);
+// Evaluates the sky model and integrates the sun spectrum directly.
+SkyLight compute_sky_light_direct(SceneConfig const& config, bool has_area_lights);
@@ -0,0 +1,87 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "sky_sampling.h"
+#include "parallel.h"
+#include <cmath>
+
+namespace glsl {
+    using namespace glm;
+    // shadow the generic min/max of types.h, which are ambiguous with glm's
+    using glm::min;
+    using glm::max;
+    #include "../rendering/language.hpp"
+    #include "../rendering/lights/sky_map.glsl"
+}
+
+// sub-samples per texel and axis when rasterizing the sky
+constexpr int SKY_MAP_SUBSAMPLES = 4;
+
+static void build_cdf(float* cdf, float const* values, int count) {
+    cdf[0] = 0.0f;
+    for (int i = 0; i < count; ++i)
+        cdf[i + 1] = cdf[i] + values[i] / float(count);
+    float total = cdf[count];
+    for (int i = 1; i <= count; ++i)
+        cdf[i] = total > 0.0f ? cdf[i] / total : float(i) / float(count);
+    // exact end point, the samplers never search past it
+    cdf[count] = 1.0f;
+}
+
+void build_sky_sampling_map(SkySamplingMap& map, SkyLight const& sky, int width, int height) {
+    map.width = width;
+    map.height = height;
+    map.data.resize(SKY_MAP_SIZE(size_t(width), size_t(height)));
+    float* marginal_cdf = map.data.data();
+    float* conditional_cdfs = map.data.data() + SKY_MAP_CONDITIONAL_OFFSET(width, height);
+    float* densities = map.data.data() + SKY_MAP_DENSITY_OFFSET(width, height);
+
+    glsl::SkyModelParams params;
+    for (int i = 0; i < 9; ++i)
+        params.configs[i] = sky.configs[i];
+    params.radiances = sky.radiances;
+
+    // luminance times sin(theta) averaged over each texel, i.e. proportional to the solid angle density
+    std::vector<float> row_integrals(height);
+    parallel_for(0, height, 1, [&](index_t row, int) {
+        float* row_values = densities + row * width;
+        for (int col = 0; col < width; ++col) {
+            float sum = 0.0f;
+            for (int sy = 0; sy < SKY_MAP_SUBSAMPLES; ++sy) {
+                for (int sx = 0; sx < SKY_MAP_SUBSAMPLES; ++sx) {
+                    glm::vec2 uv((float(col) + (float(sx) + 0.5f) / SKY_MAP_SUBSAMPLES) / float(width)
+                        , (float(row) + (float(sy) + 0.5f) / SKY_MAP_SUBSAMPLES) / float(height));
+                    glm::vec3 dir = glsl::sky_map_direction(uv);
+                    float radiance = glsl::luminance(glsl::sky_atmosphere_radiance(params, sky.sun_dir, dir));
+                    sum += radiance * std::sin(float(M_PI) * uv.y);
+                }
+            }
+            row_values[col] = sum / float(SKY_MAP_SUBSAMPLES * SKY_MAP_SUBSAMPLES);
+        }
+        build_cdf(conditional_cdfs + row * (width + 1), row_values, width);
+        float row_integral = 0.0f;
+        for (int col = 0; col < width; ++col)
+            row_integral += row_values[col];
+        row_integrals[row] = row_integral / float(width);
+    });
+
+    build_cdf(marginal_cdf, row_integrals.data(), height);
+    float integral = 0.0f;
+    for (int row = 0; row < height; ++row)
+        integral += row_integrals[row] / float(height);
+
+    // normalize to densities over the unit square
+    parallel_for(0, height, 16, [&](index_t row, int) {
+        float* row_values = densities + row * width;
+        for (int col = 0; col < width; ++col)
+            row_values[col] = integral > 0.0f ? row_values[col] / integral : 1.0f;
+    });
+    map.power = 2.0f * float(M_PI * M_PI) * integral;
+}
+
+float sky_sampling_probability(SkySamplingMap const& map, SkyLight const& sky) {
+    float sun_power = glsl::luminance(glm::vec3(sky.sun_radiance)) * 2.0f * float(M_PI) * (1.0f - sky.sun_cos_angle);
+    if (!(map.power > 0.0f))
+        return 0.0f;
+    return map.power / (map.power + sun_power);
+}
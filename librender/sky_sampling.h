@@ -0,0 +1,25 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+#include "sky_light.h"
+
+/* Importance sampling map of the analytic sky for next event estimation.
+ * The sky radiance without the sun disk is rasterized into a low-resolution
+ * lat-long map, from which marginal and conditional CDFs are built, in the
+ * buffer layout of rendering/lights/sky_map.h.glsl.
+ */
+struct SkySamplingMap {
+    int width = 0;
+    int height = 0;
+    std::vector<float> data;
+    // sky luminance integrated over the sphere of directions
+    float power = 0.0f;
+};
+
+// rebuilds the map in parallel, to be called whenever the sky changes
+void build_sky_sampling_map(SkySamplingMap& map, SkyLight const& sky, int width, int height);
+// probability of sampling the sky map rather than the sun disk, proportional to their power
+float sky_sampling_probability(SkySamplingMap const& map, SkyLight const& sky);
@@ -279,6 +279,11 @@ std::unique_ptr<RenderBackend> Shell::create_standard_renderer(std::string const
     else if (name == "vulkan") {
         renderer.reset( create_vulkan_backend(*display) );
     }
+#endif
+#ifdef ENABLE_CPU_BACKEND
+    else if (name == "cpu") {
+        renderer.reset( create_cpu_backend(*display) );
+    }
 #endif
     assert(renderer);
     return renderer;
@@ -12,13 +12,16 @@
 #define GLTF_SUPPORT_TRANSMISSION_ROUGHNESS
 #endif
 
+// Without transmission, tint and material decoding, the functions below are
+// lane-generic (see language_simd.hpp): bsdfs/gltf_bsdf_lanes.hpp evaluates
+// them on packets of rays.
 struct GLTFMaterial {
     vec3 base_color;
-    float metallic;
+    lane_float metallic;
 
-    float specular;
-    float roughness;
-    float ior;
+    lane_float specular;
+    lane_float roughness;
+    lane_float ior;
 #ifdef GLTF_SUPPORT_TINT
     float specular_tint;
 #endif
@@ -31,7 +34,7 @@ struct GLTFMaterial {
     vec3 transmission_color;
 #endif
 
-    uint32_t flags;
+    lane_uint flags;
 };
 
 #ifdef ENABLE_MATERIAL_DECODE
@@ -169,7 +172,7 @@ inline void apply_roughening(GLSL_inout(GLTFMaterial) mat, float roughening) {
 // const dielectricSpecular = ((ior - 1)/(ior + 1))^2
 
 // F = f0 + (1 - f0) * (1 - abs(VdotH))^5
-inline float schlick_weight(float local_cos_theta) {
+inline lane_float schlick_weight(lane_float local_cos_theta) {
     return pow(clamp(1.f - local_cos_theta, 0.f, 1.f), 5);
 }
 
@@ -177,53 +180,51 @@ inline float schlick_weight(float local_cos_theta) {
 // they mention having issues with the Schlick approximation.
 // eta_i: material on incident side's ior
 // eta_t: material on transmitted side's ior
-inline float fresnel_dielectric(float cos_theta_i, float eta_i, float eta_t) {
-    float g = pow2(eta_t) / pow2(eta_i) - 1.f + pow2(cos_theta_i);
-    if (g < 0.f) {
-        return 1.f;
-    }
-    return 0.5f * pow2(g - cos_theta_i) / pow2(g + cos_theta_i)
+inline lane_float fresnel_dielectric(lane_float cos_theta_i, lane_float eta_i, lane_float eta_t) {
+    lane_float g = pow2(eta_t) / pow2(eta_i) - 1.f + pow2(cos_theta_i);
+    lane_float f = 0.5f * pow2(g - cos_theta_i) / pow2(g + cos_theta_i)
         * (1.f + pow2(cos_theta_i * (g + cos_theta_i) - 1.f) / pow2(cos_theta_i * (g - cos_theta_i) + 1.f));
+    return lane_select(g < 0.f, lane_float(1.f), f);
 }
 
 // D_GTR2: Generalized Trowbridge-Reitz with gamma=2 (Burley notes eq. 8)
 // * matches GLTF2:
 // * does not perform microfacet visibility check
 // D = α^2 χ^+(N⋅H) / ( π * ( (N⋅H)^2 (α^2 − 1) + 1)^2 )
-inline float gtr_2(float cos_theta_h, float alpha) {
-    float alpha_sqr = alpha * alpha;
+inline lane_float gtr_2(lane_float cos_theta_h, lane_float alpha) {
+    lane_float alpha_sqr = alpha * alpha;
     return M_1_PI * alpha_sqr
         / pow2(1.f + (alpha_sqr - 1.f) * cos_theta_h * cos_theta_h);
 }
 
-inline float smith_visibility_den1(float n_dot_o, float alpha_sq) {
+inline lane_float smith_visibility_den1(lane_float n_dot_o, lane_float alpha_sq) {
     return abs(n_dot_o) + sqrt(alpha_sq + (1.0f - alpha_sq) * n_dot_o * n_dot_o);
 }
 // V =
 //   χ^+(H⋅L) / ( |N⋅L| + sqrt( α^2 + (1−α^2) (N⋅L)^2 ) )
 // * χ^+(H⋅V) / ( |N⋅V| + sqrt( α^2 + (1−α^2) (N⋅V)^2 ) )
 // note: does not perform microfacet/inout sign checks!
-inline float smith_visibility_ggx(float n_dot_o, float n_dot_i, float alpha_g) {
-    float a = alpha_g * alpha_g;
-    float den_shad = smith_visibility_den1(n_dot_i, a);
-    float den_mask = smith_visibility_den1(n_dot_o, a);
+inline lane_float smith_visibility_ggx(lane_float n_dot_o, lane_float n_dot_i, lane_float alpha_g) {
+    lane_float a = alpha_g * alpha_g;
+    lane_float den_shad = smith_visibility_den1(n_dot_i, a);
+    lane_float den_mask = smith_visibility_den1(n_dot_o, a);
     return 1.f / (den_shad * den_mask);
 }
 
 // converts a 2D random number to a sample on a cylindrical pipe in [(-1, -1, 0), (1, 1, 1)]
 // such samples can easily be converted into spheres, hemispheres, and visible normals
 inline vec3 to_pipe_sample(const vec2 U) {
-    float phi = 2.0f * M_PI * U.x;
-    float x = cos(phi);
-    float y = sin(phi);
-    float h = U.y;
+    lane_float phi = 2.0f * M_PI * U.x;
+    lane_float x = cos(phi);
+    lane_float y = sin(phi);
+    lane_float h = U.y;
     return vec3(x, y, h);
 }
 
 // uniform point sample on the unit sphere
 inline vec3 sample_sphere(vec3 UP) {
-    float cos_theta = UP.z * 2.0f - 1.0f;
-    float sin_theta = sqrt(max(1.0f - cos_theta * cos_theta, 0.0f));
+    lane_float cos_theta = UP.z * 2.0f - 1.0f;
+    lane_float sin_theta = sqrt(max(1.0f - cos_theta * cos_theta, 0.0f));
     return vec3(sin_theta * UP.x, sin_theta * UP.y, cos_theta);
 }
 
@@ -234,23 +235,23 @@ inline vec3 sample_gtr_2_vndf(const vec3 w_o_local, vec2 alpha, const vec3 UP) {
     // warp to the hemisphere configuration
     vec3 wiStd = normalize(vec3(alpha.x * w_o_local.x, alpha.y * w_o_local.y, w_o_local.z));
     // sample a spherical cap in (-wiStd.z, 1]
-    float z = fma((1.0f - UP.z), (1.0f + wiStd.z), -wiStd.z);
-    float sinTheta = sqrt(clamp(1.0f - z * z, 0.0f, 1.0f));
-    float x = sinTheta * UP.x;
-    float y = sinTheta * UP.y;
+    lane_float z = fma((1.0f - UP.z), (1.0f + wiStd.z), -wiStd.z);
+    lane_float sinTheta = sqrt(clamp(1.0f - z * z, 0.0f, 1.0f));
+    lane_float x = sinTheta * UP.x;
+    lane_float y = sinTheta * UP.y;
     // compute half-vector
     vec3 wmStd = vec3(x, y, z) + wiStd;
     
     // warp back to the ellipsoid configuration
     vec3 wm = vec3(wmStd.x * alpha.x, wmStd.y * alpha.y, max(0.0f, wmStd.z));
-    float wmL = length(wm);
+    lane_float wmL = length(wm);
 
     // return final normal
     return wm / wmL;
 }
 
 // does not check visibility!
-inline float gtr_2_vndf_pdf(float n_dot_o, float cos_theta_h, float alpha) {
+inline lane_float gtr_2_vndf_pdf(lane_float n_dot_o, lane_float cos_theta_h, lane_float alpha) {
     return gtr_2(cos_theta_h, alpha)
         // note: (2 * n_dot_o) / n_dot_o * h_dot_o / (4 * h_dot_o) = 0.5
         * (0.5f / smith_visibility_den1(n_dot_o, alpha * alpha));
@@ -260,7 +261,7 @@ inline vec3 gltf_diffuse_basecolor(const GLTFMaterial mat) {
     return (1.0f - mat.metallic) * mat.base_color;
 }
 
-inline vec3 gltf_specular_basecolor(const GLTFMaterial mat, float ior) {
+inline vec3 gltf_specular_basecolor(const GLTFMaterial mat, lane_float ior) {
     // const dielectricSpecular = ((ior - 1)/(ior + 1))^2
     vec3 dielectric_base = vec3( pow2((ior - 1.0f) / (ior + 1.0f)) );
     // f0 = lerp(0.04, baseColor.rgb, metallic)
@@ -272,7 +273,7 @@ inline vec3 gltf_specular_basecolor(const GLTFMaterial mat, float ior) {
     return mix(dielectric_base, mat.base_color, mat.metallic);
 }
 
-inline float gltf_specular_alpha(const GLTFMaterial mat) {
+inline lane_float gltf_specular_alpha(const GLTFMaterial mat) {
     return max(mat.roughness * mat.roughness, 0.002f);
 }
 #ifdef GLTF_SUPPORT_TRANSMISSION_ROUGHNESS
@@ -281,12 +282,15 @@ inline float gltf_transmission_alpha(const GLTFMaterial mat) {
 }
 #endif
 
-inline float gltf_schlick_weight(float local_o_dot_h, float ior) {
-    float f_weight = schlick_weight(local_o_dot_h);
+inline lane_float gltf_schlick_weight(lane_float local_o_dot_h, lane_float ior) {
+    lane_float f_weight = schlick_weight(local_o_dot_h);
     // fix up reflectance towards critical angle, if necessary
-    if (ior < 1.0f) {
-        float cos_critical = sqrt(1.0f - ior * ior);
-        f_weight = mix(f_weight, 1.0f, min((1.0f - local_o_dot_h) / (1.0f - cos_critical), 1.0f));
+    lane_bool below_critical = ior < 1.0f;
+    if (any_lane(below_critical)) {
+        lane_float cos_critical = sqrt(1.0f - ior * ior);
+        f_weight = lane_select(below_critical
+            , mix(f_weight, 1.0f, min((1.0f - local_o_dot_h) / (1.0f - cos_critical), 1.0f))
+            , f_weight);
     }
     return f_weight;
 }
@@ -294,15 +298,17 @@ inline float gltf_schlick_weight(float local_o_dot_h, float ior) {
 inline vec3 gltf_bsdf(const GLTFMaterial mat, const vec3 n,
     const vec3 w_o, const vec3 w_i, const vec3 v_x, const vec3 v_y)
 {
-    float i_dot_n = dot(n, w_i);
-    float o_dot_n = dot(n, w_o);
-    float ior = o_dot_n < 0.0f ? 1.0f / mat.ior : mat.ior;
+    lane_float i_dot_n = dot(n, w_i);
+    lane_float o_dot_n = dot(n, w_o);
+    lane_float ior = lane_select(o_dot_n < 0.0f, 1.0f / mat.ior, mat.ior);
 
-    vec3 w_h;
-    if (i_dot_n * o_dot_n < 0.0f) {
+    vec3 w_h = w_i + w_o;
+    lane_bool transmitted = i_dot_n * o_dot_n < 0.0f;
 #ifndef GLTF_SUPPORT_TRANSMISSION
+    if (all_lanes(transmitted))
         return vec3(0.0f);
 #else
+    if (transmitted) {
         if (!(mat.specular_transmission > 0.f))
             return vec3(0.0f);
         if ((mat.flags & BASE_MATERIAL_ONESIDED) != 0)
@@ -312,32 +318,31 @@ inline vec3 gltf_bsdf(const GLTFMaterial mat, const vec3 n,
         // w_h is on the side of the thinner medium (exterior)
         if (!(dot(w_h, n) > 0.0f))
             return vec3(0.0f);
-#endif
     }
-    else
-        w_h = w_i + w_o;
+#endif
     
     w_h = normalize(w_h);
-    float o_dot_h = dot(w_o, w_h), i_dot_h = dot(w_i, w_h);
+    lane_float o_dot_h = dot(w_o, w_h), i_dot_h = dot(w_i, w_h);
 
     vec3 diffuse = gltf_diffuse_basecolor(mat) * float(M_1_PI);
     vec3 specular = vec3(0.0f);
-    if (mat.ior > 1.0f) { // otherwise assert: mat.specular_transmission == 0
+    lane_bool has_specular = mat.ior > 1.0f;
+    if (any_lane(has_specular)) { // otherwise assert: mat.specular_transmission == 0
         vec3 f0 = gltf_specular_basecolor(mat, mat.ior);
 
-        float specular_alpha = gltf_specular_alpha(mat);
+        lane_float specular_alpha = gltf_specular_alpha(mat);
 #ifdef GLTF_SUPPORT_TRANSMISSION_ROUGHNESS
-        if (i_dot_n * o_dot_n < 0.0f)
+        if (transmitted)
             specular_alpha = gltf_transmission_alpha(mat);
 #endif
-        float specular_refl = gtr_2(dot(n, w_h), specular_alpha);
+        lane_float specular_refl = gtr_2(dot(n, w_h), specular_alpha);
         specular_refl *= smith_visibility_ggx(o_dot_n, i_dot_n, specular_alpha);
         
-        float f_weight = gltf_schlick_weight(abs(o_dot_h), ior);
+        lane_float f_weight = gltf_schlick_weight(abs(o_dot_h), ior);
         vec3 F = mix(f0, vec3(1.0f), f_weight);
 
 #ifdef GLTF_SUPPORT_TRANSMISSION
-        if (i_dot_n * o_dot_n < 0.0f) {
+        if (transmitted) {
             diffuse = vec3(0.0f);
             specular = specular_refl * (1.f - mat.metallic) * mat.specular_transmission * mat.transmission_color * (vec3(1.0f) - F);
             // transmission angle compression
@@ -350,12 +355,16 @@ inline vec3 gltf_bsdf(const GLTFMaterial mat, const vec3 n,
 #else
         { // with or without transmission:
 #endif
-            diffuse *= (vec3(1.0f) - F);
-            specular = specular_refl * F;
+            diffuse = lane_select(has_specular, diffuse * (vec3(1.0f) - F), diffuse);
+            specular = lane_select(has_specular, specular_refl * F, specular);
         }
     }
     
+#ifndef GLTF_SUPPORT_TRANSMISSION
+    return lane_select(transmitted, vec3(0.0f), diffuse + specular);
+#else
     return diffuse + specular;
+#endif
 }
 
 #ifdef GLTF_SUPPORT_TRANSMISSION
@@ -364,15 +373,15 @@ inline vec3 gltf_bsdf(const GLTFMaterial mat, const vec3 n,
     #define GLTF_COMPONENT_COUNT 2
 #endif
 struct GLTFComponentSampler {
-    float weights[GLTF_COMPONENT_COUNT];
+    lane_float weights[GLTF_COMPONENT_COUNT];
 };
-inline GLTFComponentSampler gltf_component_sampler(const GLTFMaterial mat, float ior, vec4 o_dot_h, vec4 visibility, vec3 w_o) {
+inline GLTFComponentSampler gltf_component_sampler(const GLTFMaterial mat, lane_float ior, vec4 o_dot_h, vec4 visibility, vec3 w_o) {
     GLTFComponentSampler components;
-    float specular_base_lum = luminance(gltf_specular_basecolor(mat, mat.ior));
+    lane_float specular_base_lum = luminance(gltf_specular_basecolor(mat, mat.ior));
     // note: these should be caught by common subexpression elimination for MIS PDF!
-    float F0 = mix(specular_base_lum, 1.0f, gltf_schlick_weight(o_dot_h.x, 1.0f));
-    float F1 = mix(specular_base_lum, 1.0f, gltf_schlick_weight(o_dot_h.y, 1.0f));
-    float F2 = mix(specular_base_lum, 1.0f, gltf_schlick_weight(o_dot_h.z, ior));
+    lane_float F0 = mix(specular_base_lum, 1.0f, gltf_schlick_weight(o_dot_h.x, 1.0f));
+    lane_float F1 = mix(specular_base_lum, 1.0f, gltf_schlick_weight(o_dot_h.y, 1.0f));
+    lane_float F2 = mix(specular_base_lum, 1.0f, gltf_schlick_weight(o_dot_h.z, ior));
 
     components.weights[0] = (1.0f - F0) * visibility.x * (1.0f - mat.metallic) * luminance(gltf_diffuse_basecolor(mat));
     components.weights[1] = F1 * visibility.y;
@@ -381,27 +390,25 @@ inline GLTFComponentSampler gltf_component_sampler(const GLTFMaterial mat, float
     components.weights[2] = (1.0f - F2) * visibility.z * (1.0f - mat.metallic) * mat.specular_transmission;
 #endif
 
-    float weight_sum = 0.0f;
+    lane_float weight_sum = 0.0f;
     for (int i = 0; i < GLTF_COMPONENT_COUNT; ++i)
         weight_sum += components.weights[i];
-    if (weight_sum > 0.0f) {
-        for (int i = 0; i < GLTF_COMPONENT_COUNT; ++i)
-            components.weights[i] /= weight_sum;
-    }
-    else
-        components.weights[0] = 1.0f;
+    lane_bool has_weight = weight_sum > 0.0f;
+    for (int i = 0; i < GLTF_COMPONENT_COUNT; ++i)
+        components.weights[i] = lane_select(has_weight, components.weights[i] / weight_sum, components.weights[i]);
+    components.weights[0] = lane_select(has_weight, components.weights[0], lane_float(1.0f));
     return components;
 }
-inline int glft_sample_reuse_component(GLTFComponentSampler components, GLSL_inout(float) rnd, GLSL_out(float) component_probability) {
-    int component = 0;
-    float next_layer_p_base = 0.0f, layer_p_base = 0.0f;
+inline lane_int glft_sample_reuse_component(GLTFComponentSampler components, GLSL_inout(lane_float) rnd, GLSL_out(lane_float) component_probability) {
+    lane_int component = 0;
+    lane_float next_layer_p_base = 0.0f, layer_p_base = 0.0f;
+    component_probability = 0.0f;
     for (int i = 0; i < GLTF_COMPONENT_COUNT; ++i) {
-        float layer_p = components.weights[i];
-        if (layer_p > 0.0f && rnd >= next_layer_p_base) {
-            component = i;
-            component_probability = layer_p;
-            layer_p_base = next_layer_p_base;
-        }
+        lane_float layer_p = components.weights[i];
+        lane_bool selected = layer_p > 0.0f && rnd >= next_layer_p_base;
+        component = lane_select(selected, lane_int(i), component);
+        component_probability = lane_select(selected, layer_p, component_probability);
+        layer_p_base = lane_select(selected, next_layer_p_base, layer_p_base);
         next_layer_p_base += layer_p;
     }
     rnd = min(1.0f, (rnd - layer_p_base) / component_probability);
@@ -411,21 +418,24 @@ inline int glft_sample_reuse_component(GLTFComponentSampler components, GLSL_ino
 // note: this PDF does not actually match the sampling PDF, since not all sampled
 // information can be reconstructed precisely. the layer sampling probabilities
 // may therefore deviate from those used during sampling.
-inline float gltf_wpdf(const GLTFMaterial mat, const vec3 n,
+inline lane_float gltf_wpdf(const GLTFMaterial mat, const vec3 n,
     const vec3 w_o, const vec3 w_i, const vec3 v_x, const vec3 v_y)
 {
-    float i_dot_n = dot(n, w_i);
-    float o_dot_n = dot(n, w_o);
-    float ior = o_dot_n < 0.0f ? 1.0f / mat.ior : mat.ior;
+    lane_float i_dot_n = dot(n, w_i);
+    lane_float o_dot_n = dot(n, w_o);
+    lane_float ior = lane_select(o_dot_n < 0.0f, 1.0f / mat.ior, mat.ior);
 
-    float pdf = M_1_PI * abs(i_dot_n);
+    lane_float pdf = M_1_PI * abs(i_dot_n);
 
-    if (mat.ior > 1.0f) { // otherwise assert: mat.specular_transmission == 0
-        vec3 w_h;
-        if (i_dot_n * o_dot_n < 0.0f) {
+    lane_bool has_specular = mat.ior > 1.0f;
+    if (any_lane(has_specular)) { // otherwise assert: mat.specular_transmission == 0
+        vec3 w_h = w_i + w_o;
+        lane_bool transmitted = i_dot_n * o_dot_n < 0.0f;
 #ifndef GLTF_SUPPORT_TRANSMISSION
-            return 0.0f;
+        if (all_lanes(transmitted && has_specular))
+            return lane_float(0.0f);
 #else
+        if (transmitted) {
             if (!(mat.specular_transmission > 0.f))
                 return 0.0f;
             if ((mat.flags & BASE_MATERIAL_ONESIDED) != 0)
@@ -435,19 +445,17 @@ inline float gltf_wpdf(const GLTFMaterial mat, const vec3 n,
             // w_h is on the side of the thinner medium (exterior)
             if (!(dot(w_h, n) > 0.0f))
                 return 0.0f;
-#endif
         }
-        else
-            w_h = w_i + w_o;
+#endif
         
         w_h = normalize(w_h);
-        float o_dot_h = dot(w_o, w_h), i_dot_h = dot(w_i, w_h);
-        float cos_theta_h = dot(w_h, n);
+        lane_float o_dot_h = dot(w_o, w_h), i_dot_h = dot(w_i, w_h);
+        lane_float cos_theta_h = dot(w_h, n);
 
         vec4 visibility = vec4(0.0f);
         visibility.x = 1.0f;
 
-        float specular_alpha = gltf_specular_alpha(mat);
+        lane_float specular_alpha = gltf_specular_alpha(mat);
         // note: i_dot_n may deviate from actual sampling PDF computations on refraction/reflection mismatch
         visibility.y = 2.0f * abs(i_dot_n) / smith_visibility_den1(i_dot_n, specular_alpha * specular_alpha);
 #ifdef GLTF_SUPPORT_TRANSMISSION
@@ -467,46 +475,49 @@ inline float gltf_wpdf(const GLTFMaterial mat, const vec3 n,
 
 #ifdef GLTF_SUPPORT_TRANSMISSION_ROUGHNESS
         // note: sampling of component does not respect transmission roughness
-        if (i_dot_n * o_dot_n < 0.0f)
+        if (transmitted)
             specular_alpha = transmission_alpha;
 #endif
 
-        float specular = gtr_2_vndf_pdf(o_dot_n, cos_theta_h, specular_alpha);
+        lane_float specular = gtr_2_vndf_pdf(o_dot_n, cos_theta_h, specular_alpha);
 
+        lane_float layered_pdf = pdf * components.weights[0] // diffuse
+            + specular * components.weights[1];
 #ifdef GLTF_SUPPORT_TRANSMISSION
-        if (i_dot_n * o_dot_n < 0.0f) {
+        if (transmitted) {
             // transmission angle compression
             if ((mat.flags & BASE_MATERIAL_ONESIDED) != 0) {
                 float angle_compression = 2.0f * o_dot_h / (i_dot_h * ior + o_dot_h);
                 specular *= angle_compression * angle_compression;
             }
-            pdf = specular * components.weights[2]; // todo: angle compression?!
+            layered_pdf = specular * components.weights[2]; // todo: angle compression?!
         }
-        else
+#else
+        layered_pdf = lane_select(transmitted, lane_float(0.0f), layered_pdf);
 #endif
-        {
-            pdf *= components.weights[0]; // diffuse
-            pdf += specular * components.weights[1];
-        }
+        pdf = lane_select(has_specular, layered_pdf, pdf);
     }
     
     return pdf;
 }
 
 inline vec3 sample_gltf_brdf(const GLTFMaterial mat, const vec3 n, const vec3 w_o,
-    GLSL_out(vec3) w_i, GLSL_out(float) pdf, GLSL_out(float) mis_wpdf,
+    GLSL_out(vec3) w_i, GLSL_out(lane_float) pdf, GLSL_out(lane_float) mis_wpdf,
     vec2 rng_sample, vec2 fresnel_sample, const vec3 v_x, const vec3 v_y)
 {
-    vec3 w_o_local = transpose(mat3(v_x, v_y, n)) * w_o;
+    // transpose(mat3(v_x, v_y, n)) * w_o
+    vec3 w_o_local = vec3(dot(v_x, w_o), dot(v_y, w_o), dot(n, w_o));
 
-    float o_dot_n = w_o_local.z;
+    lane_float o_dot_n = w_o_local.z;
 #ifdef GLTF_SUPPORT_TRANSMISSION
     float ior = o_dot_n < 0.0f ? 1.0f / mat.ior : mat.ior;
     if (o_dot_n < 0.0f)
         w_o_local.z = -w_o_local.z;
+    bool valid = true;
 #else
-    float ior = mat.ior;
-    if (o_dot_n < 0.0f) {
+    lane_float ior = mat.ior;
+    lane_bool valid = !(o_dot_n < 0.0f);
+    if (!any_lane(valid)) {
         pdf = 0.0f;
         return vec3(0.0f);
     }
@@ -519,16 +530,17 @@ inline vec3 sample_gltf_brdf(const GLTFMaterial mat, const vec3 n, const vec3 w_
         w_i_diffuse = -w_i_diffuse;
 #endif
 
-    float specular_alpha = gltf_specular_alpha(mat);
+    lane_float specular_alpha = gltf_specular_alpha(mat);
 
-    int component = 0;
-    float component_selection_pdf = 0.0f;
+    lane_int component = 0;
+    lane_float component_selection_pdf = 0.0f;
     GLTFComponentSampler components;
     vec3 w_h_specular_local;
 #ifdef GLTF_SUPPORT_TRANSMISSION
     vec3 w_h_transmission_local;
 #endif
-    if (mat.ior > 1.0f) {
+    lane_bool has_specular = mat.ior > 1.0f;
+    if (any_lane(has_specular)) {
         vec4 o_dot_h_all = vec4(0.0f);
         vec4 visibility_all = vec4(0.0f);
         // diffuse component
@@ -538,10 +550,10 @@ inline vec3 sample_gltf_brdf(const GLTFMaterial mat, const vec3 n, const vec3 w_
         w_h_specular_local = sample_gtr_2_vndf(w_o_local, vec2(specular_alpha), UP);
         // assert: w_h_specular_local should always be visible
         o_dot_h_all.y = dot(w_o_local, w_h_specular_local);
-        float spec_i_dot_n_local = reflect(-w_o_local, w_h_specular_local).z;
-        visibility_all.y = spec_i_dot_n_local > 0.0f
-            ? 2.0f * spec_i_dot_n_local / smith_visibility_den1(spec_i_dot_n_local, specular_alpha * specular_alpha)
-            : 0.0f;
+        lane_float spec_i_dot_n_local = reflect(-w_o_local, w_h_specular_local).z;
+        visibility_all.y = lane_select(spec_i_dot_n_local > 0.0f
+            , 2.0f * spec_i_dot_n_local / smith_visibility_den1(spec_i_dot_n_local, specular_alpha * specular_alpha)
+            , lane_float(0.0f));
 #ifdef GLTF_SUPPORT_TRANSMISSION
         float transmission_alpha = specular_alpha;
         w_h_transmission_local = w_h_specular_local;
@@ -564,35 +576,45 @@ inline vec3 sample_gltf_brdf(const GLTFMaterial mat, const vec3 n, const vec3 w_
 #endif
 
         components = gltf_component_sampler(mat, ior, o_dot_h_all, visibility_all, w_o);
-        component = glft_sample_reuse_component(components, fresnel_sample.x, component_selection_pdf);
+        component = lane_select(has_specular
+            , glft_sample_reuse_component(components, fresnel_sample.x, component_selection_pdf)
+            , component);
     }
 
-    float cos_theta_h;
+    lane_bool diffuse_component = component == 0;
+    w_i = w_i_diffuse;
+    lane_float cos_theta_h = 0.0f;
+#ifdef GLTF_SUPPORT_TRANSMISSION
     float i_dot_h;
     float o_dot_h;
+#endif
 
-    if (component == 0) {
-        w_i = w_i_diffuse;
-        vec3 w_h = normalize(w_i + w_o);
+    if (any_lane(diffuse_component)) {
+        vec3 w_h = normalize(w_i_diffuse + w_o);
         cos_theta_h = dot(n, w_h);
+#ifdef GLTF_SUPPORT_TRANSMISSION
         i_dot_h = o_dot_h = dot(w_o, w_h);
-    } else {
+#endif
+    }
+    if (!all_lanes(diffuse_component)) {
 #ifdef GLTF_SUPPORT_TRANSMISSION_ROUGHNESS
         if (component == 2) {
             specular_alpha = gltf_transmission_alpha(mat);
             w_h_specular_local = w_h_transmission_local;
         }
 #endif
-        vec3 w_h = w_h_specular_local;
+        vec3 w_h_local = w_h_specular_local;
 #ifdef GLTF_SUPPORT_TRANSMISSION
         if (o_dot_n < 0.0f)
-            w_h.z = -w_h.z; // flip into original frame if necessary
+            w_h_local.z = -w_h_local.z; // flip into original frame if necessary
 #endif
-        cos_theta_h = w_h.z; // negative below hemisphere (angle measured from thinner side)
-        w_h = mat3(v_x, v_y, n) * w_h; // same sign as w_o
-        i_dot_h = o_dot_h = dot(w_o, w_h);
+        // negative below hemisphere (angle measured from thinner side)
+        cos_theta_h = lane_select(diffuse_component, cos_theta_h, w_h_local.z);
+        // mat3(v_x, v_y, n) * w_h_local, same sign as w_o
+        vec3 w_h = v_x * w_h_local.x + v_y * w_h_local.y + n * w_h_local.z;
         // assert: w_h_local should always be visible
 #ifdef GLTF_SUPPORT_TRANSMISSION
+        i_dot_h = o_dot_h = dot(w_o, w_h);
         if (component != 1) {
             if ((mat.flags & BASE_MATERIAL_ONESIDED) != 0) {
                 w_i = refract(-w_o, w_h, 1.0f / ior);
@@ -603,26 +625,26 @@ inline vec3 sample_gltf_brdf(const GLTFMaterial mat, const vec3 n, const vec3 w_
         } else
 #endif
         {
-            w_i = reflect(-w_o, w_h);
+            w_i = lane_select(diffuse_component, w_i, reflect(-w_o, w_h));
         }
     }
-    float i_dot_n = dot(n, w_i);
+    lane_float i_dot_n = dot(n, w_i);
 #ifdef GLTF_SUPPORT_TRANSMISSION
     if ((i_dot_n * o_dot_n > 0.0f) != (component != 2)) {
 #else
-    if (!(i_dot_n > 0.0f)) {
+    valid = valid && i_dot_n > 0.0f;
+    if (!any_lane(valid)) {
 #endif
         pdf = 0.0f;
         return vec3(0.0f);
     }
 
-    float diffuse = M_1_PI * abs(i_dot_n);
-    pdf = diffuse;
+    pdf = M_1_PI * abs(i_dot_n); // diffuse
 
-    if (mat.ior > 1.0f) {
-        pdf *= components.weights[0]; // diffuse
-
-        float specular = gtr_2_vndf_pdf(o_dot_n, cos_theta_h, specular_alpha); // todo: numerical precision, directly evaluate specular contribution :/
+    if (any_lane(has_specular)) {
+        lane_float specular = gtr_2_vndf_pdf(o_dot_n, cos_theta_h, specular_alpha); // todo: numerical precision, directly evaluate specular contribution :/
+        lane_float layered_pdf = pdf * components.weights[0] // diffuse
+            + specular * components.weights[1];
 #ifdef GLTF_SUPPORT_TRANSMISSION
         if (i_dot_n * o_dot_n < 0.0f) {
             // transmission angle compression
@@ -630,18 +652,19 @@ inline vec3 sample_gltf_brdf(const GLTFMaterial mat, const vec3 n, const vec3 w_
                 float angle_compression = 2.0f * o_dot_h / (i_dot_h * ior + o_dot_h);
                 specular *= angle_compression * angle_compression;
             }
-            pdf = specular * components.weights[2];
+            layered_pdf = specular * components.weights[2];
         }
-        else
 #endif
-            pdf += specular * components.weights[1];
+        pdf = lane_select(has_specular, layered_pdf, pdf);
     }
-    if (!(pdf > 0.0f))
+    valid = valid && pdf > 0.0f;
+    pdf = lane_select(valid, pdf, lane_float(0.0f));
+    if (!any_lane(valid))
         return vec3(0.0f);
 
     vec3 result = gltf_bsdf(mat, n, w_o, w_i, v_x, v_y);
     mis_wpdf = gltf_wpdf(mat, n, w_o, w_i, v_x, v_y);
-    return result * abs(i_dot_n) / pdf;
+    return lane_select(valid, result * abs(i_dot_n) / pdf, vec3(0.0f));
 }
 
 #ifndef NO_MATERIAL_REGISTRATION
@@ -0,0 +1,42 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef GLTF_BSDF_LANES_HPP
+#define GLTF_BSDF_LANES_HPP
+
+// gltf_bsdf(), gltf_wpdf() and sample_gltf_brdf() of gltf_bsdf.glsl for packets
+// of 8 and 16 shading points, in namespaces lanes8 and lanes16. The lane-generic
+// GLSL source is included once more with the lane types of language_simd.hpp,
+// so there is no second copy of the BSDF. Include in the namespace of the scalar
+// GLSL code, after gltf_bsdf.glsl and language_simd.hpp. Only the reflection
+// model is available, i.e. the configuration without GLTF_SUPPORT_TRANSMISSION
+// that the naive path tracers use.
+
+#if defined(GLTF_SUPPORT_TRANSMISSION) || defined(GLTF_SUPPORT_TINT) || defined(ENABLE_MATERIAL_DECODE)
+#error "glTF BSDF lanes do not support transmission, specular tint or material decoding"
+#endif
+
+// copies a scalar GLTFMaterial into lane i of a packet
+template <class MaterialLanes, class Material>
+inline void set_material_lane(MaterialLanes& packet, int i, Material const& mat) {
+    packet.base_color.set_lane(i, mat.base_color);
+    packet.metallic[i] = mat.metallic;
+    packet.specular[i] = mat.specular;
+    packet.roughness[i] = mat.roughness;
+    packet.ior[i] = mat.ior;
+    packet.flags[i] = mat.flags;
+}
+
+namespace lanes8 {
+SIMD_LANES_GLSL_TYPES(8)
+#undef GLTF_BSDF_GLSL
+#include "gltf_bsdf.glsl"
+}
+
+namespace lanes16 {
+SIMD_LANES_GLSL_TYPES(16)
+#undef GLTF_BSDF_GLSL
+#include "gltf_bsdf.glsl"
+}
+
+#endif
@@ -59,6 +59,7 @@ endif()
 if (ENABLE_DYNAMIC_MESHES)
   list(APPEND GPU_COMPILE_DEFINITIONS "ENABLE_DYNAMIC_MESHES")
 endif()
+list(APPEND GPU_COMPILE_DEFINITIONS "BNData_TileSize=${BN_TILE_SIZE}" "BNData_SampleCount=${BN_SAMPLE_COUNT}")
 
 # todo: do we want to support multi-config generators here?
 if (CMAKE_BUILD_TYPE MATCHES "Debug|DEBUG")
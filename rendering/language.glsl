@@ -37,6 +37,15 @@
 #define UNROLL_FOR [[unroll]] for
 #define DYNAMIC_FOR [[dont_unroll]] for
 
+// lane-generic code, scalar per invocation (see language_simd.hpp)
+#define lane_bool bool
+#define lane_int int
+#define lane_uint uint
+#define lane_float float
+#define lane_select(mask, a, b) ((mask) ? (a) : (b))
+#define any_lane(mask) (mask)
+#define all_lanes(mask) (mask)
+
 #define inline
 
 inline vec2 fma2(vec2 a, vec2 b, vec2 c) {
@@ -24,6 +24,23 @@
 #define UNROLL_FOR for // todo: specialize for CUDA?
 #define DYNAMIC_FOR for // todo: specialize for CUDA?
 
+// lane-generic code, scalar here (see language_simd.hpp for packets)
+typedef bool lane_bool;
+typedef int lane_int;
+typedef uint32_t lane_uint;
+typedef float lane_float;
+
+template <class T>
+inline T lane_select(bool mask, T const& a, T const& b) {
+    return mask ? a : b;
+}
+inline bool any_lane(bool mask) {
+    return mask;
+}
+inline bool all_lanes(bool mask) {
+    return mask;
+}
+
 inline vec2 fma2(vec2 a, vec2 b, vec2 c) {
     return vec2(
           fma(a.x, b.x, c.x)
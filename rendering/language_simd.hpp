@@ -0,0 +1,352 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef GLSL_LANGUAGE_SIMD_ADAPTER
+#define GLSL_LANGUAGE_SIMD_ADAPTER
+
+// SIMD lane types for evaluating shading code on packets of N rays at once, in
+// structure-of-arrays layout. Every operation is a fixed-trip loop over the
+// lanes without branches, which the compiler maps to 8- or 16-wide vector
+// instructions. Include after language.hpp in the namespace of the GLSL code.
+//
+// Lane-generic GLSL code declares per-ray values as lane_bool, lane_int,
+// lane_uint, lane_float and vecN, and masks its control flow: conditions on
+// per-ray values are merged with lane_select(), and branches and early returns
+// are guarded by any_lane() or all_lanes() of the masks. language.glsl and
+// language.hpp map these names to plain scalar code. SIMD_LANES_GLSL_TYPES(N)
+// maps them to the lane types below, so that the same GLSL source included
+// again in a nested namespace runs on packets (see bsdfs/gltf_bsdf_lanes.hpp).
+
+#include <cmath>
+#include <cstdint>
+
+#define SIMD_LANES_FOR(i, N) for (int i = 0; i < N; ++i)
+
+// functions are found through argument-dependent lookup, so they do not hide the scalar overloads
+namespace simd_lanes {
+
+template <int N>
+struct bool_lanes {
+    static_assert(N > 0 && N % 4 == 0, "lane count must be a multiple of 4");
+    alignas(N * 4 > 64 ? 64 : N * 4) int32_t m[N]; // 0 or ~0 per lane
+
+    bool_lanes() = default;
+    bool_lanes(bool b) { SIMD_LANES_FOR(i, N) m[i] = b ? ~0 : 0; }
+
+    bool lane(int i) const { return m[i] != 0; }
+    void set_lane(int i, bool b) { m[i] = b ? ~0 : 0; }
+};
+
+template <int N>
+struct float_lanes {
+    alignas(N * 4 > 64 ? 64 : N * 4) float v[N];
+
+    float_lanes() = default;
+    float_lanes(float f) { SIMD_LANES_FOR(i, N) v[i] = f; }
+
+    float& operator[](int i) { return v[i]; }
+    float operator[](int i) const { return v[i]; }
+};
+
+// conversions truncate like the GLSL constructors int(f) and uint(f)
+template <int N, class T = int32_t>
+struct int_lanes {
+    alignas(N * 4 > 64 ? 64 : N * 4) T v[N];
+
+    int_lanes() = default;
+    int_lanes(T n) { SIMD_LANES_FOR(i, N) v[i] = n; }
+    explicit int_lanes(float_lanes<N> const& f) { SIMD_LANES_FOR(i, N) v[i] = T(f.v[i]); }
+    template <class U>
+    explicit int_lanes(int_lanes<N, U> const& n) { SIMD_LANES_FOR(i, N) v[i] = T(n.v[i]); }
+
+    T& operator[](int i) { return v[i]; }
+    T operator[](int i) const { return v[i]; }
+};
+
+template <int N>
+struct vec2_lanes {
+    float_lanes<N> x, y;
+
+    vec2_lanes() = default;
+    vec2_lanes(float_lanes<N> const& f) : x(f), y(f) { }
+    vec2_lanes(float_lanes<N> const& x, float_lanes<N> const& y) : x(x), y(y) { }
+    vec2_lanes(vec2 const& c) : x(c.x), y(c.y) { }
+
+    vec2 lane(int i) const { return vec2(x[i], y[i]); }
+    void set_lane(int i, vec2 const& c) { x[i] = c.x; y[i] = c.y; }
+};
+
+template <int N>
+struct vec3_lanes {
+    float_lanes<N> x, y, z;
+
+    vec3_lanes() = default;
+    vec3_lanes(float_lanes<N> const& f) : x(f), y(f), z(f) { }
+    vec3_lanes(float_lanes<N> const& x, float_lanes<N> const& y, float_lanes<N> const& z) : x(x), y(y), z(z) { }
+    vec3_lanes(vec3 const& c) : x(c.x), y(c.y), z(c.z) { }
+
+    vec3 lane(int i) const { return vec3(x[i], y[i], z[i]); }
+    void set_lane(int i, vec3 const& c) { x[i] = c.x; y[i] = c.y; z[i] = c.z; }
+};
+
+template <int N>
+struct vec4_lanes {
+    float_lanes<N> x, y, z, w;
+
+    vec4_lanes() = default;
+    vec4_lanes(float_lanes<N> const& f) : x(f), y(f), z(f), w(f) { }
+    vec4_lanes(float_lanes<N> const& x, float_lanes<N> const& y, float_lanes<N> const& z, float_lanes<N> const& w) : x(x), y(y), z(z), w(w) { }
+};
+
+// masks
+
+template <int N> inline bool_lanes<N> operator&&(bool_lanes<N> const& a, bool_lanes<N> const& b) {
+    bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = a.m[i] & b.m[i]; return r;
+}
+template <int N> inline bool_lanes<N> operator||(bool_lanes<N> const& a, bool_lanes<N> const& b) {
+    bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = a.m[i] | b.m[i]; return r;
+}
+template <int N> inline bool_lanes<N> operator!(bool_lanes<N> const& a) {
+    bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = ~a.m[i]; return r;
+}
+template <int N> inline bool_lanes<N> operator!=(bool_lanes<N> const& a, bool_lanes<N> const& b) {
+    bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = a.m[i] ^ b.m[i]; return r;
+}
+template <int N> inline bool any_lane(bool_lanes<N> const& a) {
+    int32_t r = 0; SIMD_LANES_FOR(i, N) r |= a.m[i]; return r != 0;
+}
+template <int N> inline bool all_lanes(bool_lanes<N> const& a) {
+    int32_t r = ~0; SIMD_LANES_FOR(i, N) r &= a.m[i]; return r != 0;
+}
+
+// integers
+
+template <int N, class T> inline bool_lanes<N> operator==(int_lanes<N, T> const& a, T b) {
+    bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = a.v[i] == b ? ~0 : 0; return r;
+}
+template <int N, class T> inline bool_lanes<N> operator!=(int_lanes<N, T> const& a, T b) {
+    bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = a.v[i] != b ? ~0 : 0; return r;
+}
+template <int N, class T> inline int_lanes<N, T> min(int_lanes<N, T> const& a, T b) {
+    int_lanes<N, T> r; SIMD_LANES_FOR(i, N) r.v[i] = b < a.v[i] ? b : a.v[i]; return r;
+}
+
+// float arithmetic
+
+#define SIMD_LANES_BINARY_OP(op) \
+    template <int N> inline float_lanes<N> operator op(float_lanes<N> const& a, float_lanes<N> const& b) { \
+        float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = a.v[i] op b.v[i]; return r; \
+    } \
+    template <int N> inline float_lanes<N> operator op(float a, float_lanes<N> const& b) { \
+        float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = a op b.v[i]; return r; \
+    } \
+    template <int N> inline float_lanes<N> operator op(float_lanes<N> const& a, float b) { \
+        float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = a.v[i] op b; return r; \
+    } \
+    template <int N> inline float_lanes<N>& operator op##=(float_lanes<N>& a, float_lanes<N> const& b) { \
+        SIMD_LANES_FOR(i, N) { a.v[i] op##= b.v[i]; } return a; \
+    } \
+    template <int N> inline float_lanes<N>& operator op##=(float_lanes<N>& a, float b) { \
+        SIMD_LANES_FOR(i, N) { a.v[i] op##= b; } return a; \
+    }
+SIMD_LANES_BINARY_OP(+)
+SIMD_LANES_BINARY_OP(-)
+SIMD_LANES_BINARY_OP(*)
+SIMD_LANES_BINARY_OP(/)
+#undef SIMD_LANES_BINARY_OP
+
+template <int N> inline float_lanes<N> operator-(float_lanes<N> const& a) {
+    float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = -a.v[i]; return r;
+}
+
+#define SIMD_LANES_COMPARE_OP(op) \
+    template <int N> inline bool_lanes<N> operator op(float_lanes<N> const& a, float_lanes<N> const& b) { \
+        bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = a.v[i] op b.v[i] ? ~0 : 0; return r; \
+    } \
+    template <int N> inline bool_lanes<N> operator op(float_lanes<N> const& a, float b) { \
+        bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = a.v[i] op b ? ~0 : 0; return r; \
+    }
+SIMD_LANES_COMPARE_OP(<)
+SIMD_LANES_COMPARE_OP(<=)
+SIMD_LANES_COMPARE_OP(>)
+SIMD_LANES_COMPARE_OP(>=)
+SIMD_LANES_COMPARE_OP(==)
+#undef SIMD_LANES_COMPARE_OP
+
+// per-lane a if mask else b, replaces both branches of an if and the ternary operator
+template <int N> inline float_lanes<N> lane_select(bool_lanes<N> const& mask, float_lanes<N> const& a, float_lanes<N> const& b) {
+    float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = mask.m[i] ? a.v[i] : b.v[i]; return r;
+}
+template <int N> inline bool_lanes<N> lane_select(bool_lanes<N> const& mask, bool_lanes<N> const& a, bool_lanes<N> const& b) {
+    bool_lanes<N> r; SIMD_LANES_FOR(i, N) r.m[i] = (mask.m[i] & a.m[i]) | (~mask.m[i] & b.m[i]); return r;
+}
+template <int N, class T> inline int_lanes<N, T> lane_select(bool_lanes<N> const& mask, int_lanes<N, T> const& a, int_lanes<N, T> const& b) {
+    int_lanes<N, T> r; SIMD_LANES_FOR(i, N) r.v[i] = mask.m[i] ? a.v[i] : b.v[i]; return r;
+}
+template <int N> inline vec2_lanes<N> lane_select(bool_lanes<N> const& mask, vec2_lanes<N> const& a, vec2_lanes<N> const& b) {
+    return vec2_lanes<N>(lane_select(mask, a.x, b.x), lane_select(mask, a.y, b.y));
+}
+template <int N> inline vec3_lanes<N> lane_select(bool_lanes<N> const& mask, vec3_lanes<N> const& a, vec3_lanes<N> const& b) {
+    return vec3_lanes<N>(lane_select(mask, a.x, b.x), lane_select(mask, a.y, b.y), lane_select(mask, a.z, b.z));
+}
+
+// float functions
+
+#define SIMD_LANES_UNARY_FN(fn, expr) \
+    template <int N> inline float_lanes<N> fn(float_lanes<N> const& a) { \
+        float_lanes<N> r; SIMD_LANES_FOR(i, N) { float x = a.v[i]; r.v[i] = (expr); } return r; \
+    }
+SIMD_LANES_UNARY_FN(sqrt, std::sqrt(x))
+SIMD_LANES_UNARY_FN(abs, std::fabs(x))
+SIMD_LANES_UNARY_FN(cos, std::cos(x))
+SIMD_LANES_UNARY_FN(sin, std::sin(x))
+SIMD_LANES_UNARY_FN(log2, std::log2(x))
+SIMD_LANES_UNARY_FN(exp2, std::exp2(x))
+SIMD_LANES_UNARY_FN(pow2, x * x)
+#undef SIMD_LANES_UNARY_FN
+
+#define SIMD_LANES_BINARY_FN(fn, expr) \
+    template <int N> inline float_lanes<N> fn(float_lanes<N> const& a, float_lanes<N> const& b) { \
+        float_lanes<N> r; SIMD_LANES_FOR(i, N) { float x = a.v[i], y = b.v[i]; r.v[i] = (expr); } return r; \
+    } \
+    template <int N> inline float_lanes<N> fn(float_lanes<N> const& a, float y) { \
+        float_lanes<N> r; SIMD_LANES_FOR(i, N) { float x = a.v[i]; r.v[i] = (expr); } return r; \
+    } \
+    template <int N> inline float_lanes<N> fn(float x, float_lanes<N> const& b) { \
+        float_lanes<N> r; SIMD_LANES_FOR(i, N) { float y = b.v[i]; r.v[i] = (expr); } return r; \
+    }
+SIMD_LANES_BINARY_FN(min, y < x ? y : x)
+SIMD_LANES_BINARY_FN(max, x < y ? y : x)
+#undef SIMD_LANES_BINARY_FN
+
+template <int N> inline float_lanes<N> clamp(float_lanes<N> const& a, float lo, float hi) {
+    return min(max(a, float_lanes<N>(lo)), float_lanes<N>(hi));
+}
+template <int N> inline float_lanes<N> fma(float_lanes<N> const& a, float_lanes<N> const& b, float_lanes<N> const& c) {
+    float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = a.v[i] * b.v[i] + c.v[i]; return r;
+}
+template <int N> inline float_lanes<N> fma(float_lanes<N> const& a, float_lanes<N> const& b, float c) {
+    float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = a.v[i] * b.v[i] + c; return r;
+}
+template <int N> inline float_lanes<N> fma(float_lanes<N> const& a, float b, float c) {
+    float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = a.v[i] * b + c; return r;
+}
+template <int N> inline float_lanes<N> mix(float_lanes<N> const& a, float_lanes<N> const& b, float_lanes<N> const& t) {
+    return a * (1.0f - t) + b * t;
+}
+template <int N> inline float_lanes<N> mix(float_lanes<N> const& a, float b, float_lanes<N> const& t) {
+    return a * (1.0f - t) + b * t;
+}
+// integer powers only, pow(x, 5) as used by Schlick's approximation
+template <int N> inline float_lanes<N> pow(float_lanes<N> const& a, int e) {
+    float_lanes<N> r(1.0f);
+    for (int k = 0; k < e; ++k)
+        r *= a;
+    return r;
+}
+// real exponents, as used by display encodings
+template <int N> inline float_lanes<N> pow(float_lanes<N> const& a, float e) {
+    float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = std::pow(a.v[i], e); return r;
+}
+
+// vector arithmetic
+
+#define SIMD_LANES_VEC_OP(op) \
+    template <int N> inline vec2_lanes<N> operator op(vec2_lanes<N> const& a, vec2_lanes<N> const& b) { \
+        return vec2_lanes<N>(a.x op b.x, a.y op b.y); \
+    } \
+    template <int N> inline vec2_lanes<N> operator op(vec2_lanes<N> const& a, float_lanes<N> const& b) { \
+        return vec2_lanes<N>(a.x op b, a.y op b); \
+    } \
+    template <int N> inline vec3_lanes<N> operator op(vec3_lanes<N> const& a, vec3_lanes<N> const& b) { \
+        return vec3_lanes<N>(a.x op b.x, a.y op b.y, a.z op b.z); \
+    } \
+    template <int N> inline vec3_lanes<N> operator op(vec3_lanes<N> const& a, float_lanes<N> const& b) { \
+        return vec3_lanes<N>(a.x op b, a.y op b, a.z op b); \
+    } \
+    template <int N> inline vec3_lanes<N> operator op(float_lanes<N> const& a, vec3_lanes<N> const& b) { \
+        return vec3_lanes<N>(a op b.x, a op b.y, a op b.z); \
+    } \
+    template <int N> inline vec3_lanes<N> operator op(vec3_lanes<N> const& a, float b) { \
+        return vec3_lanes<N>(a.x op b, a.y op b, a.z op b); \
+    } \
+    template <int N> inline vec3_lanes<N> operator op(float a, vec3_lanes<N> const& b) { \
+        return vec3_lanes<N>(a op b.x, a op b.y, a op b.z); \
+    } \
+    template <int N> inline vec3_lanes<N>& operator op##=(vec3_lanes<N>& a, vec3_lanes<N> const& b) { \
+        a.x op##= b.x; a.y op##= b.y; a.z op##= b.z; return a; \
+    } \
+    template <int N> inline vec3_lanes<N>& operator op##=(vec3_lanes<N>& a, float_lanes<N> const& b) { \
+        a.x op##= b; a.y op##= b; a.z op##= b; return a; \
+    }
+SIMD_LANES_VEC_OP(+)
+SIMD_LANES_VEC_OP(-)
+SIMD_LANES_VEC_OP(*)
+SIMD_LANES_VEC_OP(/)
+#undef SIMD_LANES_VEC_OP
+
+template <int N> inline vec3_lanes<N> operator-(vec3_lanes<N> const& a) {
+    return vec3_lanes<N>(-a.x, -a.y, -a.z);
+}
+
+template <int N> inline float_lanes<N> dot(vec3_lanes<N> const& a, vec3_lanes<N> const& b) {
+    float_lanes<N> r; SIMD_LANES_FOR(i, N) r.v[i] = a.x.v[i] * b.x.v[i] + a.y.v[i] * b.y.v[i] + a.z.v[i] * b.z.v[i]; return r;
+}
+template <int N> inline float_lanes<N> dot(vec2_lanes<N> const& a, vec2_lanes<N> const& b) {
+    return a.x * b.x + a.y * b.y;
+}
+template <int N> inline vec3_lanes<N> cross(vec3_lanes<N> const& a, vec3_lanes<N> const& b) {
+    return vec3_lanes<N>(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+template <int N> inline float_lanes<N> length(vec3_lanes<N> const& a) {
+    return sqrt(dot(a, a));
+}
+template <int N> inline vec3_lanes<N> normalize(vec3_lanes<N> const& a) {
+    return a * (1.0f / length(a));
+}
+template <int N> inline vec3_lanes<N> reflect(vec3_lanes<N> const& i, vec3_lanes<N> const& n) {
+    return i - 2.0f * dot(n, i) * n;
+}
+template <int N> inline vec3_lanes<N> mix(vec3_lanes<N> const& a, vec3_lanes<N> const& b, float_lanes<N> const& t) {
+    return vec3_lanes<N>(mix(a.x, b.x, t), mix(a.y, b.y, t), mix(a.z, b.z, t));
+}
+template <int N> inline vec2_lanes<N> fma2(vec2_lanes<N> const& a, vec2_lanes<N> const& b, vec2_lanes<N> const& c) {
+    return vec2_lanes<N>(fma(a.x, b.x, c.x), fma(a.y, b.y, c.y));
+}
+template <int N> inline vec3_lanes<N> fma3(vec3_lanes<N> const& a, vec3_lanes<N> const& b, vec3_lanes<N> const& c) {
+    return vec3_lanes<N>(fma(a.x, b.x, c.x), fma(a.y, b.y, c.y), fma(a.z, b.z, c.z));
+}
+
+// lane versions of the util.glsl functions used by lane-generic code
+
+template <int N> inline float_lanes<N> luminance(vec3_lanes<N> const& c) {
+    return 0.2126f * c.x + 0.7152f * c.y + 0.0722f * c.z;
+}
+template <int N> inline float_lanes<N> cos_half_angle(float_lanes<N> const& cos_angle) {
+    return (1.0f + cos_angle) / sqrt(2.0f + 2.0f * cos_angle);
+}
+template <int N> inline float_lanes<N> mix_fma(float x, float_lanes<N> const& y, float_lanes<N> const& a) {
+    return fma(a, y, fma(-a, x, x));
+}
+
+} // namespace
+
+using simd_lanes::bool_lanes;
+using simd_lanes::int_lanes;
+using simd_lanes::float_lanes;
+using simd_lanes::vec2_lanes;
+using simd_lanes::vec3_lanes;
+using simd_lanes::vec4_lanes;
+
+// declares the per-ray type names of lane-generic GLSL code for packets of N rays,
+// in a namespace nested in the one holding the scalar GLSL code
+#define SIMD_LANES_GLSL_TYPES(N) \
+    typedef bool_lanes<N> lane_bool; \
+    typedef int_lanes<N> lane_int; \
+    typedef int_lanes<N, uint32_t> lane_uint; \
+    typedef float_lanes<N> lane_float; \
+    typedef vec2_lanes<N> vec2; \
+    typedef vec3_lanes<N> vec3; \
+    typedef vec4_lanes<N> vec4;
+
+#endif
@@ -0,0 +1,29 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef LIGHT_GRID_H_GLSL
+#define LIGHT_GRID_H_GLSL
+
+#define LIGHT_GRID_MAX_CELL_LIGHTS 32
+
+// Sparse spatial grid of per-cell emitter lists over the scene bounds
+struct LightGridParams {
+    GLM(vec3) lower;
+    float global_fraction; // probability of falling back to uniform global selection
+    GLM(vec3) inv_cell_extent;
+    int32_t cell_count;
+    GLM(ivec3) resolution;
+    int32_t entry_count;
+};
+
+struct LightGridCell {
+    uint32_t first_entry;
+    uint32_t entry_count; // 0 for cells without significant emitters
+};
+
+struct LightGridEntry {
+    uint32_t light_index; // index into the binned emitter list
+    float cdf; // inclusive, normalized to 1 at the last entry of a cell
+};
+
+#endif
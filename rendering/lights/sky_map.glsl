@@ -0,0 +1,49 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef SKY_MAP_GLSL
+#define SKY_MAP_GLSL
+
+#include "../defaults.glsl"
+#include "sky_map.h.glsl"
+#include "sky_model_arhosek/sky_model.glsl"
+#include "../util.glsl"
+
+// lower hemisphere directions see the sky mirrored by the ocean,
+// mirrors dir into the upper hemisphere and returns the ocean reflectance
+inline float sky_ocean_mirror(GLSL_inout(vec3) dir) {
+    float ocean_coeff = 1.0f;
+    if (dir.y <= 0.0f) {
+        dir.y = -dir.y;
+        ocean_coeff = 0.7f * pow(max(1.0f - abs(dir.y), 0.0f), 5.0f);
+    }
+    return ocean_coeff;
+}
+
+// sky radiance without the sun disk
+inline vec3 sky_atmosphere_radiance(const SkyModelParams params, vec3 sun_dir, vec3 dir) {
+    float ocean_coeff = sky_ocean_mirror(dir);
+    return max(skymodel_radiance(params, sun_dir, dir), vec3(0.0f)) * ocean_coeff;
+}
+
+inline vec3 sky_map_direction(vec2 uv) {
+    float phi = 2.0f * M_PI * uv.x;
+    float theta = M_PI * uv.y;
+    float sin_theta = sin(theta);
+    return vec3(sin_theta * cos(phi), cos(theta), sin_theta * sin(phi));
+}
+
+inline vec2 sky_map_uv(vec3 dir) {
+    float phi = atan(dir.z, dir.x);
+    if (phi < 0.0f)
+        phi += 2.0f * M_PI;
+    float theta = acos(clamp(dir.y, -1.0f, 1.0f));
+    return vec2(phi / (2.0f * M_PI), theta / M_PI);
+}
+
+// converts densities over the unit square of the map to solid angle
+inline float sky_map_jacobian(float sin_theta) {
+    return sin_theta > 0.0f ? 1.0f / (2.0f * M_PI * M_PI * sin_theta) : 0.0f;
+}
+
+#endif
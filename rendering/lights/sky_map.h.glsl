@@ -0,0 +1,27 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef SKY_MAP_H_GLSL
+#define SKY_MAP_H_GLSL
+
+// Importance sampling map of the sky radiance, over a lat-long parameterization
+// u = phi / 2pi, v = theta / pi with theta measured from the +y zenith.
+// The map buffer holds, for width x height texels:
+//   height + 1 entries of the marginal CDF over rows,
+//   height rows of width + 1 entries of the conditional CDFs over columns,
+//   width * height piecewise constant densities over the unit square of (u, v).
+#define SKY_MAP_DEFAULT_WIDTH 128
+#define SKY_MAP_DEFAULT_HEIGHT 64
+
+#define SKY_MAP_CONDITIONAL_OFFSET(width, height) ((height) + 1)
+#define SKY_MAP_DENSITY_OFFSET(width, height) ((height) + 1 + (height) * ((width) + 1))
+#define SKY_MAP_SIZE(width, height) (SKY_MAP_DENSITY_OFFSET(width, height) + (width) * (height))
+
+struct SkySamplingParams {
+    int32_t map_width;
+    int32_t map_height;
+    float probability; // of sampling the sky map rather than the sun
+    float _pad;
+};
+
+#endif
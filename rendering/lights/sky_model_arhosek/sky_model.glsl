@@ -37,7 +37,7 @@ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-vec3 skymodel_radiance(
+inline vec3 skymodel_radiance(
     const SkyModelParams    state,
     const vec3              sun_dir,
     const vec3              view_dir
@@ -52,7 +52,7 @@ vec3 skymodel_radiance(
     const vec3 mieM = (1.0f + cosGamma * cosGamma) / pow(1.0f + vec3(state.configs[8]*state.configs[8]) - 2.0f * vec3(state.configs[8]) * cosGamma, vec3(1.5f));
     const float zenith = sqrt(cosTheta);
 
-    const vec3 radiance_coeffs = (1.0 + vec3(state.configs[0]) * exp(vec3(state.configs[1]) / (cosTheta + 0.01))) *
+    const vec3 radiance_coeffs = (1.0f + vec3(state.configs[0]) * exp(vec3(state.configs[1]) / (cosTheta + 0.01f))) *
             (vec3(state.configs[2]) + vec3(state.configs[3]) * expM + vec3(state.configs[5]) * rayM + vec3(state.configs[6]) * mieM + vec3(state.configs[7]) * zenith);
 
     return radiance_coeffs * vec3(state.radiances) * 0.01f;
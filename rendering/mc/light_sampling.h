@@ -10,10 +10,12 @@
  */
 #define LIGHT_SAMPLING_VARIANT_NONE 0
 #define LIGHT_SAMPLING_VARIANT_RIS 1
+#define LIGHT_SAMPLING_VARIANT_GRID 2
 
 #define LIGHT_SAMPLING_VARIANT_NAMES \
     "NONE", \
-    "RIS"
+    "RIS", \
+    "GRID"
 
 // note: the default value will be omitted from build command lines
 #define RBO_light_sampling_variant_DEFAULT LIGHT_SAMPLING_VARIANT_RIS
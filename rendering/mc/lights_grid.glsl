@@ -0,0 +1,126 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef LIGHTS_GRID_GLSL
+#define LIGHTS_GRID_GLSL
+
+#include "../language.glsl"
+#include "../lights/light_grid.h.glsl"
+#include "lights_linear.glsl"
+
+// #define SCENE_GET_LIGHT_GRID_PARAMS()
+// #define SCENE_GET_LIGHT_GRID_CELL(cell_id)
+// #define SCENE_GET_LIGHT_GRID_ENTRY(entry_id)
+// #define SCENE_GET_LIGHT_SOURCE_COUNT()
+// #define SCENE_GET_LIGHT_SOURCE()
+
+inline int light_grid_cell_index(const LightGridParams grid, const vec3 p) {
+    ivec3 c = ivec3(floor((p - grid.lower) * grid.inv_cell_extent));
+    c = clamp(c, ivec3(0), grid.resolution - ivec3(1));
+    return (c.z * grid.resolution.y + c.y) * grid.resolution.x + c.x;
+}
+
+// Selection probability of the given light for shading points in the given cell.
+// Lights outside the cell list remain reachable through uniform global selection.
+inline float light_grid_selection_pdf(const LightGridParams grid, const LightGridCell cell, int light_id, int num_lights) {
+    float global_p = cell.entry_count > 0 ? grid.global_fraction : 1.0f;
+    float p = global_p / float(num_lights);
+    float prev_cdf = 0.0f;
+    DYNAMIC_FOR (uint32_t i = 0; i < cell.entry_count; ++i) {
+        LightGridEntry entry = SCENE_GET_LIGHT_GRID_ENTRY(cell.first_entry + i);
+        if (int(entry.light_index) == light_id) {
+            p += (1.0f - global_p) * (entry.cdf - prev_cdf);
+            break;
+        }
+        prev_cdf = entry.cdf;
+    }
+    return p;
+}
+
+// Selects a light for shading point p from its cell list, or uniformly from all lights
+inline int sample_light_grid(const vec3 p, float sel_sample, GLSL_out(float) sel_p) {
+    LightGridParams grid = SCENE_GET_LIGHT_GRID_PARAMS();
+    int num_lights = SCENE_GET_LIGHT_SOURCE_COUNT();
+    LightGridCell cell = SCENE_GET_LIGHT_GRID_CELL(light_grid_cell_index(grid, p));
+
+    float global_p = cell.entry_count > 0 ? grid.global_fraction : 1.0f;
+    int light_id;
+    if (sel_sample < global_p) {
+        light_id = int(sel_sample / global_p * float(num_lights));
+        light_id = min(light_id, num_lights - 1);
+    } else {
+        float u = (sel_sample - global_p) / (1.0f - global_p);
+        uint32_t lo = 0, hi = cell.entry_count - 1;
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) / 2;
+            if (u < SCENE_GET_LIGHT_GRID_ENTRY(cell.first_entry + mid).cdf)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        light_id = int(SCENE_GET_LIGHT_GRID_ENTRY(cell.first_entry + lo).light_index);
+    }
+    sel_p = light_grid_selection_pdf(grid, cell, light_id, num_lights);
+    return light_id;
+}
+
+inline bool ray_hits_tri_light(const TriLight light, const vec3 origin, const vec3 dir) {
+    vec3 e0 = light.v1 - light.v0;
+    vec3 e1 = light.v2 - light.v0;
+    vec3 pv = cross(dir, e1);
+    float det = dot(e0, pv);
+    if (det == 0.0f)
+        return false;
+    vec3 tv = origin - light.v0;
+    vec3 qv = cross(tv, e0);
+    float u = dot(tv, pv) / det;
+    float v = dot(dir, qv) / det;
+    float t = dot(e1, qv) / det;
+    const float EDGE_EPSILON = 1.e-4f;
+    return u >= -EDGE_EPSILON && v >= -EDGE_EPSILON && u + v <= 1.0f + EDGE_EPSILON && t > 0.0f;
+}
+
+// Selection probability of the light seen from shading point origin in direction dir.
+// Emitter hits do not know the light index, the light is identified among the lights
+// of the cell instead; light sampling evaluates the same function for consistent MIS.
+inline float light_grid_ray_selection_pdf(const vec3 origin, const vec3 dir) {
+    LightGridParams grid = SCENE_GET_LIGHT_GRID_PARAMS();
+    int num_lights = SCENE_GET_LIGHT_SOURCE_COUNT();
+    LightGridCell cell = SCENE_GET_LIGHT_GRID_CELL(light_grid_cell_index(grid, origin));
+
+    float global_p = cell.entry_count > 0 ? grid.global_fraction : 1.0f;
+    float p = global_p / float(num_lights);
+    float prev_cdf = 0.0f;
+    DYNAMIC_FOR (uint32_t i = 0; i < cell.entry_count; ++i) {
+        LightGridEntry entry = SCENE_GET_LIGHT_GRID_ENTRY(cell.first_entry + i);
+        if (ray_hits_tri_light(SCENE_GET_LIGHT_SOURCE(int(entry.light_index)), origin, dir)) {
+            p += (1.0f - global_p) * (entry.cdf - prev_cdf);
+            break;
+        }
+        prev_cdf = entry.cdf;
+    }
+    return p;
+}
+
+// Same interface as sample_tri_lights(), selecting the light from the cell of hit_p
+inline vec3 sample_grid_tri_lights(const vec3 hit_p, const vec3 hit_n
+    , vec2 dir_sample, vec2 sel_sample
+    , GLSL_out(vec3) light_dir, GLSL_out(float) light_dist
+    , GLSL_out(float) pdf, GLSL_out(float) mis_wpdf)
+{
+    float sel_p;
+    int light_id = sample_light_grid(hit_p, sel_sample.x, sel_p);
+    TriLight light = SCENE_GET_LIGHT_SOURCE(light_id);
+    sample_tri_light_direction(light, hit_p, dir_sample, light_dir, light_dist, pdf, mis_wpdf);
+
+    pdf *= sel_p;
+    mis_wpdf *= light_grid_ray_selection_pdf(hit_p, light_dir);
+    return light.radiance / pdf;
+}
+
+// MIS pdf of sample_grid_tri_lights() for the emitter hit from query_point in direction w_i
+inline float approx_grid_tri_lights_pdf(float approx_solid_angle, const vec3 query_point, const vec3 w_i) {
+    return light_grid_ray_selection_pdf(query_point, w_i) / approx_solid_angle;
+}
+
+#endif
@@ -1,6 +1,9 @@
 // Copyright 2023 Intel Corporation.
 // SPDX-License-Identifier: MIT
 
+#ifndef LINEAR_LIGHTS_GLSL
+#define LINEAR_LIGHTS_GLSL
+
 #include "../defaults.glsl"
 #include "../lights/tri.glsl"
 #include "../pathspace.h"
@@ -16,10 +19,49 @@
 uint64_t light_sampling_cycles = 0;
 #endif
 
+// Samples a direction towards the given light, mis_wpdf is the approximate
+// solid angle pdf used for MIS, consistently computable on emitter hits
+// (lane-generic, see lights_linear_lanes.hpp)
+inline void sample_tri_light_direction(const TriLight light, const vec3 hit_p, vec2 dir_sample
+    , GLSL_out(vec3) light_dir, GLSL_out(lane_float) light_dist
+    , GLSL_out(lane_float) pdf, GLSL_out(lane_float) mis_wpdf)
+{
+#define SOLID_ANGLE_SAMPLING
+#ifdef SOLID_ANGLE_SAMPLING
+    vec3 d0 = normalize(light.v0 - hit_p);
+    vec3 d1 = normalize(light.v1 - hit_p);
+    vec3 d2 = normalize(light.v2 - hit_p);
+    vec3 tri_parameters;
+    lane_float polygon_solid_angle = triangle_solid_angle(d0, d1, d2, tri_parameters);
+    light_dir = sample_solid_angle_polygon(d0, d1, d2, polygon_solid_angle, tri_parameters, dir_sample);
+    pdf = 1.0f / polygon_solid_angle;
+
+    vec3 e0 = light.v1 - light.v0;
+    vec3 e1 = light.v2 - light.v0;
+    vec3 e_n = cross(e0, e1);
+    light_dist = dot(light.v0 - hit_p, e_n) / dot(light_dir, e_n);
+    //vec3 light_pos = hit_p + light_dir * light_dist;
+    mis_wpdf = 2.0f * light_dist * light_dist / abs(dot(light_dir, e_n));
+#else
+    vec3 light_pos = sample_tri_light_position(light, dir_sample);
+    light_dir = light_pos - hit_p;
+    light_dist = length(light_dir);
+    light_dir /= light_dist;
+
+    vec3 e0 = light.v1 - light.v0;
+    vec3 e1 = light.v2 - light.v0;
+    vec3 e_n = cross(e0, e1);
+    mis_wpdf = 2.0f * light_dist * light_dist / abs(dot(light_dir, e_n));
+
+    pdf = tri_light_pdf(light, light_pos, hit_p, light_dir);
+#endif
+}
+
+// lane-generic without binned light selection
 inline vec3 sample_tri_lights(const vec3 hit_p, const vec3 hit_n
     , vec2 dir_sample, vec2 sel_sample
-    , GLSL_out(vec3) light_dir, GLSL_out(float) light_dist
-    , GLSL_out(float) pdf, GLSL_out(float) mis_wpdf)
+    , GLSL_out(vec3) light_dir, GLSL_out(lane_float) light_dist
+    , GLSL_out(lane_float) pdf, GLSL_out(lane_float) mis_wpdf)
 {
     int num_lights = SCENE_GET_LIGHT_SOURCE_COUNT();
 
@@ -77,41 +119,12 @@ inline vec3 sample_tri_lights(const vec3 hit_p, const vec3 hit_n
     sel_p *= p;
     sel_sample.y = (sel_sample.y - t) / p + 1.0f;
 #else
-    int light_id = int(uint(sel_sample.x * num_lights));
+    lane_int light_id = lane_int(lane_uint(sel_sample.x * num_lights));
     light_id = min(light_id, num_lights - 1);
     float sel_p = 1.0f / float(num_lights);
 #endif
     TriLight light = SCENE_GET_LIGHT_SOURCE(light_id);
-
-#define SOLID_ANGLE_SAMPLING
-#ifdef SOLID_ANGLE_SAMPLING
-    vec3 d0 = normalize(light.v0 - hit_p);
-    vec3 d1 = normalize(light.v1 - hit_p);
-    vec3 d2 = normalize(light.v2 - hit_p);
-    vec3 tri_parameters;
-    float polygon_solid_angle = triangle_solid_angle(d0, d1, d2, tri_parameters);
-    light_dir = sample_solid_angle_polygon(d0, d1, d2, polygon_solid_angle, tri_parameters, dir_sample);
-    pdf = 1.0f / polygon_solid_angle;
-
-    vec3 e0 = light.v1 - light.v0;
-    vec3 e1 = light.v2 - light.v0;
-    vec3 e_n = cross(e0, e1);
-    light_dist = dot(light.v0 - hit_p, e_n) / dot(light_dir, e_n);
-    //vec3 light_pos = hit_p + light_dir * light_dist;
-    mis_wpdf = 2.0f * light_dist * light_dist / abs(dot(light_dir, e_n));
-#else
-    vec3 light_pos = sample_tri_light_position(light, dir_sample);
-    light_dir = light_pos - hit_p;
-    light_dist = length(light_dir);
-    light_dir /= light_dist;
-
-    vec3 e0 = light.v1 - light.v0;
-    vec3 e1 = light.v2 - light.v0;
-    vec3 e_n = cross(e0, e1);
-    mis_wpdf = 2.0f * light_dist * light_dist / abs(dot(light_dir, e_n));
-
-    pdf = tri_light_pdf(light, light_pos, hit_p, light_dir);
-#endif
+    sample_tri_light_direction(light, hit_p, dir_sample, light_dir, light_dist, pdf, mis_wpdf);
 
 #ifdef PROFILER_CLOCK
     light_sampling_cycles += PROFILER_CLOCK() - start_lights_profiler;
@@ -126,7 +139,7 @@ inline vec3 sample_tri_lights(const vec3 hit_p, const vec3 hit_n
     return 1.0f * light.radiance / pdf;
 }
 
-inline float approx_tri_lights_pdf(float approx_solid_angle) {
+inline lane_float approx_tri_lights_pdf(lane_float approx_solid_angle) {
 #if defined(BINNED_LIGHTS_BIN_MAX_SIZE) && BINNED_LIGHTS_BIN_MAX_SIZE > 1
     int num_bins = SCENE_GET_BINNED_LIGHTS_BIN_COUNT();
     return 1.0f / (float(num_bins) * approx_solid_angle);
@@ -135,3 +148,5 @@ inline float approx_tri_lights_pdf(float approx_solid_angle) {
     return 1.0f / (float(num_lights) * approx_solid_angle);
 #endif
 }
+
+#endif
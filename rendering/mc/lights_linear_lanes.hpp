@@ -0,0 +1,65 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef LINEAR_LIGHTS_LANES_HPP
+#define LINEAR_LIGHTS_LANES_HPP
+
+// sample_tri_lights() and sample_tri_light_direction() of lights_linear.glsl
+// for packets of 8 and 16 shading points, in namespaces lanes8 and lanes16.
+// The lane-generic GLSL sources of lights_linear.glsl and lights/tri.glsl are
+// included once more with the lane types of language_simd.hpp. Include in the
+// namespace of the scalar GLSL code, after lights_linear.glsl and
+// language_simd.hpp. The lights of a packet are gathered lane by lane through
+// the scalar SCENE_GET_LIGHT_SOURCE(); binned light selection is not available.
+
+#if defined(BINNED_LIGHTS_BIN_MAX_SIZE) && BINNED_LIGHTS_BIN_MAX_SIZE > 1
+#error "triangle light lanes do not support binned light selection"
+#endif
+#ifdef PROFILER_CLOCK
+#error "triangle light lanes do not support the light sampling profiler"
+#endif
+
+template <int N>
+struct TriLightLanes {
+    vec3_lanes<N> v0, v1, v2;
+    vec3_lanes<N> radiance;
+};
+
+template <int N>
+inline TriLightLanes<N> gather_tri_lights(int_lanes<N> const& light_id) {
+    TriLightLanes<N> light;
+    SIMD_LANES_FOR(i, N) {
+        TriLight lane_light = SCENE_GET_LIGHT_SOURCE(light_id[i]);
+        light.v0.set_lane(i, lane_light.v0);
+        light.v1.set_lane(i, lane_light.v1);
+        light.v2.set_lane(i, lane_light.v2);
+        light.radiance.set_lane(i, lane_light.radiance);
+    }
+    return light;
+}
+
+#pragma push_macro("SCENE_GET_LIGHT_SOURCE")
+#undef SCENE_GET_LIGHT_SOURCE
+#define SCENE_GET_LIGHT_SOURCE(light_id) gather_tri_lights(light_id)
+
+namespace lanes8 {
+SIMD_LANES_GLSL_TYPES(8)
+typedef TriLightLanes<8> TriLight;
+#undef TRI_LIGHTS_GLSL
+#include "../lights/tri.glsl"
+#undef LINEAR_LIGHTS_GLSL
+#include "lights_linear.glsl"
+}
+
+namespace lanes16 {
+SIMD_LANES_GLSL_TYPES(16)
+typedef TriLightLanes<16> TriLight;
+#undef TRI_LIGHTS_GLSL
+#include "../lights/tri.glsl"
+#undef LINEAR_LIGHTS_GLSL
+#include "lights_linear.glsl"
+}
+
+#pragma pop_macro("SCENE_GET_LIGHT_SOURCE")
+
+#endif
@@ -0,0 +1,65 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef SKY_SAMPLING_GLSL
+#define SKY_SAMPLING_GLSL
+
+#include "../defaults.glsl"
+#include "../lights/sky_map.glsl"
+
+// #define SCENE_GET_SKY_MAP_VALUE(index)
+
+// interval [i, i + 1) of the count + 1 CDF entries at offset that contains u
+inline int sky_map_find_interval(int offset, int count, float u) {
+    int first = 0;
+    int last = count;
+    while (last - first > 1) {
+        int mid = (first + last) / 2;
+        if (SCENE_GET_SKY_MAP_VALUE(offset + mid) <= u)
+            first = mid;
+        else
+            last = mid;
+    }
+    return first;
+}
+
+inline float sky_map_density(int width, int height, vec2 uv) {
+    int col = min(int(uv.x * float(width)), width - 1);
+    int row = min(int(uv.y * float(height)), height - 1);
+    return SCENE_GET_SKY_MAP_VALUE(SKY_MAP_DENSITY_OFFSET(width, height) + row * width + col);
+}
+
+// returns the sky radiance divided by the solid angle pdf
+inline vec3 sample_sky_light(vec2 dir_sample, GLSL_out(vec3) light_dir, GLSL_out(float) pdf) {
+    int width = scene_params.sky_sampling.map_width;
+    int height = scene_params.sky_sampling.map_height;
+
+    int row = sky_map_find_interval(0, height, dir_sample.x);
+    float row_begin = SCENE_GET_SKY_MAP_VALUE(row);
+    float row_width = SCENE_GET_SKY_MAP_VALUE(row + 1) - row_begin;
+    float v = (float(row) + (row_width > 0.0f ? (dir_sample.x - row_begin) / row_width : 0.5f)) / float(height);
+
+    int conditional_offset = SKY_MAP_CONDITIONAL_OFFSET(width, height) + row * (width + 1);
+    int col = sky_map_find_interval(conditional_offset, width, dir_sample.y);
+    float col_begin = SCENE_GET_SKY_MAP_VALUE(conditional_offset + col);
+    float col_width = SCENE_GET_SKY_MAP_VALUE(conditional_offset + col + 1) - col_begin;
+    float u = (float(col) + (col_width > 0.0f ? (dir_sample.y - col_begin) / col_width : 0.5f)) / float(width);
+
+    light_dir = sky_map_direction(vec2(u, v));
+    pdf = SCENE_GET_SKY_MAP_VALUE(SKY_MAP_DENSITY_OFFSET(width, height) + row * width + col)
+        * sky_map_jacobian(sin(M_PI * v));
+    if (!(pdf > 0.0f)) {
+        pdf = 0.0f;
+        return vec3(0.0f);
+    }
+    return sky_atmosphere_radiance(scene_params.sky_params, scene_params.sun_dir, light_dir) / pdf;
+}
+
+inline float eval_sky_light_pdf(const vec3 w_i) {
+    vec2 uv = sky_map_uv(w_i);
+    float sin_theta = sqrt(max(1.0f - w_i.y * w_i.y, 0.0f));
+    return sky_map_density(scene_params.sky_sampling.map_width, scene_params.sky_sampling.map_height, uv)
+        * sky_map_jacobian(sin_theta);
+}
+
+#endif
@@ -14,8 +14,14 @@
 #endif
 
 #include "lights_sun.glsl"
+#ifdef SCENE_GET_SKY_MAP_VALUE
+#include "lights_sky.glsl"
+#endif
 #ifndef DISABLE_AREA_LIGHT_SAMPLING
 #include "lights_linear.glsl"
+#if RBO_light_sampling_variant == LIGHT_SAMPLING_VARIANT_GRID
+#include "lights_grid.glsl"
+#endif
 #endif
 #include "../bsdfs/hit_point.glsl"
 #include "../util.glsl"
@@ -38,34 +44,55 @@ inline vec3 sample_direct_light(const MATERIAL_TYPE mat, GLSL_in(InteractionPoin
     float light_pdf = 0.0f;
     float mis_pdf = aux_info.mis_pdf;
 
-    // sun light
+    // sky, sun and area lights are selected exclusively, the sky independently of the sun;
+    // the selection probabilities match eval_direct_sky/sun_light_pdf and wpdf_direct_tri_light
 #ifndef DISABLE_AREA_LIGHT_SAMPLING
-    if (sel_sample.x <= scene_params.sun_radiance.w) { // note: <= necessary to default to sun in all cases when no other lights
-        sel_sample.x /= scene_params.sun_radiance.w;
+    float env_p = scene_params.sun_radiance.w;
 #else
-    {
+    float env_p = 1.0f;
 #endif
-        illum += sample_sun_light(hit.p, hit.n, scene_params.sun_dir, scene_params.sun_cos_angle, dir_sample, sel_sample, light_dir, light_pdf)
-            * (vec3(scene_params.sun_radiance) / scene_params.sun_radiance.w);
-#ifndef DISABLE_AREA_LIGHT_SAMPLING
-        light_pdf *= scene_params.sun_radiance.w;
+#ifdef SKY_SAMPLING_GLSL
+    float sky_p = env_p * scene_params.sky_sampling.probability;
+#else
+    float sky_p = 0.0f;
 #endif
+    float sun_p = env_p - sky_p;
+
+#ifdef SKY_SAMPLING_GLSL
+    if (sel_sample.x < sky_p) {
+        sel_sample.x /= sky_p;
+        illum += sample_sky_light(dir_sample, light_dir, light_pdf) / sky_p;
+        light_pdf *= sky_p;
         // always use proper light PDF for sky light
         mis_pdf = light_pdf;
     }
+    else
+#endif
+    if (sel_sample.x <= env_p) { // note: <= necessary to default to sun in all cases when no other lights
+        sel_sample.x = sun_p > 0.0f ? min((sel_sample.x - sky_p) / sun_p, 1.0f) : 0.0f;
+        illum += sample_sun_light(hit.p, hit.n, scene_params.sun_dir, scene_params.sun_cos_angle, dir_sample, sel_sample, light_dir, light_pdf)
+            * (sun_p > 0.0f ? vec3(scene_params.sun_radiance) / sun_p : vec3(0.0f));
+        light_pdf *= sun_p;
+        // always use proper light PDF for sun light
+        mis_pdf = light_pdf;
+    }
 #ifndef DISABLE_AREA_LIGHT_SAMPLING
     // tri light
     else {
-        sel_sample.x = (sel_sample.x - scene_params.sun_radiance.w) / (1.0f - scene_params.sun_radiance.w);
+        sel_sample.x = (sel_sample.x - env_p) / (1.0f - env_p);
         
         float tri_mis_wpdf = 0.0f;
+#ifdef LIGHTS_GRID_GLSL
+        illum += sample_grid_tri_lights(hit.p, hit.n, dir_sample, sel_sample, light_dir, light_dist, light_pdf, tri_mis_wpdf)
+#else
         illum += sample_tri_lights(hit.p, hit.n, dir_sample, sel_sample, light_dir, light_dist, light_pdf, tri_mis_wpdf)
-            / (1.0f - scene_params.sun_radiance.w);
-        light_pdf *= 1.0f - scene_params.sun_radiance.w;
+#endif
+            / (1.0f - env_p);
+        light_pdf *= 1.0f - env_p;
 
         // allow overriding MIS pdf
         if (mis_pdf == 0.0f)
-            mis_pdf = tri_mis_wpdf * (1.0f - scene_params.sun_radiance.w);
+            mis_pdf = tri_mis_wpdf * (1.0f - env_p);
     }
 #endif
 
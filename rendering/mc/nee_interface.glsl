@@ -28,11 +28,16 @@ struct NEEQueryPoint {
 struct NEESampledArea {
     float approx_solid_angle;
     int type; // currently ignored, as only triangles
+    // ray that hit the area, for spatially varying light selection
+    vec3 query_point;
+    vec3 w_i;
 };
 inline NEESampledArea no_nee_sampled_area() {
     NEESampledArea area;
     area.approx_solid_angle = 0.0f;
     area.type = -1;
+    area.query_point = vec3(0.0f);
+    area.w_i = vec3(0.0f);
     return area;
 }
 
@@ -44,18 +49,33 @@ inline NEEQueryPoint nee_query_point(const MATERIAL_TYPE mat, GLSL_in(Interactio
 
 #ifdef SUN_LIGHT_GLSL
 inline float eval_direct_sun_light_pdf(NEEQueryPoint query, vec3 w_i) {
-    return scene_params.sun_radiance.w * eval_sun_light_pdf(query.point, query.normal, w_i, scene_params.sun_dir, scene_params.sun_cos_angle);
+    float pdf = scene_params.sun_radiance.w * eval_sun_light_pdf(query.point, query.normal, w_i, scene_params.sun_dir, scene_params.sun_cos_angle);
+#ifdef SKY_SAMPLING_GLSL
+    pdf *= 1.0f - scene_params.sky_sampling.probability;
+#endif
+    return pdf;
+}
+#endif
+
+#ifdef SKY_SAMPLING_GLSL
+inline float eval_direct_sky_light_pdf(NEEQueryPoint query, vec3 w_i) {
+    return scene_params.sun_radiance.w * scene_params.sky_sampling.probability * eval_sky_light_pdf(w_i);
 }
 #endif
 
 #ifdef TRI_LIGHTS_GLSL
-inline float wpdf_direct_tri_light(float approx_solid_angle) {
+// MIS pdf of the emitter hit from query_point in direction w_i
+inline float wpdf_direct_tri_light(float approx_solid_angle, vec3 query_point, vec3 w_i) {
+#ifdef LIGHTS_GRID_GLSL
+    return (1.0f - scene_params.sun_radiance.w) * approx_grid_tri_lights_pdf(approx_solid_angle, query_point, w_i);
+#else
     return (1.0f - scene_params.sun_radiance.w) * approx_tri_lights_pdf(approx_solid_angle);
+#endif
 }
 
 inline float wpdf_direct_light(NEESampledArea light) {
     // if (light.type == LIGHT_TYPE_TRIANGLE) {
-        return wpdf_direct_tri_light(light.approx_solid_angle);
+        return wpdf_direct_tri_light(light.approx_solid_angle, light.query_point, light.w_i);
     //}
 }
 #endif
@@ -4,10 +4,15 @@
 #ifndef BN_DATA_GLSL
 #define BN_DATA_GLSL
 
+// sample count and tile size may be overridden at build time, see BN_SAMPLE_COUNT and BN_TILE_SIZE
+#ifndef BNData_SampleCount
 #define BNData_SampleCount 256
+#endif
 #define BNData_Dimensions 256
 #define BNData_ScramblingDimensions 8
+#ifndef BNData_TileSize
 #define BNData_TileSize 128
+#endif
 
 struct BNData
 {
@@ -13,6 +13,9 @@
 // this mostly makes sense for real-time path tracing at 1 spp + denoising
 #define BN_OPTIMIZED_SPP 1
 #define BN_OPTIMIZED_SPP_SELECT(name) name##_1spp
+#if BN_OPTIMIZED_SPP > BNData_SampleCount
+#error "BN_OPTIMIZED_SPP exceeds the number of samples in the blue noise tables"
+#endif
 
 MAKE_RANDOM_TABLE(BNData, bn_pointset_table)
 // e.g.: #define MAKE_RANDOM_TABLE(TableType, tableName) /
@@ -16,17 +16,17 @@ const mat3x3 LMS_2_LIN_MAT = mat3(
     -4.18120e-2, -1.18169e-1,  1.06867e+0
 );
 
-vec3 linear_to_lms(vec3 x)
+inline vec3 linear_to_lms(vec3 x)
 {
     return x * LIN_2_LMS_MAT;
 }
 
-vec3 lms_to_linear(vec3 x)
+inline vec3 lms_to_linear(vec3 x)
 {
     return x * LMS_2_LIN_MAT;
 }
 
-vec3 color_balance(vec3 linear_color)
+inline vec3 color_balance(vec3 linear_color)
 {
     // Move to lms space
     vec3 lms_color = linear_to_lms(linear_color);
@@ -30,9 +30,20 @@ TriLightData lights[global_num_lights] = {};
 #define SCENE_GET_LIGHT_SOURCE(light_id) decode_tri_light(lights[light_id])
 #define SCENE_GET_LIGHT_SOURCE_COUNT()   int(global_num_lights)
 
-namespace linear_light_selection {
+#include "../lights/light_grid.h.glsl"
+
+LightGridParams light_grid = {};
+LightGridCell light_grid_cells[1] = {};
+LightGridEntry light_grid_entries[1] = {};
+
+#define SCENE_GET_LIGHT_GRID_PARAMS() light_grid
+#define SCENE_GET_LIGHT_GRID_CELL(cell_id) light_grid_cells[cell_id]
+#define SCENE_GET_LIGHT_GRID_ENTRY(entry_id) light_grid_entries[entry_id]
+
+namespace tri_light_selection {
 
 #include "../mc/lights_linear.glsl"
+#include "../mc/lights_grid.glsl"
 
 }
 
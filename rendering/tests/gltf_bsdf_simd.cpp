@@ -0,0 +1,255 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Evaluates sample_gltf_brdf() and triangle light sampling of the lane-generic
+// GLSL code on SIMD lane packets, checks them against the scalar calls, then
+// compares the sample_gltf_brdf() throughput.
+
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace shaders_gltf {
+
+using namespace glm;
+
+#include "../language.hpp"
+#include "../util.glsl"
+#include "../bsdfs/base_material.h.glsl"
+#include "../bsdfs/gltf_bsdf.glsl"
+#include "../lights/tri.glsl"
+
+std::vector<TriLight> const* test_lights = nullptr;
+
+#define SCENE_GET_LIGHT_SOURCE_COUNT() int(test_lights->size())
+#define SCENE_GET_LIGHT_SOURCE(light_id) (*test_lights)[light_id]
+#include "../mc/lights_linear.glsl"
+
+#include "../language_simd.hpp"
+#include "../bsdfs/gltf_bsdf_lanes.hpp"
+#include "../mc/lights_linear_lanes.hpp"
+
+}
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#include "../../util/tests/check.h"
+
+using namespace shaders_gltf;
+
+struct BRDFQuery {
+    GLTFMaterial mat;
+    glm::vec3 n, v_x, v_y, w_o;
+    glm::vec2 rng_sample, fresnel_sample;
+};
+
+struct BRDFResult {
+    glm::vec3 value;
+    glm::vec3 w_i;
+    float pdf;
+    float mis_wpdf;
+};
+
+static std::vector<BRDFQuery> random_queries(int count, float min_roughness) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    auto random_dir = [&]() {
+        float z = 2.0f * u01(rng) - 1.0f;
+        float phi = 2.0f * M_PI * u01(rng);
+        float r = std::sqrt(std::max(1.0f - z * z, 0.0f));
+        return glm::vec3(r * std::cos(phi), r * std::sin(phi), z);
+    };
+    std::vector<BRDFQuery> queries(count);
+    for (auto& q : queries) {
+        q.mat = GLTFMaterial{};
+        q.mat.base_color = glm::vec3(u01(rng), u01(rng), u01(rng));
+        q.mat.metallic = u01(rng) < 0.3f ? 1.0f : u01(rng) * 0.2f;
+        q.mat.specular = 0.5f;
+        q.mat.roughness = min_roughness + (1.0f - min_roughness) * u01(rng);
+        q.mat.ior = u01(rng) < 0.1f ? 1.0f : 1.3f + 0.4f * u01(rng);
+        q.n = random_dir();
+        ortho_basis(q.v_x, q.v_y, q.n);
+        q.w_o = random_dir();
+        // some view directions below the surface exercise the early out
+        if (dot(q.w_o, q.n) < 0.0f && u01(rng) < 0.9f)
+            q.w_o = -q.w_o;
+        q.rng_sample = glm::vec2(u01(rng), u01(rng));
+        q.fresnel_sample = glm::vec2(u01(rng), u01(rng));
+    }
+    return queries;
+}
+
+static void sample_scalar(std::vector<BRDFQuery> const& queries, std::vector<BRDFResult>& results) {
+    for (size_t i = 0; i < queries.size(); ++i) {
+        BRDFQuery const& q = queries[i];
+        BRDFResult& r = results[i];
+        r.pdf = 0.0f;
+        r.mis_wpdf = 0.0f;
+        r.value = sample_gltf_brdf(q.mat, q.n, q.w_o, r.w_i, r.pdf, r.mis_wpdf
+            , q.rng_sample, q.fresnel_sample, q.v_x, q.v_y);
+        if (!(r.pdf > 0.0f))
+            r.mis_wpdf = 0.0f;
+    }
+}
+
+template <int N> struct MaterialLanes;
+template <> struct MaterialLanes<8> { typedef lanes8::GLTFMaterial type; };
+template <> struct MaterialLanes<16> { typedef lanes16::GLTFMaterial type; };
+
+template <int N>
+static void sample_lanes(std::vector<BRDFQuery> const& queries, std::vector<BRDFResult>& results) {
+    for (size_t base = 0; base + N <= queries.size(); base += N) {
+        typename MaterialLanes<N>::type mat;
+        vec3_lanes<N> n, v_x, v_y, w_o;
+        vec2_lanes<N> rng_sample, fresnel_sample;
+        SIMD_LANES_FOR(l, N) {
+            BRDFQuery const& q = queries[base + l];
+            set_material_lane(mat, l, q.mat);
+            n.set_lane(l, q.n);
+            v_x.set_lane(l, q.v_x);
+            v_y.set_lane(l, q.v_y);
+            w_o.set_lane(l, q.w_o);
+            rng_sample.set_lane(l, q.rng_sample);
+            fresnel_sample.set_lane(l, q.fresnel_sample);
+        }
+        vec3_lanes<N> w_i;
+        float_lanes<N> pdf, mis_wpdf;
+        vec3_lanes<N> value = sample_gltf_brdf(mat, n, w_o, w_i, pdf, mis_wpdf, rng_sample, fresnel_sample, v_x, v_y);
+        SIMD_LANES_FOR(l, N) {
+            BRDFResult& r = results[base + l];
+            r.value = value.lane(l);
+            r.w_i = w_i.lane(l);
+            r.pdf = pdf[l];
+            r.mis_wpdf = pdf[l] > 0.0f ? mis_wpdf[l] : 0.0f;
+        }
+    }
+}
+
+static bool close(float a, float b) {
+    return std::fabs(a - b) <= 1.e-3f * std::max(1.0f, std::max(std::fabs(a), std::fabs(b)));
+}
+
+template <int N>
+void test_sample_gltf_brdf_lanes() {
+    // near-specular lobes amplify rounding differences of the half vector, compare moderately rough materials
+    std::vector<BRDFQuery> queries = random_queries(N * 20000, 0.25f);
+    std::vector<BRDFResult> scalar(queries.size()), lanes(queries.size());
+    sample_scalar(queries, scalar);
+    sample_lanes<N>(queries, lanes);
+
+    int mismatches = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        BRDFResult const& s = scalar[i];
+        BRDFResult const& l = lanes[i];
+        bool valid = s.pdf > 0.0f;
+        bool match = valid == (l.pdf > 0.0f);
+        if (match && valid) {
+            match = close(s.pdf, l.pdf) && close(s.mis_wpdf, l.mis_wpdf);
+            for (int c = 0; c < 3; ++c)
+                match = match && close(s.value[c], l.value[c]) && close(s.w_i[c], l.w_i[c]);
+        }
+        mismatches += !match;
+    }
+    // vectorized code may round differently and flip the component choice right at a selection boundary
+    CHECK(mismatches <= int(queries.size() / 10000));
+    printf("sample_gltf_brdf %d lanes: %d of %d samples differ from scalar\n", N, mismatches, int(queries.size()));
+}
+
+// uniform light selection of sample_tri_lights() in lights_linear.glsl
+using lanes8::sample_tri_lights;
+using lanes16::sample_tri_lights;
+
+template <int N>
+void test_tri_light_lanes() {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    std::vector<TriLight> lights(16);
+    for (auto& light : lights) {
+        glm::vec3 center(u01(rng) * 4.0f - 2.0f, 2.0f + u01(rng), u01(rng) * 4.0f - 2.0f);
+        light.v0 = center + glm::vec3(u01(rng), 0.0f, u01(rng)) * 0.5f;
+        light.v1 = center + glm::vec3(-u01(rng), 0.0f, u01(rng)) * 0.5f;
+        light.v2 = center + glm::vec3(0.0f, 0.0f, -u01(rng)) * 0.5f;
+        light.radiance = glm::vec3(u01(rng), u01(rng), u01(rng)) * 10.0f;
+    }
+    test_lights = &lights;
+
+    int mismatches = 0, total = 0;
+    for (int packet = 0; packet < 2000; ++packet) {
+        vec3_lanes<N> hit_p, hit_n(vec3(0.0f, 1.0f, 0.0f));
+        vec2_lanes<N> dir_sample, sel_sample;
+        SIMD_LANES_FOR(l, N) {
+            hit_p.set_lane(l, glm::vec3(u01(rng) * 2.0f - 1.0f, 0.0f, u01(rng) * 2.0f - 1.0f));
+            dir_sample.set_lane(l, glm::vec2(u01(rng), u01(rng)));
+            sel_sample.set_lane(l, glm::vec2(u01(rng), u01(rng)));
+        }
+        vec3_lanes<N> light_dir;
+        float_lanes<N> light_dist, pdf, mis_wpdf;
+        vec3_lanes<N> illum = sample_tri_lights(hit_p, hit_n, dir_sample, sel_sample
+            , light_dir, light_dist, pdf, mis_wpdf);
+
+        SIMD_LANES_FOR(l, N) {
+            glm::vec3 ref_dir;
+            float ref_dist, ref_pdf, ref_mis_wpdf;
+            glm::vec3 ref_illum = sample_tri_lights(hit_p.lane(l), hit_n.lane(l), dir_sample.lane(l), sel_sample.lane(l)
+                , ref_dir, ref_dist, ref_pdf, ref_mis_wpdf);
+
+            bool match = close(ref_pdf, pdf[l]) && close(ref_mis_wpdf, mis_wpdf[l]) && close(ref_dist, light_dist[l]);
+            for (int c = 0; c < 3; ++c)
+                match = match && close(ref_dir[c], light_dir.lane(l)[c]) && close(ref_illum[c], illum.lane(l)[c]);
+            mismatches += !match;
+            ++total;
+        }
+    }
+    test_lights = nullptr;
+    CHECK(mismatches == 0);
+    printf("sample_tri_lights %d lanes: %d of %d samples differ from scalar\n", N, mismatches, total);
+}
+
+template <class F>
+static double time_ms(F&& f, int repeat) {
+    double best = 1.e30;
+    for (int i = 0; i < repeat; ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        f();
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+void benchmark_sample_gltf_brdf(int count, int repeat) {
+    std::vector<BRDFQuery> queries = random_queries(count, 0.05f);
+    std::vector<BRDFResult> results(queries.size());
+    double scalar_ms = time_ms([&]() { sample_scalar(queries, results); }, repeat);
+    double lanes8_ms = time_ms([&]() { sample_lanes<8>(queries, results); }, repeat);
+    double lanes16_ms = time_ms([&]() { sample_lanes<16>(queries, results); }, repeat);
+    printf("sample_gltf_brdf throughput (%d samples, best of %d):\n", count, repeat);
+    printf("  scalar:   %8.2f Msamples/s\n", count / scalar_ms * 1.e-3);
+    printf("  8 lanes:  %8.2f Msamples/s (%.2fx)\n", count / lanes8_ms * 1.e-3, scalar_ms / lanes8_ms);
+    printf("  16 lanes: %8.2f Msamples/s (%.2fx)\n", count / lanes16_ms * 1.e-3, scalar_ms / lanes16_ms);
+}
+
+int main(int argc, char** argv) {
+    int count = 1 << 20;
+    int repeat = 5;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--samples") && i + 1 < argc)
+            count = atoi(argv[++i]) / 16 * 16;
+        else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+    }
+
+    test_sample_gltf_brdf_lanes<8>();
+    test_sample_gltf_brdf_lanes<16>();
+    test_tri_light_lanes<8>();
+    test_tri_light_lanes<16>();
+    if (finish_checks())
+        return 1;
+
+    benchmark_sample_gltf_brdf(count, repeat);
+    return 0;
+}
@@ -0,0 +1,175 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Checks the light grid selection of NEE against the grid built by librender:
+// selection probabilities have to sum to one over all lights and reach every
+// light, sampled probabilities have to match the evaluated ones, and the MIS
+// pdf of a light sample has to match the one evaluated on the emitter hit.
+
+#include "lights.h"
+#include "../../util/tests/check.h"
+
+namespace shaders_grid {
+
+using namespace glm;
+
+#include "../language.hpp"
+
+LightGrid const* test_grid = nullptr;
+std::vector<TriLight> const* test_lights = nullptr;
+
+#define SCENE_GET_LIGHT_GRID_PARAMS() test_grid->params
+#define SCENE_GET_LIGHT_GRID_CELL(cell_id) test_grid->cells[cell_id]
+#define SCENE_GET_LIGHT_GRID_ENTRY(entry_id) test_grid->entries[entry_id]
+#define SCENE_GET_LIGHT_SOURCE_COUNT() int(test_lights->size())
+#define SCENE_GET_LIGHT_SOURCE(light_id) (*test_lights)[light_id]
+// one light per bin, the grid replaces the bins
+#define BINNED_LIGHTS_BIN_SIZE 1
+#define SCENE_GET_BINNED_LIGHTS_BIN_COUNT() SCENE_GET_LIGHT_SOURCE_COUNT()
+#include "../mc/lights_grid.glsl"
+
+}
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace shaders_grid;
+
+static std::vector<TriLight> random_emitters(int count, float scene_size, std::mt19937& rng) {
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    std::vector<TriLight> lights(count);
+    for (auto& light : lights) {
+        glm::vec3 center(u01(rng) * scene_size, u01(rng) * scene_size, u01(rng) * scene_size);
+        light.v0 = center + glm::vec3(u01(rng) - 0.5f, u01(rng) - 0.5f, u01(rng) - 0.5f);
+        light.v1 = center + glm::vec3(u01(rng) - 0.5f, u01(rng) - 0.5f, u01(rng) - 0.5f);
+        light.v2 = center + glm::vec3(u01(rng) - 0.5f, u01(rng) - 0.5f, u01(rng) - 0.5f);
+        light.radiance = glm::vec3(0.1f + 10.0f * u01(rng) * u01(rng));
+    }
+    return lights;
+}
+
+static bool close(float a, float b, float tolerance) {
+    return std::fabs(a - b) <= tolerance * std::max(std::fabs(a), std::fabs(b));
+}
+
+static void test_selection(glm::vec3 p, int num_samples) {
+    LightGridParams const& grid = test_grid->params;
+    LightGridCell cell = test_grid->cells[light_grid_cell_index(grid, p)];
+    int num_lights = int(test_lights->size());
+
+    std::vector<float> pdfs(num_lights);
+    double sum = 0.0;
+    int unreachable = 0;
+    for (int i = 0; i < num_lights; ++i) {
+        pdfs[i] = light_grid_selection_pdf(grid, cell, i, num_lights);
+        sum += pdfs[i];
+        unreachable += !(pdfs[i] > 0.0f);
+    }
+    CHECK(std::fabs(sum - 1.0) < 1.e-4);
+    CHECK(unreachable == 0);
+
+    // stratified selection samples hit each light in proportion to its probability
+    std::vector<int> counts(num_lights);
+    int pdf_mismatches = 0;
+    for (int i = 0; i < num_samples; ++i) {
+        float sel_p;
+        int light_id = sample_light_grid(p, (float(i) + 0.5f) / float(num_samples), sel_p);
+        counts[light_id] += 1;
+        pdf_mismatches += !close(sel_p, pdfs[light_id], 1.e-5f);
+    }
+    CHECK(pdf_mismatches == 0);
+    int frequency_mismatches = 0;
+    for (int i = 0; i < num_lights; ++i)
+        frequency_mismatches += std::fabs(float(counts[i]) / float(num_samples) - pdfs[i]) > 4.0f / float(num_samples);
+    CHECK(frequency_mismatches == 0);
+}
+
+// closest emitter along the ray, as found by the emitter hit
+static int trace_emitters(glm::vec3 origin, glm::vec3 dir, float& dist) {
+    int closest = -1;
+    dist = 1.e30f;
+    for (int i = 0; i < int(test_lights->size()); ++i) {
+        TriLight const& light = (*test_lights)[i];
+        glm::vec3 e0 = light.v1 - light.v0, e1 = light.v2 - light.v0;
+        glm::vec3 pv = glm::cross(dir, e1);
+        float det = glm::dot(e0, pv);
+        glm::vec3 tv = origin - light.v0, qv = glm::cross(tv, e0);
+        float u = glm::dot(tv, pv) / det, v = glm::dot(dir, qv) / det, t = glm::dot(e1, qv) / det;
+        if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t > 0.0f && t < dist) {
+            dist = t;
+            closest = i;
+        }
+    }
+    return closest;
+}
+
+// counts the unoccluded light samples, and those where the pdfs disagree
+static void test_mis(glm::vec3 p, std::mt19937& rng, int num_samples, int& checked, int& mismatches) {
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    for (int i = 0; i < num_samples; ++i) {
+        vec3 light_dir;
+        float light_dist, pdf, mis_wpdf;
+        sample_grid_tri_lights(p, vec3(0.0f, 1.0f, 0.0f), vec2(u01(rng), u01(rng)), vec2(u01(rng), u01(rng))
+            , light_dir, light_dist, pdf, mis_wpdf);
+        if (!(pdf > 0.0f) || !std::isfinite(pdf))
+            continue;
+        // occluded samples never reach the MIS weighting
+        float hit_dist;
+        int hit = trace_emitters(p, light_dir, hit_dist);
+        if (hit < 0 || hit_dist < light_dist * (1.0f - 1.e-3f))
+            continue;
+
+        // approximate solid angle as computed from the triangle area on emitter hits
+        TriLight const& light = (*test_lights)[hit];
+        glm::vec3 area_n = 0.5f * glm::cross(light.v1 - light.v0, light.v2 - light.v0);
+        float approx_solid_angle = glm::length(area_n) * std::fabs(glm::dot(glm::normalize(area_n), light_dir)) / (hit_dist * hit_dist);
+        mismatches += !close(approx_grid_tri_lights_pdf(approx_solid_angle, p, light_dir), mis_wpdf, 1.e-3f);
+        ++checked;
+    }
+}
+
+static void test_light_grid(char const* name, int num_lights, float requested_global_fraction) {
+    std::mt19937 rng(11);
+    float const scene_size = 10.0f;
+    std::vector<TriLight> lights = random_emitters(num_lights, scene_size, rng);
+    std::vector<float> radiances(num_lights);
+    for (int i = 0; i < num_lights; ++i)
+        radiances[i] = lights[i].radiance.x;
+
+    LightGridConfig config;
+    config.max_resolution = 8;
+    config.lights_per_cell = 16;
+    config.global_fraction = requested_global_fraction;
+    LightGrid grid;
+    update_light_grid(grid, lights, radiances, AABB(glm::vec3(0.0f), glm::vec3(scene_size)), config);
+    test_grid = &grid;
+    test_lights = &lights;
+    CHECK(grid.params.global_fraction > 0.0f);
+
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    int const num_points = 64, num_mis_samples = 1 << 10;
+    int checked = 0, mismatches = 0;
+    for (int i = 0; i < num_points; ++i) {
+        // including points outside of the grid bounds, which use the closest cell
+        glm::vec3 p = (glm::vec3(u01(rng), u01(rng), u01(rng)) * 1.2f - 0.1f) * scene_size;
+        test_selection(p, 1 << 14);
+        test_mis(p, rng, num_mis_samples, checked, mismatches);
+    }
+    CHECK(checked > num_points * num_mis_samples / 4);
+    // grazing samples may disagree in the approximate solid angle
+    CHECK(mismatches <= checked / 1000);
+
+    printf("%-16s %d lights, %d x %d x %d cells, %d entries, global fraction %.3f\n"
+        , name, num_lights, grid.params.resolution.x, grid.params.resolution.y, grid.params.resolution.z
+        , grid.params.entry_count, grid.params.global_fraction);
+}
+
+int main() {
+    test_light_grid("default", 200, LightGridConfig().global_fraction);
+    // lights outside the cell lists must remain reachable
+    test_light_grid("no global", 200, 0.0f);
+    test_light_grid("few lights", 5, 0.25f);
+    return finish_checks();
+}
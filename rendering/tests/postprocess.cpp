@@ -0,0 +1,126 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Checks the CPU post-processing of librender against the scalar GLSL display
+// transform for all tone mapping modes, then measures its throughput.
+
+#include "postprocess_cpu.h"
+#include "../../util/tests/check.h"
+
+namespace shaders_post {
+
+using namespace glm;
+
+#include "../language.hpp"
+struct { vec3 xyz; } color_balance_operator;
+#include "../util.glsl"
+#include "../postprocess/tonemapping_utils.glsl"
+#include "../postprocess/color_grading_utils.glsl"
+
+}
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// process_samples.comp followed by the color balance of the uber post pass
+static glm::vec4 reference_display(PostProcessParams const& params, glm::vec4 hdr) {
+    using namespace shaders_post;
+    if (!(hdr.w >= 0.0f))
+        return hdr;
+    glm::vec3 c = glm::vec3(hdr) * std::exp2(params.exposure);
+    color_balance_operator.xyz = params.color_balance;
+    if (params.color_balance != glm::vec3(1.0f))
+        c = color_balance(c);
+    if (params.tone_mapping_mode >= 0)
+        c = tonemap(params.tone_mapping_mode, c);
+    if (params.srgb_encode)
+        c = linear_to_srgb(c);
+    return glm::vec4(c, std::min(hdr.w, 1.0f));
+}
+
+static std::vector<float> random_hdr(int width, int height) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    std::vector<float> hdr(size_t(width) * height * 4);
+    for (size_t i = 0; i < hdr.size(); i += 4) {
+        // log-uniform radiance over several orders of magnitude, some debug view pixels
+        for (int c = 0; c < 3; ++c)
+            hdr[i + c] = std::exp2(u01(rng) * 20.0f - 12.0f);
+        hdr[i + 3] = u01(rng) < 0.01f ? -1.0f : 1.0f;
+    }
+    return hdr;
+}
+
+void test_modes() {
+    int const width = 253, height = 67; // odd sizes for the row partitioning
+    std::vector<float> hdr = random_hdr(width, height);
+    std::vector<float> display(hdr.size());
+    std::vector<uint8_t> display8(hdr.size());
+
+    for (int mode = -1; mode <= FAST_TONE_MAPPING; ++mode) {
+        for (int balance = 0; balance < 2; ++balance) {
+            PostProcessParams params;
+            params.exposure = 1.5f;
+            params.tone_mapping_mode = mode;
+            params.color_balance = balance ? glm::vec3(1.1f, 1.0f, 0.85f) : glm::vec3(1.0f);
+            postprocess_to_rgba32f(params, width, height, 4, hdr.data(), display.data());
+            postprocess_to_rgba8(params, width, height, 4, hdr.data(), display8.data());
+
+            int mismatches = 0, quantization_mismatches = 0;
+            for (size_t i = 0; i < hdr.size(); i += 4) {
+                glm::vec4 ref = reference_display(params, glm::vec4(hdr[i], hdr[i + 1], hdr[i + 2], hdr[i + 3]));
+                for (int c = 0; c < 4; ++c) {
+                    float v = display[i + c];
+                    mismatches += !(std::fabs(v - ref[c]) <= 1.e-6f * std::max(1.0f, std::fabs(ref[c])));
+                    int ref8 = int(std::min(std::max(ref[c], 0.0f), 1.0f) * 255.0f + 0.5f);
+                    quantization_mismatches += std::abs(int(display8[i + c]) - ref8) > 0;
+                }
+            }
+            CHECK(mismatches == 0);
+            // the sRGB table is exact, so 8 bit codes match the scalar quantization
+            CHECK(quantization_mismatches == 0);
+            printf("tone mapping %2d, color balance %d: %d float and %d 8 bit mismatches\n"
+                , mode, balance, mismatches, quantization_mismatches);
+        }
+    }
+}
+
+template <class F>
+static double time_ms(F&& f, int repeat) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i)
+        f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repeat;
+}
+
+void benchmark_throughput() {
+    int const width = 3840, height = 2160;
+    std::vector<float> hdr = random_hdr(width, height);
+    std::vector<uint8_t> display8(hdr.size());
+    PostProcessParams params;
+    params.tone_mapping_mode = NEUTRAL_TONE_MAPPING;
+
+    int const repeat = 5;
+    double parallel_ms = time_ms([&]() {
+        postprocess_to_rgba8(params, width, height, 4, hdr.data(), display8.data());
+    }, repeat);
+    double scalar_ms = time_ms([&]() {
+        for (size_t i = 0; i < hdr.size(); i += 4) {
+            glm::vec4 ref = reference_display(params, glm::vec4(hdr[i], hdr[i + 1], hdr[i + 2], hdr[i + 3]));
+            for (int c = 0; c < 4; ++c)
+                display8[i + c] = uint8_t(std::min(std::max(ref[c], 0.0f), 1.0f) * 255.0f + 0.5f);
+        }
+    }, 1);
+    double bytes = double(hdr.size()) * (sizeof(float) + sizeof(uint8_t));
+    printf("%dx%d to rgba8: %.2f ms (%.2f GB/s), scalar single-threaded %.2f ms (%.2fx)\n"
+        , width, height, parallel_ms, bytes / parallel_ms * 1.e-6, scalar_ms, scalar_ms / parallel_ms);
+}
+
+int main() {
+    test_modes();
+    benchmark_throughput();
+    return finish_checks();
+}
@@ -0,0 +1,122 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Checks the sky importance sampling map built by librender against numerical
+// integration: the solid angle PDF has to integrate to one, sampled PDFs have
+// to match the evaluated ones, and importance sampled estimates of the
+// integrated sky radiance have to converge to the quadrature result.
+
+#include "sky_light.h"
+#include "sky_sampling.h"
+#include "../../util/tests/check.h"
+
+namespace shaders_sky {
+
+using namespace glm;
+
+#include "../language.hpp"
+#include "../lights/sky_map.glsl"
+
+struct TestSceneParams {
+    SkyModelParams sky_params;
+    vec3 sun_dir;
+    SkySamplingParams sky_sampling;
+};
+TestSceneParams scene_params;
+float const* sky_map_values = nullptr;
+
+#define SCENE_GET_SKY_MAP_VALUE(index) sky_map_values[index]
+#include "../mc/lights_sky.glsl"
+
+}
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace shaders_sky;
+
+static void set_sky(SkyLight const& sky, SkySamplingMap const& map) {
+    for (int i = 0; i < 9; ++i)
+        scene_params.sky_params.configs[i] = sky.configs[i];
+    scene_params.sky_params.radiances = sky.radiances;
+    scene_params.sun_dir = sky.sun_dir;
+    scene_params.sky_sampling.map_width = map.width;
+    scene_params.sky_sampling.map_height = map.height;
+    scene_params.sky_sampling.probability = sky_sampling_probability(map, sky);
+    sky_map_values = map.data.data();
+}
+
+// midpoint quadrature over (phi, cos theta), which has a constant solid angle per cell
+template <class F>
+static void integrate_sphere(int resolution, F&& f) {
+    float cell_solid_angle = 4.0f * float(M_PI) / float(2 * resolution * resolution);
+    for (int j = 0; j < resolution; ++j) {
+        float cos_theta = 1.0f - 2.0f * (float(j) + 0.5f) / float(resolution);
+        float sin_theta = std::sqrt(std::max(1.0f - cos_theta * cos_theta, 0.0f));
+        for (int i = 0; i < 2 * resolution; ++i) {
+            float phi = 2.0f * float(M_PI) * (float(i) + 0.5f) / float(2 * resolution);
+            f(glm::vec3(sin_theta * std::cos(phi), cos_theta, sin_theta * std::sin(phi)), cell_solid_angle);
+        }
+    }
+}
+
+static bool close(float a, float b, float tolerance) {
+    return std::fabs(a - b) <= tolerance * std::max(std::fabs(a), std::fabs(b));
+}
+
+void test_sky(char const* name, glm::vec3 sun_dir, float turbidity) {
+    SceneConfig config;
+    config.sun_dir = sun_dir;
+    config.turbidity = turbidity;
+    SkyLight sky = compute_sky_light_direct(config, false);
+    SkySamplingMap map;
+    build_sky_sampling_map(map, sky, SKY_MAP_DEFAULT_WIDTH, SKY_MAP_DEFAULT_HEIGHT);
+    set_sky(sky, map);
+
+    // the solid angle PDF integrates to one, the sky radiance to the map power
+    double pdf_integral = 0.0;
+    double power = 0.0;
+    glm::dvec3 reference(0.0);
+    integrate_sphere(1024, [&](glm::vec3 dir, float solid_angle) {
+        glm::vec3 radiance = sky_atmosphere_radiance(scene_params.sky_params, scene_params.sun_dir, dir);
+        pdf_integral += eval_sky_light_pdf(dir) * solid_angle;
+        power += luminance(radiance) * solid_angle;
+        reference += glm::dvec3(radiance) * double(solid_angle);
+    });
+    CHECK(close(float(pdf_integral), 1.0f, 2.e-3f));
+    CHECK(close(float(power), map.power, 1.e-2f));
+
+    // sampled directions reproduce the evaluated PDF and the quadrature result
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    int const num_samples = 1 << 18;
+    int pdf_mismatches = 0;
+    glm::dvec3 estimate(0.0);
+    for (int i = 0; i < num_samples; ++i) {
+        vec3 light_dir;
+        float pdf;
+        vec3 value = sample_sky_light(vec2(u01(rng), u01(rng)), light_dir, pdf);
+        if (pdf == 0.0f)
+            continue;
+        pdf_mismatches += !close(pdf, eval_sky_light_pdf(light_dir), 1.e-3f);
+        estimate += glm::dvec3(value);
+    }
+    estimate /= double(num_samples);
+    // directions sampled right at texel edges may round into the neighboring texel
+    CHECK(pdf_mismatches <= num_samples / 1000);
+    for (int c = 0; c < 3; ++c)
+        CHECK(close(float(estimate[c]), float(reference[c]), 1.e-2f));
+
+    printf("%-10s pdf integral %.5f, sky power %.4f (map %.4f), estimate %.4f %.4f %.4f (reference %.4f %.4f %.4f), sky probability %.3f\n"
+        , name, pdf_integral, power, map.power
+        , estimate.x, estimate.y, estimate.z, reference.x, reference.y, reference.z
+        , scene_params.sky_sampling.probability);
+}
+
+int main() {
+    test_sky("noon", glm::normalize(glm::vec3(0.2f, 1.0f, 0.1f)), 3.0f);
+    test_sky("low sun", glm::normalize(glm::vec3(1.0f, 0.08f, 0.3f)), 3.0f);
+    test_sky("overcast", glm::normalize(glm::vec3(0.5f, 0.6f, -0.4f)), 10.0f);
+    return finish_checks();
+}
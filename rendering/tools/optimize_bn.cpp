@@ -0,0 +1,443 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Optimizes the scrambling and ranking keys of the blue noise sampler tables
+// (BNData, see bn_rng.glsl) for a given tile size and sample count, following
+// "A Low-Discrepancy Sampler that Distributes Monte Carlo Errors as a Blue Noise
+// in Screen Space" by Heitz, Belcour, Ostromoukhov, Coeurjolly and Iehl.
+//
+// Every pixel is assigned the vector of its integration errors for a set of 2D
+// heaviside test integrands. Simulated annealing minimizes a toroidal energy that
+// penalizes neighboring pixels with similar error vectors: scrambling keys are
+// swapped between pixels for the error of the full spp budget, then ranking keys
+// are re-drawn per pixel for the errors of the progressive sample prefixes.
+// Energy changes are evaluated incrementally in the neighborhood of the modified
+// pixels, on SIMD lanes; disjoint blocks of the tile are annealed in parallel.
+// The result is written as a seed file that load_bn_tables() expands at runtime.
+
+#include "pointset_tables.h"
+#include "parallel.h"
+#include "util.h"
+
+#include <glm/glm.hpp>
+
+namespace glsl {
+    using namespace glm;
+    #include "../language.hpp"
+    #include "../language_simd.hpp"
+}
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using glsl::float_lanes;
+typedef float_lanes<8> error_lanes;
+
+namespace {
+
+void print_usage(char const* exe) {
+    printf("Usage: %s [options]\n"
+           "  --tile-size <n>       tile size, power of two up to 256 (default: compiled BNData_TileSize)\n"
+           "  --samples <n>         samples in the tables, power of two up to 256 (default: compiled BNData_SampleCount)\n"
+           "  --spp <n>             optimize only the keys of the 1, 4, 16 or 256 spp tiles (default all)\n"
+           "  --integrands <n>      number of test integrands, multiple of 8 (default 64)\n"
+           "  --sweeps <n>          annealing sweeps per tile and dimension pair (default 32)\n"
+           "  --seed <n>            random seed (default 1)\n"
+           "  --out <file>          output seed file (default: the seed in the pointset cache read by load_bn_tables)\n"
+           "  --threads <n>         number of worker threads (default all)\n", exe);
+}
+
+// neighborhood radius and standard deviation of the spatial energy kernel
+int const kernel_radius = 6;
+float const sigma_i = 2.1f;
+// spatially disjoint blocks are annealed in parallel, see anneal()
+int const block_size = 16;
+
+struct Neighbor {
+    int dx, dy;
+    float weight;
+};
+
+struct TestIntegrands {
+    int count;
+    // indicators of all integrands at each point of the 256x256 grid of 8 bit sample positions
+    std::vector<uint8_t> inside;
+    std::vector<float> reference;
+
+    uint8_t const* values(uint32_t x, uint32_t y) const {
+        return &inside[size_t((y << 8) + x) * count];
+    }
+};
+
+// random 2D heavisides, integrated exactly over the discrete sample positions
+TestIntegrands make_test_integrands(int count, uint32_t seed) {
+    TestIntegrands integrands;
+    integrands.count = count;
+    integrands.inside.resize(size_t(count) << 16);
+    integrands.reference.resize(count);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    std::vector<glm::vec3> lines(count);
+    for (auto& line : lines) {
+        float phi = 2.0f * float(M_PI) * u01(rng);
+        glm::vec2 n(std::cos(phi), std::sin(phi));
+        glm::vec2 c(u01(rng), u01(rng));
+        line = glm::vec3(n, -glm::dot(n, c));
+    }
+    parallel_for(0, count, 1, [&](index_t k, int) {
+        int num_inside = 0;
+        for (int y = 0; y < 256; ++y)
+            for (int x = 0; x < 256; ++x) {
+                glm::vec2 p((float(x) + 0.5f) / 256.0f, (float(y) + 0.5f) / 256.0f);
+                bool is_inside = lines[k].x * p.x + lines[k].y * p.y + lines[k].z > 0.0f;
+                integrands.inside[size_t((y << 8) + x) * count + k] = is_inside;
+                num_inside += is_inside;
+            }
+        integrands.reference[k] = float(num_inside) / 65536.0f;
+    });
+    return integrands;
+}
+
+float error_distance(error_lanes const* a, error_lanes const* b, int num_packets) {
+    error_lanes sum(0.0f);
+    for (int i = 0; i < num_packets; ++i) {
+        error_lanes d = a[i] - b[i];
+        sum = fma(d, d, sum);
+    }
+    float total = 0.0f;
+    for (int l = 0; l < 8; ++l)
+        total += sum[l];
+    return std::sqrt(total);
+}
+
+// Error vectors of all pixels of the tile for one dimension pair, one set of
+// test integrand errors per progressive sample budget.
+struct TileErrors {
+    int tile_size;
+    int num_packets; // error_lanes per pixel
+    std::vector<error_lanes> errors;
+    std::vector<Neighbor> neighbors;
+    float inv_sigma_s = 1.0f;
+
+    TileErrors(int tile_size, int num_packets)
+        : tile_size(tile_size)
+        , num_packets(num_packets)
+        , errors(size_t(tile_size) * tile_size * num_packets) {
+        for (int dy = -kernel_radius; dy <= kernel_radius; ++dy)
+            for (int dx = -kernel_radius; dx <= kernel_radius; ++dx) {
+                int d2 = dx * dx + dy * dy;
+                if (d2 > 0 && d2 <= kernel_radius * kernel_radius)
+                    neighbors.push_back({ dx, dy, std::exp(-float(d2) / (sigma_i * sigma_i)) });
+            }
+    }
+
+    error_lanes* pixel(int p) { return &errors[size_t(p) * num_packets]; }
+    error_lanes const* pixel(int p) const { return &errors[size_t(p) * num_packets]; }
+
+    int neighbor(int p, Neighbor const& n) const {
+        int x = (p % tile_size + n.dx) & (tile_size - 1);
+        int y = (p / tile_size + n.dy) & (tile_size - 1);
+        return y * tile_size + x;
+    }
+
+    // energy of pixel p with the error vector e against its neighbors, optionally skipping one
+    float local_energy(int p, error_lanes const* e, int skip = -1) const {
+        float energy = 0.0f;
+        for (auto const& n : neighbors) {
+            int q = neighbor(p, n);
+            if (q == skip)
+                continue;
+            energy += n.weight * std::exp(-error_distance(e, pixel(q), num_packets) * inv_sigma_s);
+        }
+        return energy;
+    }
+
+    float total_energy() const {
+        int num_pixels = tile_size * tile_size;
+        std::vector<float> energies(num_pixels);
+        parallel_for(0, num_pixels, 256, [&](index_t p, int) {
+            energies[p] = local_energy(int(p), pixel(int(p)));
+        });
+        double total = 0.0;
+        for (float e : energies)
+            total += e;
+        return float(total / num_pixels);
+    }
+
+    // normalizes error distances by their mean over random pixel pairs
+    void normalize_distances(std::mt19937& rng) {
+        int num_pixels = tile_size * tile_size;
+        std::uniform_int_distribution<int> random_pixel(0, num_pixels - 1);
+        double sum = 0.0;
+        int const num_pairs = 4096;
+        for (int i = 0; i < num_pairs; ++i)
+            sum += error_distance(pixel(random_pixel(rng)), pixel(random_pixel(rng)), num_packets);
+        inv_sigma_s = sum > 0.0 ? float(num_pairs / sum) : 1.0f;
+    }
+};
+
+// Calls block_fn(x0, y0, size, rng, thread_idx) for all blocks of the tile, in four phases of
+// blocks that are at least block_size apart, which is enough to keep the
+// neighborhoods touched by moves in different blocks of one phase disjoint.
+template <class BlockFn>
+void for_each_block(int tile_size, uint32_t seed, int sweep, BlockFn&& block_fn) {
+    if (tile_size < 2 * block_size) {
+        std::mt19937 rng(seed + 0x9e3779b9u * uint32_t(sweep));
+        block_fn(0, 0, tile_size, rng, 0);
+        return;
+    }
+    std::mt19937 offset_rng(seed ^ (0x85ebca6bu * uint32_t(sweep + 1)));
+    int offset_x = int(offset_rng() % uint32_t(tile_size));
+    int offset_y = int(offset_rng() % uint32_t(tile_size));
+    int blocks_per_row = tile_size / block_size;
+    int blocks_per_color = blocks_per_row * blocks_per_row / 4;
+    for (int color = 0; color < 4; ++color) {
+        parallel_for(0, blocks_per_color, 1, [&](index_t i, int thread_idx) {
+            int bx = int(i) % (blocks_per_row / 2) * 2 + (color & 1);
+            int by = int(i) / (blocks_per_row / 2) * 2 + (color >> 1);
+            std::mt19937 rng(seed + 0x9e3779b9u * uint32_t(sweep) + 0xc2b2ae35u * uint32_t(color * blocks_per_color + i));
+            block_fn(bx * block_size + offset_x, by * block_size + offset_y, block_size, rng, thread_idx);
+        });
+    }
+}
+
+struct Annealing {
+    int sweeps;
+    uint32_t seed;
+
+    // initial temperature from the mean energy change of random moves, cooled geometrically to 1/1000
+    float temperature(float initial, int sweep) const {
+        return initial * std::pow(1.e-3f, float(sweep) / float(std::max(sweeps - 1, 1)));
+    }
+};
+
+struct BNOptimizer {
+    BNTableConfig config;
+    TestIntegrands integrands;
+    Annealing annealing;
+    uint32_t* tables;
+
+    uint32_t const* sequence() const { return tables; }
+    uint32_t* tile(int index) { return tables + size_t(config.sample_count) * config.dimensions + index * config.tile_elements(); }
+
+    uint32_t sample_value(int d, int i) const {
+        return sequence()[d + size_t(i) * config.dimensions];
+    }
+
+    // integration errors of the prefixes of the given lengths of the pixel's samples
+    void pixel_errors(error_lanes* e, int d, uint32_t scramble_0, uint32_t scramble_1, uint32_t rank
+        , int const* prefixes, int num_prefixes) const {
+        int num_integrands = integrands.count;
+        float* errors = &e[0][0];
+        // accumulate running sums per prefix, then convert to errors
+        std::fill(errors, errors + num_integrands, 0.0f);
+        int num_samples = 0;
+        for (int prefix = 0; prefix < num_prefixes; ++prefix) {
+            float* sums = errors + prefix * num_integrands;
+            if (prefix > 0)
+                std::copy(sums - num_integrands, sums, sums);
+            for (; num_samples < prefixes[prefix]; ++num_samples) {
+                int i = int(uint32_t(num_samples) ^ rank);
+                uint8_t const* values = integrands.values(sample_value(d, i) ^ scramble_0, sample_value(d + 1, i) ^ scramble_1);
+                for (int k = 0; k < num_integrands; ++k)
+                    sums[k] += float(values[k]);
+            }
+        }
+        for (int prefix = 0; prefix < num_prefixes; ++prefix) {
+            float* sums = errors + prefix * num_integrands;
+            for (int k = 0; k < num_integrands; ++k)
+                sums[k] = sums[k] / float(prefixes[prefix]) - integrands.reference[k];
+        }
+    }
+
+    // swaps the scrambling keys of a dimension pair between pixels
+    void optimize_scrambling(int spp, uint32_t* scrambling, uint32_t const* ranking, int d) {
+        int tile_size = config.tile_size;
+        int num_pixels = tile_size * tile_size;
+        int stride = config.scrambling_dimensions;
+        TileErrors tile(tile_size, integrands.count / 8);
+        parallel_for(0, num_pixels, 64, [&](index_t p, int) {
+            uint32_t rank = ranking ? ranking[p * stride + d] : 0;
+            pixel_errors(tile.pixel(int(p)), d, scrambling[p * stride + d], scrambling[p * stride + d + 1], rank, &spp, 1);
+        });
+
+        auto swap_delta = [&](int p, int q) {
+            float before = tile.local_energy(p, tile.pixel(p), q) + tile.local_energy(q, tile.pixel(q), p);
+            float after = tile.local_energy(p, tile.pixel(q), q) + tile.local_energy(q, tile.pixel(p), p);
+            return after - before;
+        };
+        auto swap_pixels = [&](int p, int q) {
+            std::swap_ranges(tile.pixel(p), tile.pixel(p) + tile.num_packets, tile.pixel(q));
+            std::swap(scrambling[p * stride + d], scrambling[q * stride + d]);
+            std::swap(scrambling[p * stride + d + 1], scrambling[q * stride + d + 1]);
+        };
+        anneal(tile, "scrambling", spp, d, [&](int p, int q, std::mt19937&, int) {
+            return swap_delta(p, q);
+        }, [&](int p, int q, int) {
+            swap_pixels(p, q);
+        });
+    }
+
+    // re-draws the ranking keys of a dimension pair per pixel, for the progressive prefixes of the spp budget
+    void optimize_ranking(int spp, uint32_t const* scrambling, uint32_t* ranking, int d) {
+        int tile_size = config.tile_size;
+        int num_pixels = tile_size * tile_size;
+        int stride = config.scrambling_dimensions;
+        std::vector<int> prefixes;
+        for (int n = 1; n < spp; n *= 2)
+            prefixes.push_back(n);
+        int num_prefixes = int(prefixes.size());
+        TileErrors tile(tile_size, integrands.count / 8 * num_prefixes);
+        parallel_for(0, num_pixels, 64, [&](index_t p, int) {
+            pixel_errors(tile.pixel(int(p)), d, scrambling[p * stride + d], scrambling[p * stride + d + 1]
+                , ranking[p * stride + d], prefixes.data(), num_prefixes);
+        });
+
+        // proposals are evaluated in per-thread scratch memory
+        struct Proposal {
+            std::vector<error_lanes> errors;
+            uint32_t rank;
+        };
+        std::vector<Proposal> proposals(parallel_thread_count(), Proposal{ std::vector<error_lanes>(tile.num_packets), 0 });
+        anneal(tile, "ranking", spp, d, [&](int p, int, std::mt19937& rng, int thread_idx) {
+            Proposal& proposal = proposals[thread_idx];
+            proposal.rank = uint32_t(rng()) & uint32_t(spp - 1);
+            pixel_errors(proposal.errors.data(), d, scrambling[p * stride + d], scrambling[p * stride + d + 1]
+                , proposal.rank, prefixes.data(), num_prefixes);
+            return tile.local_energy(p, proposal.errors.data()) - tile.local_energy(p, tile.pixel(p));
+        }, [&](int p, int, int thread_idx) {
+            Proposal const& proposal = proposals[thread_idx];
+            std::copy(proposal.errors.begin(), proposal.errors.end(), tile.pixel(p));
+            ranking[p * stride + d] = proposal.rank;
+            ranking[p * stride + d + 1] = proposal.rank;
+        });
+    }
+
+    // Simulated annealing of moves on pixel pairs (p, q) in the same block.
+    // delta_fn(p, q, rng, thread_idx) returns the energy change of a move, apply_fn(p, q, thread_idx)
+    // applies the move last evaluated by the same thread.
+    template <class DeltaFn, class ApplyFn>
+    void anneal(TileErrors& tile, char const* keys, int spp, int d, DeltaFn&& delta_fn, ApplyFn&& apply_fn) {
+        int tile_size = tile.tile_size;
+        int num_pixels = tile_size * tile_size;
+        std::mt19937 rng(annealing.seed ^ uint32_t(d * 7919 + spp));
+        tile.normalize_distances(rng);
+        float initial_energy = tile.total_energy();
+
+        // initial temperature, from a few random moves
+        std::uniform_int_distribution<int> random_pixel(0, num_pixels - 1);
+        double mean_delta = 0.0;
+        int const num_probes = 256;
+        for (int i = 0; i < num_probes; ++i) {
+            int p = random_pixel(rng);
+            int q = tile.neighbor(p, tile.neighbors[rng() % tile.neighbors.size()]);
+            mean_delta += std::fabs(delta_fn(p, q, rng, 0));
+        }
+        float initial_temperature = float(mean_delta / num_probes);
+
+        auto start = std::chrono::steady_clock::now();
+        int64_t num_accepted = 0;
+        for (int sweep = 0; sweep < annealing.sweeps; ++sweep) {
+            float temperature = annealing.temperature(initial_temperature, sweep);
+            std::vector<int64_t> accepted(parallel_thread_count(), 0);
+            for_each_block(tile_size, annealing.seed + uint32_t(d * 131 + spp), sweep, [&](int x0, int y0, int size, std::mt19937& block_rng, int thread_idx) {
+                std::uniform_int_distribution<int> random_offset(0, size - 1);
+                std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+                for (int move = 0; move < size * size; ++move) {
+                    int p = ((y0 + random_offset(block_rng)) & (tile_size - 1)) * tile_size + ((x0 + random_offset(block_rng)) & (tile_size - 1));
+                    int q = ((y0 + random_offset(block_rng)) & (tile_size - 1)) * tile_size + ((x0 + random_offset(block_rng)) & (tile_size - 1));
+                    if (p == q)
+                        continue;
+                    float delta = delta_fn(p, q, block_rng, thread_idx);
+                    if (delta < 0.0f || u01(block_rng) < std::exp(-delta / temperature)) {
+                        apply_fn(p, q, thread_idx);
+                        ++accepted[thread_idx];
+                    }
+                }
+            });
+            for (auto a : accepted)
+                num_accepted += a;
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        float final_energy = tile.total_energy();
+        printf("%3d spp %-10s dims %d-%d: energy %.4f -> %.4f, %.1f%% moves accepted, %.1f s\n"
+            , spp, keys, d, d + 1, initial_energy, final_energy
+            , annealing.sweeps > 0 ? 100.0 * double(num_accepted) / (double(num_pixels) * annealing.sweeps) : 0.0
+            , std::chrono::duration<double>(end - start).count());
+    }
+};
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    set_executable_path(argv[0]);
+    detect_root_path("rendering/defaults.glsl");
+
+    BNTableConfig config = BNTableConfig::compiled();
+    std::string out_file;
+    int only_spp = 0;
+    int num_integrands = 64;
+    Annealing annealing = { 32, 1 };
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--tile-size") && i + 1 < argc)
+            config.tile_size = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--samples") && i + 1 < argc)
+            config.sample_count = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--spp") && i + 1 < argc)
+            only_spp = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--integrands") && i + 1 < argc)
+            num_integrands = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--sweeps") && i + 1 < argc)
+            annealing.sweeps = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+            annealing.seed = uint32_t(atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            out_file = argv[++i];
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (num_integrands <= 0 || num_integrands % 8 != 0) {
+        printf("Number of integrands must be a positive multiple of 8\n");
+        return 1;
+    }
+    if (out_file.empty())
+        out_file = bn_seed_path(config);
+
+    // continue from the current seed when there is one, otherwise from white noise keys
+    std::vector<uint32_t> tables(config.num_elements());
+    generate_bn_tables(tables.data(), config);
+
+    BNOptimizer optimizer = { config, make_test_integrands(num_integrands, annealing.seed), annealing, tables.data() };
+    printf("Optimizing %s with %d threads\n", config.name().c_str(), parallel_thread_count());
+
+    // tiles: scrambling 1 spp, then scrambling and ranking for 4, 16, 256 spp
+    int const tile_spp[4] = { 1, 4, 16, 256 };
+    for (int level = 0; level < 4; ++level) {
+        int spp = std::min(tile_spp[level], config.sample_count);
+        if (only_spp && tile_spp[level] != only_spp)
+            continue;
+        uint32_t* scrambling = optimizer.tile(level == 0 ? 0 : 2 * level - 1);
+        uint32_t* ranking = level == 0 ? nullptr : optimizer.tile(2 * level);
+        for (int d = 0; d + 1 < config.scrambling_dimensions; d += 2) {
+            optimizer.optimize_scrambling(spp, scrambling, ranking, d);
+            if (ranking)
+                optimizer.optimize_ranking(spp, scrambling, ranking, d);
+        }
+    }
+
+    write_bn_seed(out_file, tables.data(), config);
+    printf("Wrote %s\n", out_file.c_str());
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Applies the display transform of the renderer to captured linear HDR frames,
+// e.g. the rgba EXRs written in data capture mode, and stores the display
+// images next to them as <frame>_display.png (or .exr with --exr). The
+// transform is the CPU post-processing of librender, see postprocess_cpu.h.
+
+#include "postprocess_cpu.h"
+#include "parallel.h"
+#include "write_image.h"
+#include "../postprocess/tonemapping.h"
+
+#include <tinyexr.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+void print_usage(char const* exe) {
+    printf("Usage: %s [options] <frame.exr>...\n"
+           "  --exposure <ev>          exposure in stops (default 0)\n"
+           "  --tonemap <mode>         tone mapping mode, index or name of tonemapping.h (default none)\n"
+           "  --color-balance <r g b>  white balance multipliers in LMS space (default 1 1 1)\n"
+           "  --linear                 skip the sRGB encoding\n"
+           "  --exr                    store 32 bit float EXRs instead of 8 bit PNGs\n"
+           "  --threads <n>            number of worker threads (default all)\n", exe);
+}
+
+int parse_tone_mapping_mode(char const* arg) {
+    static char const* const names[] = { TONEMAPPING_MODES_NAMES };
+    for (int i = 0; i < int(sizeof(names) / sizeof(names[0])); ++i)
+        if (!strcmp(arg, names[i]))
+            return i;
+    return atoi(arg);
+}
+
+std::string display_path(std::string const& frame) {
+    std::string path = frame;
+    size_t ext = path.rfind(".exr");
+    if (ext != std::string::npos && ext + 4 == path.size())
+        path.resize(ext);
+    return path + "_display";
+}
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    PostProcessParams params;
+    bool write_exr = false;
+    std::vector<char const*> frames;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--exposure") && i + 1 < argc)
+            params.exposure = float(atof(argv[++i]));
+        else if (!strcmp(argv[i], "--tonemap") && i + 1 < argc)
+            params.tone_mapping_mode = parse_tone_mapping_mode(argv[++i]);
+        else if (!strcmp(argv[i], "--color-balance") && i + 3 < argc) {
+            for (int c = 0; c < 3; ++c)
+                params.color_balance[c] = float(atof(argv[++i]));
+        }
+        else if (!strcmp(argv[i], "--linear"))
+            params.srgb_encode = false;
+        else if (!strcmp(argv[i], "--exr"))
+            write_exr = true;
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else if (argv[i][0] == '-') {
+            print_usage(argv[0]);
+            return 1;
+        }
+        else
+            frames.push_back(argv[i]);
+    }
+    if (frames.empty()) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    int num_failed = 0;
+    std::vector<uint8_t> display8;
+    std::vector<float> display;
+    for (char const* frame : frames) {
+        float* hdr = nullptr;
+        int width = 0, height = 0;
+        char const* error = nullptr;
+        // always RGBA, missing channels are filled in
+        if (LoadEXR(&hdr, &width, &height, frame, &error) != TINYEXR_SUCCESS) {
+            printf("Failed to load %s: %s\n", frame, error ? error : "unknown error");
+            FreeEXRErrorMessage(error);
+            ++num_failed;
+            continue;
+        }
+
+        std::string out = display_path(frame);
+        bool written;
+        if (write_exr) {
+            display.resize(size_t(width) * height * 4);
+            postprocess_to_rgba32f(params, width, height, 4, hdr, display.data());
+            written = WriteImage::write_exr(out.c_str(), width, height, 4, display.data(), EXR_COMPRESSION_ZIP);
+        }
+        else {
+            display8.resize(size_t(width) * height * 4);
+            postprocess_to_rgba8(params, width, height, 4, hdr, display8.data());
+            written = WriteImage::write_png(out.c_str(), width, height, 4, display8.data());
+        }
+        free(hdr);
+
+        if (written)
+            printf("%s -> %s%s\n", frame, out.c_str(), write_exr ? ".exr" : ".png");
+        else
+            ++num_failed;
+    }
+    return num_failed ? 1 : 0;
+}
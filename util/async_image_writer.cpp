@@ -0,0 +1,143 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "async_image_writer.h"
+#include "error_io.h"
+#include "parallel.h"
+#include "profiling.h"
+#include <algorithm>
+
+AsyncImageWriter::AsyncImageWriter(int num_encoders, int max_pending)
+    : num_encoders(num_encoders)
+    , max_pending(max_pending) {
+    if (this->num_encoders <= 0)
+        this->num_encoders = std::min(std::max(int(std::thread::hardware_concurrency()) / 2, 1), 4);
+    if (this->max_pending <= 0)
+        this->max_pending = 2 * this->num_encoders;
+    // callers may hold a scratch buffer while filling the one to write
+    this->max_pending = std::max(this->max_pending, 2);
+}
+
+AsyncImageWriter::~AsyncImageWriter() {
+    if (!flush())
+        println(CLL::CRITICAL, "Failed to write some of the queued images");
+    {
+        std::lock_guard<std::mutex> g(mutex);
+        shutdown = true;
+    }
+    job_available.notify_all();
+    for (auto& encoder : encoders)
+        encoder.join();
+}
+
+ImageWriteBuffer AsyncImageWriter::acquire(size_t byte_size) {
+    ImageWriteBuffer buffer;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        buffer_returned.wait(lock, [&]() { return buffers_out < max_pending; });
+        ++buffers_out;
+        if (!free_buffers.empty()) {
+            buffer = std::move(free_buffers.back());
+            free_buffers.pop_back();
+        }
+    }
+    // recycled buffers keep their capacity, same-sized frames do not reallocate
+    buffer.bytes.resize(byte_size);
+    return buffer;
+}
+
+void AsyncImageWriter::release(ImageWriteBuffer&& buffer) {
+    {
+        std::lock_guard<std::mutex> g(mutex);
+        free_buffers.push_back(std::move(buffer));
+        --buffers_out;
+    }
+    buffer_returned.notify_one();
+}
+
+void AsyncImageWriter::write_png(std::string filename, unsigned width, unsigned height, unsigned channels,
+    ImageWriteBuffer&& pixels) {
+    submit({ std::move(filename), PNG, width, height, channels, EXR_COMPRESSION_NONE, std::move(pixels) });
+}
+
+void AsyncImageWriter::write_pfm(std::string filename, unsigned width, unsigned height, unsigned channels,
+    ImageWriteBuffer&& pixels) {
+    submit({ std::move(filename), PFM, width, height, channels, EXR_COMPRESSION_NONE, std::move(pixels) });
+}
+
+void AsyncImageWriter::write_exr(std::string filename, unsigned width, unsigned height, unsigned channels,
+    ImageWriteBuffer&& pixels, ExrCompression compression) {
+    submit({ std::move(filename), EXR_FLOAT, width, height, channels, compression, std::move(pixels) });
+}
+
+void AsyncImageWriter::write_exr_f16_pixels(std::string filename, unsigned width, unsigned height, unsigned channels,
+    ImageWriteBuffer&& pixels, ExrCompression compression) {
+    submit({ std::move(filename), EXR_HALF, width, height, channels, compression, std::move(pixels) });
+}
+
+bool AsyncImageWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    jobs_done.wait(lock, [&]() { return unfinished_jobs == 0; });
+    bool success = failed_jobs == 0;
+    failed_jobs = 0;
+    return success;
+}
+
+void AsyncImageWriter::submit(Job&& job) {
+    {
+        std::lock_guard<std::mutex> g(mutex);
+        // encoders are started on first use, interactive sessions rarely write images
+        if (encoders.empty()) {
+            for (int i = 0; i < num_encoders; ++i)
+                encoders.emplace_back(&AsyncImageWriter::encoder_loop, this);
+        }
+        jobs.push_back(std::move(job));
+        ++unfinished_jobs;
+    }
+    job_available.notify_one();
+}
+
+void AsyncImageWriter::encoder_loop() {
+    set_profiling_thread_name("Image encoder");
+    // encoders run concurrently with rendering, the parallel EXR strip encoding runs serially
+    set_parallel_thread_serial(true);
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        job_available.wait(lock, [&]() { return shutdown || !jobs.empty(); });
+        // flush() in the destructor drains the queue before shutdown
+        if (jobs.empty())
+            return;
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        lock.unlock();
+
+        bool success = encode(job);
+
+        lock.lock();
+        free_buffers.push_back(std::move(job.pixels));
+        --buffers_out;
+        failed_jobs += !success;
+        if (--unfinished_jobs == 0)
+            jobs_done.notify_all();
+        buffer_returned.notify_one();
+    }
+}
+
+bool AsyncImageWriter::encode(Job& job) {
+    char const* filename = job.filename.c_str();
+    switch (job.encoding) {
+    case PNG:
+        return WriteImage::write_png(filename, job.width, job.height, job.channels,
+            job.pixels.data<unsigned char>());
+    case PFM:
+        return WriteImage::write_pfm(filename, job.width, job.height, job.channels,
+            job.pixels.data<float>());
+    case EXR_FLOAT:
+        return WriteImage::write_exr(filename, job.width, job.height, job.channels,
+            job.pixels.data<float>(), job.compression);
+    case EXR_HALF:
+        return WriteImage::write_exr(filename, job.width, job.height, job.channels,
+            job.pixels.data<uint16_t>(), job.compression);
+    }
+    return false;
+}
@@ -0,0 +1,85 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "write_image.h"
+
+// Pixel storage handed from the caller to the writer, recycled between images.
+struct ImageWriteBuffer {
+    std::vector<unsigned char> bytes;
+
+    template <class T>
+    T* data() { return reinterpret_cast<T*>(bytes.data()); }
+};
+
+/* Encodes and writes images on a pool of encoder threads, so that compressing
+ * captured frames overlaps with rendering the next ones. Pixel buffers are
+ * taken from a recycled pool with acquire(), filled by the caller, usually by
+ * a readback, and handed over to one of the write functions. At most
+ * max_pending buffers are out at any time: acquire() blocks while the encoders
+ * fall behind, which bounds the memory of the queue. flush() and the
+ * destructor wait until every queued image has been written.
+ */
+struct AsyncImageWriter {
+    // num_encoders <= 0 picks a default, max_pending <= 0 twice the encoder count, at least 2
+    AsyncImageWriter(int num_encoders = 0, int max_pending = 0);
+    ~AsyncImageWriter();
+
+    AsyncImageWriter(AsyncImageWriter const&) = delete;
+    AsyncImageWriter& operator=(AsyncImageWriter const&) = delete;
+
+    // buffer of byte_size bytes from the pool, blocks while max_pending buffers are out
+    ImageWriteBuffer acquire(size_t byte_size);
+    // returns a buffer that is not written to the pool
+    void release(ImageWriteBuffer&& buffer);
+
+    // same formats as WriteImage, filename without extension, pixels from acquire()
+    void write_png(std::string filename, unsigned width, unsigned height, unsigned channels,
+        ImageWriteBuffer&& pixels);
+    void write_pfm(std::string filename, unsigned width, unsigned height, unsigned channels,
+        ImageWriteBuffer&& pixels);
+    void write_exr(std::string filename, unsigned width, unsigned height, unsigned channels,
+        ImageWriteBuffer&& pixels, ExrCompression compression);
+    // pixels are already half floats, unlike WriteImage::write_exr_half() which converts floats
+    void write_exr_f16_pixels(std::string filename, unsigned width, unsigned height, unsigned channels,
+        ImageWriteBuffer&& pixels, ExrCompression compression);
+
+    // Waits until all queued images are written.
+    // Returns false if any write failed since the last flush.
+    bool flush();
+
+private:
+    enum Encoding { PNG, PFM, EXR_FLOAT, EXR_HALF };
+    struct Job {
+        std::string filename;
+        Encoding encoding;
+        unsigned width, height, channels;
+        ExrCompression compression;
+        ImageWriteBuffer pixels;
+    };
+
+    void submit(Job&& job);
+    void encoder_loop();
+    static bool encode(Job& job);
+
+    std::mutex mutex;
+    std::condition_variable job_available;
+    std::condition_variable buffer_returned;
+    std::condition_variable jobs_done;
+    std::deque<Job> jobs;
+    std::vector<ImageWriteBuffer> free_buffers;
+    std::vector<std::thread> encoders;
+    int num_encoders;
+    int max_pending;
+    int buffers_out = 0;
+    int unfinished_jobs = 0;
+    int failed_jobs = 0;
+    bool shutdown = false;
+};
@@ -1,12 +1,29 @@
 // Copyright 2023 Intel Corporation.
 // SPDX-License-Identifier: MIT
 
+// Compares EXR images against a reference and reports error statistics.
+// The images are processed in horizontal strips on all threads. With --stream,
+// strips are decoded straight from the files instead of loading the images,
+// which bounds the memory to a few strips per thread for gigapixel images.
+
+#include "parallel.h"
+
 #include <tinyexr.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 struct Image {
@@ -14,6 +31,12 @@ struct Image {
     EXRImage image;
 };
 
+static void free_image(Image &img)
+{
+    FreeEXRImage(&img.image);
+    FreeEXRHeader(&img.header);
+}
+
 Image load_exr(const char *filename)
 {
     EXRHeader header = {};
@@ -26,7 +49,7 @@ Image load_exr(const char *filename)
         const std::string what(error);
         FreeEXRErrorMessage(error);
         throw std::runtime_error(what);
-    } 
+    }
 
     for (int c = 0; c < header.num_channels; ++c) {
         header.requested_pixel_types[c] = TINYEXR_PIXELTYPE_FLOAT;
@@ -48,96 +71,653 @@ Image load_exr(const char *filename)
     return { header, image };
 }
 
-bool compare(const Image &ref, const Image &cmp, const std::string &errImg)
+/* Decodes horizontal strips of whole chunks of a single part scanline EXR
+ * without loading the image. For each strip, a small EXR is assembled in
+ * memory from the file header, with the data window cut to the strip, and
+ * the chunks of the strip, and decoded by tinyexr.
+ */
+struct ExrStripReader {
+    std::string path;
+    std::vector<unsigned char> header; // attributes, up to the offset table
+    size_t data_window_pos = 0;
+    int min_y = 0;
+    int width = 0, height = 0;
+    int lines_per_block = 1;
+    int num_channels = 0;
+    std::vector<std::string> channel_names;
+    std::vector<uint64_t> offsets;
+
+    void open(const char *filename);
+    // rows [y, y + lines) relative to the data window, y a multiple of lines_per_block
+    Image read_strip(std::ifstream &file, int y, int lines, std::vector<unsigned char> &memory) const;
+};
+
+static uint32_t read_u32(const unsigned char *p) { uint32_t v; memcpy(&v, p, 4); return v; }
+
+// Scanlines per chunk, as defined by the EXR format for each compression.
+static int exr_lines_per_block(int compression)
+{
+    switch (compression) {
+    case 0: // NONE
+    case 1: // RLE
+    case 2: // ZIPS
+        return 1;
+    case 3: // ZIP
+    case 5: // PXR24
+        return 16;
+    case 9: // DWAB
+        return 256;
+    default: // PIZ, B44, B44A, DWAA
+        return 32;
+    }
+}
+
+void ExrStripReader::open(const char *filename)
 {
-    if (ref.image.width != cmp.image.width
-     || ref.image.height != cmp.image.height
-     || ref.image.num_channels != cmp.image.num_channels)
+    path = filename;
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("Cannot open " + path);
+
+    // grow the read until the attribute list is complete
+    std::vector<unsigned char> buffer;
+    size_t header_size = 0;
+    int compression = -1;
+    int data_window[4] = {};
+    for (size_t read_size = 1 << 16; !header_size; read_size *= 4) {
+        buffer.resize(read_size);
+        file.clear();
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer.data()), read_size);
+        const size_t size = size_t(file.gcount());
+        buffer.resize(size);
+        if (size < 8 || read_u32(buffer.data()) != 20000630u)
+            throw std::runtime_error(path + " is not an EXR file");
+        // tiled, deep or multi part
+        if (read_u32(buffer.data() + 4) & 0x1a00u)
+            throw std::runtime_error(path + ": only single part scanline images can be streamed");
+
+        // attributes are name, type, size and value, terminated by an empty name
+        size_t pos = 8;
+        bool complete = false;
+        while (pos < size) {
+            if (!buffer[pos]) {
+                complete = true;
+                break;
+            }
+            const char *name = reinterpret_cast<const char*>(&buffer[pos]);
+            const void *name_end = memchr(&buffer[pos], 0, size - pos);
+            if (!name_end)
+                break;
+            pos = static_cast<const unsigned char*>(name_end) - buffer.data() + 1;
+            const void *type_end = pos < size ? memchr(&buffer[pos], 0, size - pos) : nullptr;
+            if (!type_end)
+                break;
+            pos = static_cast<const unsigned char*>(type_end) - buffer.data() + 1;
+            if (pos + 4 > size)
+                break;
+            const size_t value_size = read_u32(&buffer[pos]);
+            pos += 4;
+            if (pos + value_size > size)
+                break;
+            if (!strcmp(name, "compression") && value_size == 1)
+                compression = buffer[pos];
+            else if (!strcmp(name, "dataWindow") && value_size == 16) {
+                data_window_pos = pos;
+                memcpy(data_window, &buffer[pos], 16);
+            }
+            else if (!strcmp(name, "tiles") || !strcmp(name, "chunkCount"))
+                throw std::runtime_error(path + ": only single part scanline images can be streamed");
+            pos += value_size;
+        }
+        if (complete)
+            header_size = pos + 1;
+        else if (size < read_size)
+            throw std::runtime_error(path + ": truncated header");
+    }
+    if (compression < 0 || !data_window_pos)
+        throw std::runtime_error(path + ": missing compression or data window");
+    header.assign(buffer.begin(), buffer.begin() + header_size);
+
+    min_y = data_window[1];
+    width = data_window[2] - data_window[0] + 1;
+    height = data_window[3] - data_window[1] + 1;
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(path + ": invalid data window");
+    lines_per_block = exr_lines_per_block(compression);
+
+    const size_t num_blocks = size_t(height + lines_per_block - 1) / lines_per_block;
+    offsets.resize(num_blocks);
+    file.clear();
+    file.seekg(std::streamoff(header_size));
+    file.read(reinterpret_cast<char*>(offsets.data()), std::streamsize(num_blocks * 8));
+    if (size_t(file.gcount()) != num_blocks * 8)
+        throw std::runtime_error(path + ": truncated offset table");
+
+    // channel list of the header, as tinyexr sees it
+    EXRVersion version = {};
+    EXRHeader exr_header = {};
+    const char *error = nullptr;
+    if (ParseEXRVersionFromMemory(&version, header.data(), header.size()) != TINYEXR_SUCCESS
+     || ParseEXRHeaderFromMemory(&exr_header, &version, header.data(), header.size(), &error) != TINYEXR_SUCCESS) {
+        const std::string what = path + ": " + (error ? error : "invalid header");
+        FreeEXRErrorMessage(error);
+        throw std::runtime_error(what);
+    }
+    num_channels = exr_header.num_channels;
+    for (int c = 0; c < num_channels; ++c)
+        channel_names.push_back(exr_header.channels[c].name);
+    FreeEXRHeader(&exr_header);
+}
+
+Image ExrStripReader::read_strip(std::ifstream &file, int y, int lines, std::vector<unsigned char> &memory) const
+{
+    const size_t first_block = size_t(y / lines_per_block);
+    const size_t num_blocks = size_t(lines + lines_per_block - 1) / lines_per_block;
+
+    memory.assign(header.begin(), header.end());
+    int strip_window[2] = { min_y + y, min_y + y + lines - 1 };
+    memcpy(memory.data() + data_window_pos + 4, &strip_window[0], 4);
+    memcpy(memory.data() + data_window_pos + 12, &strip_window[1], 4);
+    const size_t table_pos = memory.size();
+    memory.resize(table_pos + 8 * num_blocks);
+
+    for (size_t b = 0; b < num_blocks; ++b) {
+        // chunks are the y coordinate, the data size and the data
+        const uint64_t chunk_pos = memory.size();
+        memcpy(memory.data() + table_pos + 8 * b, &chunk_pos, 8);
+        unsigned char chunk_header[8];
+        file.clear();
+        file.seekg(std::streamoff(offsets[first_block + b]));
+        file.read(reinterpret_cast<char*>(chunk_header), 8);
+        const size_t data_size = read_u32(chunk_header + 4);
+        if (file.gcount() != 8 || int(read_u32(chunk_header)) != min_y + y + int(b) * lines_per_block)
+            throw std::runtime_error(path + ": invalid chunk");
+        memory.insert(memory.end(), chunk_header, chunk_header + 8);
+        memory.resize(chunk_pos + 8 + data_size);
+        file.read(reinterpret_cast<char*>(memory.data() + chunk_pos + 8), std::streamsize(data_size));
+        if (size_t(file.gcount()) != data_size)
+            throw std::runtime_error(path + ": truncated chunk");
+    }
+
+    Image strip = {};
+    EXRVersion version = {};
+    const char *error = nullptr;
+    if (ParseEXRVersionFromMemory(&version, memory.data(), memory.size()) != TINYEXR_SUCCESS
+     || ParseEXRHeaderFromMemory(&strip.header, &version, memory.data(), memory.size(), &error) != TINYEXR_SUCCESS) {
+        const std::string what = path + ": " + (error ? error : "invalid header");
+        FreeEXRErrorMessage(error);
+        throw std::runtime_error(what);
+    }
+    for (int c = 0; c < strip.header.num_channels; ++c)
+        strip.header.requested_pixel_types[c] = TINYEXR_PIXELTYPE_FLOAT;
+    if (LoadEXRImageFromMemory(&strip.image, &strip.header, memory.data(), memory.size(), &error) != TINYEXR_SUCCESS) {
+        const std::string what = path + ": " + (error ? error : "failed to decode strip");
+        FreeEXRErrorMessage(error);
+        FreeEXRHeader(&strip.header);
+        throw std::runtime_error(what);
+    }
+    return strip;
+}
+
+// Offset added to the denominators of relMSE and SMAPE, avoids blowing up dark pixels.
+static const float metric_epsilon = 1.e-2f;
+
+struct ChannelStats {
+    double sum_sq_error = 0.0;
+    double sum_rel_sq_error = 0.0;
+    double sum_smape = 0.0;
+    float max_abs_error = 0.0f;
+    float max_rel_error = 0.0f;
+    uint64_t count = 0;
+    uint64_t nonfinite = 0;
+
+    void merge(const ChannelStats &o)
     {
-        std::cerr << "Images must have the same size as the reference image" << std::endl;
-        return false;
+        sum_sq_error += o.sum_sq_error;
+        sum_rel_sq_error += o.sum_rel_sq_error;
+        sum_smape += o.sum_smape;
+        max_abs_error = std::max(max_abs_error, o.max_abs_error);
+        max_rel_error = std::max(max_rel_error, o.max_rel_error);
+        count += o.count;
+        nonfinite += o.nonfinite;
     }
+};
 
-    const std::size_t numPixels = size_t(ref.image.width) * ref.image.height;
+/* Accumulates the error statistics of n samples of one channel and stores the
+ * relative error of each sample, |cmp - ref| / |ref|, or |cmp| where ref is zero.
+ * Samples that are NaN or infinite in only one of the images, or where the
+ * error overflows, count as nonfinite with infinite relative error and are
+ * excluded from the sums. Written in fixed lanes for the auto-vectorizer.
+ */
+static void accumulate_errors(ChannelStats &stats, const float *ref, const float *cmp, size_t n, float *rel_error)
+{
+    constexpr size_t lanes = 8;
+    float sq[lanes] = {}, rel_sq[lanes] = {}, smape[lanes] = {};
+    float max_abs[lanes] = {}, max_rel[lanes] = {};
+    unsigned nonfinite[lanes] = {};
 
-    bool equal = true;
+    auto lane = [&](size_t l, size_t i) {
+        const float r = ref[i], c = cmp[i];
+        // NaNs and infinities that match the reference are no error
+        const bool same = r == c || (r != r && c != c);
+        const float d = same ? 0.0f : c - r;
+        const float ad = std::fabs(d);
+        const bool finite = ad <= std::numeric_limits<float>::max();
+        const bool error = finite && ad != 0.0f;
+        const float ar = std::fabs(r), ac = std::fabs(c);
+        const float rel = error ? ad / (ar == 0.0f ? 1.0f : ar) : 0.0f;
+        const float d2 = error ? d * d : 0.0f;
+        sq[l] += d2;
+        rel_sq[l] += error ? d2 / (r * r + metric_epsilon) : 0.0f;
+        smape[l] += error ? ad / (ar + ac + metric_epsilon) : 0.0f;
+        max_abs[l] = std::max(max_abs[l], finite ? ad : 0.0f);
+        max_rel[l] = std::max(max_rel[l], rel);
+        nonfinite[l] += !finite;
+        rel_error[i] = finite ? rel : std::numeric_limits<float>::infinity();
+    };
 
-    std::vector<float> errorImage(ref.image.num_channels * numPixels);
-    for (int z = 0; z < ref.image.num_channels; ++z) {
-        const float *pref = reinterpret_cast<const float *>(ref.image.images[z]);
-        const float *pcmp = reinterpret_cast<const float *>(cmp.image.images[z]);
-        float *perr = errorImage.data() + z;
-        for (size_t p = 0; p < numPixels; ++p, perr += ref.image.num_channels)
-        {
-            const float vref = pref[p];
-            const float vcmp = pcmp[p];
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes)
+        for (size_t l = 0; l < lanes; ++l)
+            lane(l, i + l);
+    for (size_t l = 0; i + l < n; ++l)
+        lane(l, i + l);
 
-            float relError = 0.f;
-            if (vref == 0.f)
-                relError = std::fabs(vcmp);
-            else
-                relError = std::fabs(vref-vcmp) / vref;
+    for (size_t l = 0; l < lanes; ++l) {
+        stats.sum_sq_error += sq[l];
+        stats.sum_rel_sq_error += rel_sq[l];
+        stats.sum_smape += smape[l];
+        stats.max_abs_error = std::max(stats.max_abs_error, max_abs[l]);
+        stats.max_rel_error = std::max(stats.max_rel_error, max_rel[l]);
+        stats.nonfinite += nonfinite[l];
+    }
+    stats.count += n;
+}
 
-            *perr = relError;
+/* Histogram of the relative errors for percentiles, one bucket per float
+ * exponent and 7 leading mantissa bits, i.e. within 1% of the exact value.
+ */
+struct ErrorHistogram {
+    static const int shift = 16;
+    std::vector<uint64_t> buckets = std::vector<uint64_t>((0x7f800000u >> shift) + 1, 0);
 
-            if (relError > 1e-6f)
-                equal = false;
+    void add(const float *rel_error, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t bits;
+            memcpy(&bits, &rel_error[i], 4);
+            buckets[bits >> shift]++;
+        }
+    }
+    void merge(const ErrorHistogram &o)
+    {
+        for (size_t b = 0; b < buckets.size(); ++b)
+            buckets[b] += o.buckets[b];
+    }
+    // upper bound of the p-th percentile
+    float percentile(double p) const
+    {
+        const uint64_t total = std::accumulate(buckets.begin(), buckets.end(), uint64_t(0));
+        const uint64_t rank = std::max(uint64_t(std::ceil(p / 100.0 * double(total))), uint64_t(1));
+        uint64_t seen = 0;
+        for (size_t b = 0; b < buckets.size(); ++b) {
+            seen += buckets[b];
+            if (seen >= rank) {
+                if (b == 0)
+                    return 0.0f;
+                if (b == buckets.size() - 1)
+                    return std::numeric_limits<float>::infinity();
+                uint32_t bits = uint32_t(b << shift) | ((1u << shift) - 1);
+                float value;
+                memcpy(&value, &bits, 4);
+                return value;
+            }
         }
+        return 0.0f;
     }
+};
+
+static const double reported_percentiles[] = { 50.0, 90.0, 95.0, 99.0, 99.9 };
+
+struct Comparison {
+    std::string image;
+    std::string error; // empty if compared
+    int width = 0, height = 0;
+    std::vector<std::string> channel_names;
+    std::vector<ChannelStats> channels;
+    ChannelStats total;
+    std::vector<float> percentiles;
+    bool pass = false;
+};
+
+struct CompareOptions {
+    float threshold = 1e-6f;
+    bool error_image = false;
+    bool stream = false;
+};
 
-    const char *err = nullptr;
-    SaveEXR(errorImage.data(), ref.image.width, ref.image.height,
-            ref.image.num_channels, 0, errImg.c_str(), &err);
-    if (err) {
-        std::cerr << err << std::endl;
-        FreeEXRErrorMessage(err);
+// Rows per strip, a multiple of the chunk lines of both images, about 1M pixels.
+static int strip_rows(int width, int lines_per_block)
+{
+    const int target = std::max((1 << 20) / std::max(width, 1), 1);
+    return std::max(target / lines_per_block, 1) * lines_per_block;
+}
+
+/* Compares strips of rows in parallel. get_strip(y, lines, thread_idx, ref, cmp)
+ * provides the channel rows of both images, each strip accumulates its own
+ * statistics so that the sums do not depend on the scheduling.
+ */
+template <class GetStrip>
+static void compare_strips(Comparison &result, const CompareOptions &options,
+    int width, int height, int num_channels, int rows, GetStrip &&get_strip)
+{
+    const int num_strips = (height + rows - 1) / rows;
+    std::vector<std::vector<ChannelStats>> strip_stats(num_strips, std::vector<ChannelStats>(num_channels));
+    std::vector<ErrorHistogram> histograms(parallel_thread_count());
+    std::vector<std::vector<float>> rel_errors(parallel_thread_count());
+    std::vector<float> errorImage;
+    if (options.error_image)
+        errorImage.resize(size_t(num_channels) * width * height);
+
+    parallel_for(0, num_strips, 1, [&](index_t s, int thread_idx) {
+        const int y = int(s) * rows;
+        const int lines = std::min(rows, height - y);
+        const size_t numPixels = size_t(width) * lines;
+        std::vector<const float*> ref(num_channels), cmp(num_channels);
+        auto release = get_strip(y, lines, thread_idx, ref.data(), cmp.data());
+
+        std::vector<float> &rel = rel_errors[thread_idx];
+        rel.resize(numPixels);
+        for (int z = 0; z < num_channels; ++z) {
+            accumulate_errors(strip_stats[s][z], ref[z], cmp[z], numPixels, rel.data());
+            histograms[thread_idx].add(rel.data(), numPixels);
+            if (options.error_image) {
+                float *perr = errorImage.data() + size_t(y) * width * num_channels + z;
+                for (size_t p = 0; p < numPixels; ++p, perr += num_channels)
+                    *perr = rel[p];
+            }
+        }
+        release();
+    });
+
+    result.channels.assign(num_channels, ChannelStats());
+    for (const auto &stats : strip_stats)
+        for (int z = 0; z < num_channels; ++z)
+            result.channels[z].merge(stats[z]);
+    for (const ChannelStats &stats : result.channels)
+        result.total.merge(stats);
+    for (size_t t = 1; t < histograms.size(); ++t)
+        histograms[0].merge(histograms[t]);
+    for (double p : reported_percentiles)
+        result.percentiles.push_back(histograms[0].percentile(p));
+    result.pass = result.total.max_rel_error <= options.threshold && result.total.nonfinite == 0;
+
+    if (options.error_image) {
+        const std::string errImg = result.image + "_err.exr";
+        const char *err = nullptr;
+        SaveEXR(errorImage.data(), width, height, num_channels, 0, errImg.c_str(), &err);
+        if (err) {
+            std::cerr << err << std::endl;
+            FreeEXRErrorMessage(err);
+        }
     }
+}
 
-    return equal;
+static bool same_size(Comparison &result, int width, int height, int num_channels,
+    int ref_width, int ref_height, int ref_num_channels)
+{
+    if (width != ref_width || height != ref_height || num_channels != ref_num_channels) {
+        result.error = "Images must have the same size as the reference image";
+        return false;
+    }
+    result.width = width;
+    result.height = height;
+    return true;
 }
 
-int compare(int numFiles, char **files)
+void compare(Comparison &result, const Image &ref, const Image &cmp, const CompareOptions &options)
+{
+    const EXRImage &r = ref.image, &c = cmp.image;
+    if (!same_size(result, c.width, c.height, c.num_channels, r.width, r.height, r.num_channels))
+        return;
+    for (int z = 0; z < r.num_channels; ++z)
+        result.channel_names.push_back(ref.header.channels[z].name);
+
+    compare_strips(result, options, r.width, r.height, r.num_channels, strip_rows(r.width, 1),
+        [&](int y, int, int, const float **pref, const float **pcmp) {
+            const size_t offset = size_t(y) * r.width;
+            for (int z = 0; z < r.num_channels; ++z) {
+                pref[z] = reinterpret_cast<const float *>(r.images[z]) + offset;
+                pcmp[z] = reinterpret_cast<const float *>(c.images[z]) + offset;
+            }
+            return []() { };
+        });
+}
+
+void compare_streamed(Comparison &result, const ExrStripReader &ref, const ExrStripReader &cmp,
+    const CompareOptions &options)
+{
+    if (!same_size(result, cmp.width, cmp.height, cmp.num_channels, ref.width, ref.height, ref.num_channels))
+        return;
+    result.channel_names = ref.channel_names;
+
+    struct ThreadFiles {
+        std::ifstream ref, cmp;
+        std::vector<unsigned char> memory;
+    };
+    std::vector<ThreadFiles> files(parallel_thread_count());
+    const int lines_per_block = std::lcm(ref.lines_per_block, cmp.lines_per_block);
+
+    compare_strips(result, options, ref.width, ref.height, ref.num_channels,
+        strip_rows(ref.width, lines_per_block),
+        [&](int y, int lines, int thread_idx, const float **pref, const float **pcmp) {
+            ThreadFiles &f = files[thread_idx];
+            if (!f.ref.is_open()) {
+                f.ref.open(ref.path, std::ios::binary);
+                f.cmp.open(cmp.path, std::ios::binary);
+            }
+            auto strips = std::make_shared<std::pair<Image, Image>>();
+            strips->first = ref.read_strip(f.ref, y, lines, f.memory);
+            try {
+                strips->second = cmp.read_strip(f.cmp, y, lines, f.memory);
+            } catch (...) {
+                free_image(strips->first);
+                throw;
+            }
+            for (int z = 0; z < ref.num_channels; ++z) {
+                pref[z] = reinterpret_cast<const float *>(strips->first.image.images[z]);
+                pcmp[z] = reinterpret_cast<const float *>(strips->second.image.images[z]);
+            }
+            return [strips]() {
+                free_image(strips->first);
+                free_image(strips->second);
+            };
+        });
+}
+
+// JSON numbers cannot be infinite
+static double json_number(double v)
+{
+    return std::isinf(v) ? std::numeric_limits<double>::max() : v;
+}
+
+static std::string json_string(const std::string &s)
+{
+    std::string escaped;
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        if (c >= 0 && c < 0x20)
+            continue;
+        escaped += c;
+    }
+    return escaped;
+}
+
+static void write_json_stats(FILE *file, const ChannelStats &stats)
+{
+    const double n = double(std::max(stats.count - stats.nonfinite, uint64_t(1)));
+    fprintf(file, "\"rmse\": %.9g, \"relmse\": %.9g, \"smape\": %.9g, \"max_abs_error\": %.9g, "
+        "\"max_rel_error\": %.9g, \"nonfinite\": %llu",
+        json_number(std::sqrt(stats.sum_sq_error / n)), json_number(stats.sum_rel_sq_error / n),
+        json_number(stats.sum_smape / n), json_number(stats.max_abs_error), json_number(stats.max_rel_error),
+        (unsigned long long) stats.nonfinite);
+}
+
+static void write_json(FILE *file, const char *reference, const CompareOptions &options,
+    const std::vector<Comparison> &results)
+{
+    fprintf(file, "{\n  \"reference\": \"%s\",\n  \"threshold\": %g,\n  \"comparisons\": [\n",
+        json_string(reference).c_str(), options.threshold);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Comparison &res = results[i];
+        fprintf(file, "    {\"image\": \"%s\", \"pass\": %s", json_string(res.image).c_str(), res.pass ? "true" : "false");
+        if (!res.error.empty())
+            fprintf(file, ", \"error\": \"%s\"", json_string(res.error).c_str());
+        else {
+            fprintf(file, ", \"width\": %d, \"height\": %d, ", res.width, res.height);
+            write_json_stats(file, res.total);
+            fprintf(file, ",\n      \"percentiles\": {");
+            for (size_t p = 0; p < res.percentiles.size(); ++p)
+                fprintf(file, "%s\"%g\": %.9g", p ? ", " : "", reported_percentiles[p], json_number(res.percentiles[p]));
+            fprintf(file, "},\n      \"channels\": {");
+            for (size_t z = 0; z < res.channels.size(); ++z) {
+                fprintf(file, "%s\n        \"%s\": {", z ? "," : "", json_string(res.channel_names[z]).c_str());
+                write_json_stats(file, res.channels[z]);
+                fprintf(file, "}");
+            }
+            fprintf(file, "\n      }");
+        }
+        fprintf(file, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+}
+
+static void print_summary(std::ostream &out, const Comparison &res)
+{
+    const double n = double(std::max(res.total.count - res.total.nonfinite, uint64_t(1)));
+    out << "  rmse " << std::sqrt(res.total.sum_sq_error / n)
+        << ", relmse " << res.total.sum_rel_sq_error / n
+        << ", smape " << res.total.sum_smape / n
+        << ", max rel error " << res.total.max_rel_error
+        << ", p99 rel error " << res.percentiles[3];
+    if (res.total.nonfinite)
+        out << ", " << res.total.nonfinite << " nonfinite";
+    out << std::endl;
+}
+
+int compare(int numFiles, char **files, const CompareOptions &options, const char *jsonPath)
 {
     assert(numFiles > 1);
     bool error = false;
+    // keep stdout clean for the JSON
+    std::ostream &log = jsonPath && !strcmp(jsonPath, "-") ? std::cerr : std::cout;
+
+    std::vector<Comparison> results;
+    Image ref = {};
+    ExrStripReader refReader;
+    try {
+        if (options.stream)
+            refReader.open(files[0]);
+        else
+            ref = load_exr(files[0]);
+    } catch (const std::runtime_error &e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
 
-    std::vector<Image> images;
-    images.reserve(static_cast<size_t>(numFiles));
-    for (int i = 0; i < numFiles; ++i) {
+    for (int i = 1; i < numFiles; ++i) {
+        log << "Comparing " << files[i] << " with " << files[0] << std::endl;
+        Comparison result;
+        result.image = files[i];
         try {
-            images.push_back(load_exr(files[i]));
+            if (options.stream) {
+                ExrStripReader cmpReader;
+                cmpReader.open(files[i]);
+                compare_streamed(result, refReader, cmpReader, options);
+            }
+            else {
+                Image cmp = load_exr(files[i]);
+                try {
+                    compare(result, ref, cmp, options);
+                } catch (...) {
+                    free_image(cmp);
+                    throw;
+                }
+                free_image(cmp);
+            }
         } catch (const std::runtime_error &e) {
-            std::cerr << e.what() << std::endl;
-            error = true;
+            result.error = e.what();
         }
-    }
 
-    if (!error) {
-        for (size_t i = 1; i < images.size(); ++i) {
-            std::cout << "Comparing " << files[i] << " with " << files[0] << std::endl;
-            const bool is_equal = compare(images[0], images[i], std::string(files[i])+"_err.exr");
-            if (!is_equal) {
-                std::cerr << files[i] << " isn't the same as " << files[0] << std::endl;
-                error = true;
-            }
+        if (!result.error.empty())
+            std::cerr << result.error << std::endl;
+        else
+            print_summary(log, result);
+        if (!result.pass) {
+            std::cerr << files[i] << " isn't the same as " << files[0] << std::endl;
+            error = true;
         }
+        results.push_back(std::move(result));
     }
 
-    for (Image &img: images) {
-        FreeEXRImage(&img.image);
-        FreeEXRHeader(&img.header);
+    if (!options.stream)
+        free_image(ref);
+
+    if (jsonPath) {
+        FILE *file = strcmp(jsonPath, "-") ? fopen(jsonPath, "w") : stdout;
+        if (file) {
+            write_json(file, files[0], options, results);
+            if (file != stdout)
+                fclose(file);
+        }
+        else {
+            std::cerr << "Cannot write " << jsonPath << std::endl;
+            error = true;
+        }
     }
 
     return error ? -1 : 0;
 }
 
+static void print_usage(const char *exe)
+{
+    std::cerr << "usage: " << exe << " [options] REF CMP [CMP...]\n"
+        "  --threshold <t>  maximum relative error of a passing image (default 1e-6)\n"
+        "  --json <file>    write error statistics as JSON, - for stdout\n"
+        "  --error-image    write the relative error of each sample to CMP_err.exr\n"
+        "  --stream         decode strips from the files instead of loading whole images\n"
+        "  --threads <n>    number of worker threads (default all)" << std::endl;
+}
+
 int main(int argc, char **argv)
 {
-    if (argc < 3) {
-        std::cerr << "usage: " << argv[0] << " REF CMP [CMP...]" << std::endl;
+    CompareOptions options;
+    const char *jsonPath = nullptr;
+    std::vector<char *> files;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--threshold") && i + 1 < argc)
+            options.threshold = float(atof(argv[++i]));
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (!strcmp(argv[i], "--error-image"))
+            options.error_image = true;
+        else if (!strcmp(argv[i], "--stream"))
+            options.stream = true;
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else if (argv[i][0] == '-' && argv[i][1]) {
+            print_usage(argv[0]);
+            return -1;
+        }
+        else
+            files.push_back(argv[i]);
+    }
+    if (files.size() < 2) {
+        print_usage(argv[0]);
         return -1;
     }
 
-    return compare(argc-1, argv+1);
+    return compare(int(files.size()), files.data(), options, jsonPath);
 }
-
@@ -0,0 +1,150 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "compute_cpu.h"
+#include "parallel.h"
+#include "error_io.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace {
+
+struct CpuComputeKernel {
+    std::string name;
+    glm::uvec2 group_size;
+    cpu_compute_kernel_function kernel;
+};
+
+std::mutex& kernel_registry_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<CpuComputeKernel>& kernel_registry() {
+    static std::vector<CpuComputeKernel> kernels;
+    return kernels;
+}
+
+} // namespace
+
+void register_cpu_compute_kernel(char const* name, glm::uvec2 group_size, cpu_compute_kernel_function kernel) {
+    std::lock_guard<std::mutex> lock(kernel_registry_mutex());
+    auto& kernels = kernel_registry();
+    group_size = glm::max(group_size, glm::uvec2(1));
+    for (auto& registered : kernels) {
+        if (registered.name == name) {
+            registered.group_size = group_size;
+            registered.kernel = kernel;
+            return;
+        }
+    }
+    kernels.push_back({ name, group_size, kernel });
+}
+
+void* CpuComputeWorkgroup::buffer(int set, int binding) const {
+    if (set < 0 || set >= (int) bound_sets->size())
+        return nullptr;
+    auto const& bound_set = (*bound_sets)[set];
+    if (binding < 0 || binding >= (int) bound_set.size())
+        return nullptr;
+    return bound_set[binding];
+}
+
+ComputeBufferCPU::ComputeBufferCPU(size_t size)
+    : data(new unsigned char[size]())
+    , data_size(size) {
+}
+void* ComputeBufferCPU::map() {
+    return data.get();
+}
+void ComputeBufferCPU::unmap() {
+}
+size_t ComputeBufferCPU::size() const {
+    return data_size;
+}
+
+std::string ComputeCPU::name() {
+    return "CPU Compute Pipeline";
+}
+
+int ComputeCPU::add_buffer(int bindpoint, GpuBuffer* buffer, bool uniform_buffer) {
+    if (bindpoint >= (int) buffers.size())
+        buffers.resize((size_t) bindpoint + 1, nullptr);
+    buffers[bindpoint] = buffer;
+    return bindpoint;
+}
+
+int ComputeCPU::add_shader(char const* name) {
+    std::lock_guard<std::mutex> lock(kernel_registry_mutex());
+    for (auto const& registered : kernel_registry()) {
+        if (registered.name == name) {
+            int shader_index = (int) shaders.size();
+            shaders.push_back({ registered.kernel, registered.group_size });
+            return shader_index;
+        }
+    }
+    return -1;
+}
+
+int ComputeCPU::add_pipeline(int bindpoint, ComputePipeline* pipeline) {
+    if (bindpoint >= (int) bindings_other.size())
+        bindings_other.resize((size_t) bindpoint + 1, nullptr);
+    bindings_other[bindpoint] = dynamic_cast<ComputeCPU*>(pipeline);
+    return bindpoint;
+}
+
+void ComputeCPU::finalize_build() {
+    // host buffers stay mapped, resolve them once
+    auto resolve = [](std::vector<GpuBuffer*> const& buffers) {
+        std::vector<void*> set(buffers.size(), nullptr);
+        for (size_t i = 0; i < buffers.size(); ++i)
+            set[i] = buffers[i] ? buffers[i]->map() : nullptr;
+        return set;
+    };
+    bound_sets.clear();
+    bound_sets.push_back(resolve(buffers));
+    for (auto* pipeline : bindings_other)
+        bound_sets.push_back(pipeline ? resolve(pipeline->buffers) : std::vector<void*>());
+}
+
+void ComputeCPU::run(CommandStream* stream, int shader_index, glm::uvec2 dispatch_dim) {
+    if (shader_index < 0 || shader_index >= (int) shaders.size())
+        throw_error("Invalid CPU compute shader index %d", shader_index);
+    Shader shader = shaders[shader_index];
+
+    glm::uvec2 group_count = (dispatch_dim + shader.group_size - glm::uvec2(1)) / shader.group_size;
+    index_t total_groups = index_t(group_count.x) * index_t(group_count.y);
+    if (total_groups == 0)
+        return;
+    // a few chunks of workgroups per thread, so that uneven workgroups balance out
+    index_t grain = std::max(total_groups / (index_t(parallel_thread_count()) * 8), index_t(1));
+
+    parallel_for(0, total_groups, grain, [&](index_t group_idx, int) {
+        CpuComputeWorkgroup workgroup;
+        workgroup.group_id = glm::uvec2(unsigned(group_idx % group_count.x), unsigned(group_idx / group_count.x));
+        workgroup.group_size = shader.group_size;
+        workgroup.dispatch_dim = dispatch_dim;
+        workgroup.begin = workgroup.group_id * shader.group_size;
+        workgroup.end = glm::min(workgroup.begin + shader.group_size, dispatch_dim);
+        workgroup.bound_sets = &bound_sets;
+        shader.kernel(workgroup);
+    });
+}
+
+CommandStream* ComputeDeviceCPU::sync_command_stream() {
+    return &stream;
+}
+std::unique_ptr<GpuBuffer> ComputeDeviceCPU::create_uniform_buffer(size_t size) {
+    return std::unique_ptr<GpuBuffer>{ new ComputeBufferCPU(size) };
+}
+std::unique_ptr<GpuBuffer> ComputeDeviceCPU::create_buffer(size_t size) {
+    return std::unique_ptr<GpuBuffer>{ new ComputeBufferCPU(size) };
+}
+std::unique_ptr<ComputePipeline> ComputeDeviceCPU::create_pipeline() {
+    return std::unique_ptr<ComputePipeline>{ new ComputeCPU() };
+}
+
+std::unique_ptr<ComputeDevice> create_cpu_compute_device(const char *device_override) {
+    return std::unique_ptr<ComputeDevice>{ new ComputeDeviceCPU() };
+}
@@ -0,0 +1,98 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "device_backend.h"
+#include <memory>
+#include <vector>
+
+/* Host implementation of the compute abstraction. Buffers live in host memory,
+ * command streams execute immediately, and shaders are C++ kernels registered
+ * by name. A dispatch runs one kernel call per workgroup, the workgroups are
+ * distributed over the parallel_for thread pool. Kernels loop over the
+ * invocations of their workgroup themselves, rows of x invocations are
+ * contiguous so that the inner loop can be vectorized by the compiler.
+ */
+
+struct CpuComputeWorkgroup {
+    glm::uvec2 group_id;
+    glm::uvec2 group_size;
+    glm::uvec2 dispatch_dim; // total invocations, as passed to ComputePipeline::run
+
+    // invocation range of this workgroup, clamped to the dispatch dimensions
+    glm::uvec2 begin;
+    glm::uvec2 end;
+
+    // host memory bound at the given set and binding, nullptr if unbound.
+    // Set 0 holds the buffers of the pipeline, set i + 1 those of the pipeline
+    // inherited at bindpoint i.
+    void* buffer(int set, int binding) const;
+    template <class T>
+    T* buffer(int set, int binding) const { return static_cast<T*>(buffer(set, binding)); }
+
+    std::vector<std::vector<void*>> const* bound_sets;
+};
+
+typedef void (*cpu_compute_kernel_function)(CpuComputeWorkgroup const& workgroup);
+
+// makes a kernel available to ComputePipeline::add_shader, replaces kernels of the same name
+void register_cpu_compute_kernel(char const* name, glm::uvec2 group_size, cpu_compute_kernel_function kernel);
+
+// registers a kernel during static initialization of the translation unit that defines it
+struct CpuComputeKernelRegistration {
+    CpuComputeKernelRegistration(char const* name, glm::uvec2 group_size, cpu_compute_kernel_function kernel) {
+        register_cpu_compute_kernel(name, group_size, kernel);
+    }
+};
+
+struct ComputeBufferCPU : GpuBuffer {
+    std::unique_ptr<unsigned char[]> data;
+    size_t data_size = 0;
+    ComputeBufferCPU(size_t size);
+
+    void* map() override;
+    void unmap() override;
+    size_t size() const override;
+};
+
+struct ComputeCPU : ComputePipeline {
+    std::vector<GpuBuffer*> buffers; // by bindpoint
+    std::vector<ComputeCPU*> bindings_other; // by bindpoint
+
+    struct Shader {
+        cpu_compute_kernel_function kernel;
+        glm::uvec2 group_size;
+    };
+    std::vector<Shader> shaders;
+
+    // resolved on finalize_build, per set and binding
+    std::vector<std::vector<void*>> bound_sets;
+
+    std::string name() override;
+
+    int add_buffer(int bindpoint, GpuBuffer* buffer, bool uniform_buffer = false) override;
+    int add_shader(char const* name) override;
+
+    // inherit descriptor sets from another pipeline
+    int add_pipeline(int bindpoint, ComputePipeline* pipeline) override;
+
+    void finalize_build() override;
+    void run(CommandStream* stream, int shader_index, glm::uvec2 dispatch_dim) override;
+};
+
+struct CommandStreamCPU : CommandStream {
+    void begin_record() override { }
+    void end_submit(bool only_manual_wait = false) override { }
+    void end_submit(const SubmitParameters* submit_params) override { }
+    void wait_complete(int cursor = -1) override { }
+};
+
+struct ComputeDeviceCPU : ComputeDevice {
+    CommandStreamCPU stream;
+
+    CommandStream* sync_command_stream() override;
+    std::unique_ptr<GpuBuffer> create_uniform_buffer(size_t size) override;
+    std::unique_ptr<GpuBuffer> create_buffer(size_t size) override;
+    std::unique_ptr<ComputePipeline> create_pipeline() override;
+};
@@ -223,3 +223,75 @@ inline FP16 float_to_half(FP32 f)
     o.Sign = f.Sign;
     return o;
 }
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+
+// SSE2 implementation of float_to_half_fast3_rtne, same results as float_to_half.
+// Returns the halfs in the low 16 bits of each lane, the upper bits replicate the sign.
+inline __m128i float_to_half_rtne_SSE2(__m128 f)
+{
+    __m128i mask_sign       = _mm_set1_epi32(0x80000000u);
+    __m128i c_f16max        = _mm_set1_epi32((127 + 16) << 23); // all FP32 values >=this round to +inf
+    __m128i c_nanbit        = _mm_set1_epi32(0x200);
+    __m128i c_infty_as_fp16 = _mm_set1_epi32(0x7c00);
+    __m128i c_min_normal    = _mm_set1_epi32((127 - 14) << 23); // smallest FP32 that yields a normalized FP16
+    __m128i c_subnorm_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    __m128i c_normal_bias   = _mm_set1_epi32(0xfff - ((127 - 15) << 23)); // adjust exponent and add mantissa rounding
+
+    __m128  msign       = _mm_castsi128_ps(mask_sign);
+    __m128  justsign    = _mm_and_ps(msign, f);
+    __m128  absf        = _mm_xor_ps(f, justsign);
+    __m128i absf_int    = _mm_castps_si128(absf);
+    __m128  b_isnan     = _mm_cmpunord_ps(absf, absf); // is this a NaN?
+    __m128i b_isregular = _mm_cmpgt_epi32(c_f16max, absf_int); // (sub)normalized or special?
+    __m128i nanbit      = _mm_and_si128(_mm_castps_si128(b_isnan), c_nanbit);
+    __m128i inf_or_nan  = _mm_or_si128(nanbit, c_infty_as_fp16); // output for specials
+
+    __m128i b_issub     = _mm_cmpgt_epi32(c_min_normal, absf_int);
+
+    // "result is subnormal" path
+    __m128  subnorm1    = _mm_add_ps(absf, _mm_castsi128_ps(c_subnorm_magic)); // magic value to round output mantissa
+    __m128i subnorm2    = _mm_sub_epi32(_mm_castps_si128(subnorm1), c_subnorm_magic); // subtract out bias
+
+    // "result is normal" path
+    __m128i mantoddbit  = _mm_slli_epi32(absf_int, 31 - 13); // shift bit 13 (mantissa LSB) to sign
+    __m128i mantodd     = _mm_srai_epi32(mantoddbit, 31); // -1 if FP16 mantissa odd, else 0
+
+    __m128i round1      = _mm_add_epi32(absf_int, c_normal_bias);
+    __m128i round2      = _mm_sub_epi32(round1, mantodd); // if mantissa LSB odd, bias towards rounding up (RTNE)
+    __m128i normal      = _mm_srli_epi32(round2, 13); // rounded result
+
+    // combine the two non-specials
+    __m128i nonspecial  = _mm_or_si128(_mm_and_si128(subnorm2, b_issub), _mm_andnot_si128(b_issub, normal));
+
+    // merge in specials as well
+    __m128i joined      = _mm_or_si128(_mm_and_si128(nonspecial, b_isregular), _mm_andnot_si128(b_isregular, inf_or_nan));
+
+    __m128i sign_shift  = _mm_srai_epi32(_mm_castps_si128(justsign), 16);
+    __m128i result      = _mm_or_si128(joined, sign_shift);
+
+    return result;
+}
+#define FLOAT_TO_HALF_SSE2
+#endif
+
+// Converts count floats to halfs with round-to-nearest-even, 8 at a time with SSE2.
+// Bit-exact with float_to_half, independent of the flush-to-zero mode.
+inline void float_to_half_array(unsigned short* dst, const float* src, size_t count)
+{
+    size_t i = 0;
+#ifdef FLOAT_TO_HALF_SSE2
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = float_to_half_rtne_SSE2(_mm_loadu_ps(src + i));
+        __m128i hi = float_to_half_rtne_SSE2(_mm_loadu_ps(src + i + 4));
+        // sign-replicated lanes are within the int16 range, the saturation never clamps
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+    for (; i < count; ++i) {
+        FP32 f;
+        f.f = src[i];
+        dst[i] = float_to_half(f).u;
+    }
+}
@@ -0,0 +1,144 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Converts raw capture files of data capture mode, see frame_capture.h, into
+// image sequences <prefix>_<frame>_<stream>.exr, or .png for 8 bit streams.
+// Frames are numbered in capture order across all given files. The images are
+// read in place from the file mappings and encoded on all threads.
+
+#include "frame_capture.h"
+#include "parallel.h"
+#include "write_image.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+void print_usage(char const* exe) {
+    printf("Usage: %s [options] <capture.rptrcap>...\n"
+           "  --output <prefix>          prefix of the image files (default: name of the first capture file)\n"
+           "  --compression <mode>       EXR compression, zip, piz, rle or none (default none)\n"
+           "  --threads <n>              number of worker threads (default all)\n", exe);
+}
+
+bool parse_compression(char const* arg, ExrCompression& compression) {
+    static char const* const names[] = { "zip", "piz", "rle", "none" };
+    for (int i = 0; i < 4; ++i) {
+        if (!strcmp(arg, names[i])) {
+            compression = ExrCompression(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string default_prefix(std::string path) {
+    size_t ext = path.rfind(".rptrcap");
+    if (ext != std::string::npos && ext + 8 == path.size())
+        path.resize(ext);
+    return path;
+}
+
+struct ConvertJob {
+    FrameCaptureReader const* capture;
+    uint64_t frame;
+    int stream;
+    uint64_t sequence_number;
+};
+
+bool convert(ConvertJob const& job, std::string const& prefix, ExrCompression compression) {
+    FrameCaptureStream const& stream = job.capture->header().streams[job.stream];
+    FrameCaptureIndexEntry const& entry = job.capture->frame(job.frame);
+    unsigned width = entry.extents[job.stream][0];
+    unsigned height = entry.extents[job.stream][1];
+    if (width == 0 || height == 0 || width > stream.width || height > stream.height) {
+        printf("Invalid extent of stream %s in frame %llu\n", stream.name, (unsigned long long) job.frame);
+        return false;
+    }
+
+    char sequence[32];
+    snprintf(sequence, sizeof(sequence), "_%04llu_", (unsigned long long) job.sequence_number);
+    std::string filename = prefix + sequence + stream.name;
+    uint8_t const* pixels = job.capture->stream_data(job.frame, job.stream);
+    switch (stream.pixel_format) {
+    case FRAME_CAPTURE_RGBA8:
+        return WriteImage::write_png(filename.c_str(), width, height, 4, pixels);
+    case FRAME_CAPTURE_RGBA16F:
+        return WriteImage::write_exr(filename.c_str(), width, height, 4,
+            reinterpret_cast<uint16_t const*>(pixels), compression);
+    case FRAME_CAPTURE_RGBA32F:
+        return WriteImage::write_exr(filename.c_str(), width, height, 4,
+            reinterpret_cast<float const*>(pixels), compression);
+    }
+    printf("Unknown pixel format of stream %s\n", stream.name);
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char const* const* argv) {
+    std::string prefix;
+    ExrCompression compression = EXR_COMPRESSION_NONE;
+    std::vector<char const*> files;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--output") && i + 1 < argc)
+            prefix = argv[++i];
+        else if (!strcmp(argv[i], "--compression") && i + 1 < argc) {
+            if (!parse_compression(argv[++i], compression)) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            set_parallel_thread_count(atoi(argv[++i]));
+        else if (argv[i][0] == '-') {
+            print_usage(argv[0]);
+            return 1;
+        }
+        else
+            files.push_back(argv[i]);
+    }
+    if (files.empty()) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (prefix.empty())
+        prefix = default_prefix(files[0]);
+
+    std::vector<std::unique_ptr<FrameCaptureReader>> captures;
+    std::vector<ConvertJob> jobs;
+    uint64_t sequence_number = 0;
+    for (char const* file : files) {
+        try {
+            captures.emplace_back(new FrameCaptureReader(file));
+        } catch (std::exception const& e) {
+            printf("Failed to open %s: %s\n", file, e.what());
+            return 1;
+        }
+        FrameCaptureReader const& capture = *captures.back();
+        for (uint64_t frame = 0; frame < capture.frame_count(); ++frame, ++sequence_number) {
+            for (int stream = 0; stream < int(capture.header().num_streams); ++stream) {
+                if (capture.frame(frame).stream_mask & (1u << stream))
+                    jobs.push_back({ &capture, frame, stream, sequence_number });
+            }
+        }
+        printf("%s: %llu frames\n", file, (unsigned long long) capture.frame_count());
+    }
+
+    // one image per task, each encoder works through its own image
+    std::atomic<int> num_failed{0};
+    parallel_for(0, index_t(jobs.size()), 1, [&](index_t i, int) {
+        if (!convert(jobs[i], prefix, compression))
+            ++num_failed;
+    });
+
+    printf("Wrote %d images to %s_*\n", int(jobs.size()) - num_failed.load(), prefix.c_str());
+    return num_failed ? 1 : 0;
+}
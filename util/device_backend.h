@@ -5,6 +5,7 @@
 
 #include "ref_counted.h"
 #include <glm/glm.hpp>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -53,6 +54,8 @@ struct ComputeDevice {
 
 typedef std::unique_ptr<ComputeDevice> (*create_compute_device_function)(const char *device_override);
 
+// host memory and C++ kernels, see compute_cpu.h
+std::unique_ptr<ComputeDevice> create_cpu_compute_device(const char *device_override = nullptr);
 #ifdef ENABLE_VULKAN
 std::unique_ptr<ComputeDevice> create_vulkan_compute_device(const char *device_override = nullptr);
 #endif
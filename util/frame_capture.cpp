@@ -0,0 +1,208 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "frame_capture.h"
+#include "error_io.h"
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+static const uint64_t FRAME_CAPTURE_ALIGNMENT = 4096;
+
+static uint64_t align_capture_offset(uint64_t offset) {
+    return (offset + FRAME_CAPTURE_ALIGNMENT - 1) / FRAME_CAPTURE_ALIGNMENT * FRAME_CAPTURE_ALIGNMENT;
+}
+
+FrameCaptureWriter::~FrameCaptureWriter() {
+    close();
+}
+
+bool FrameCaptureWriter::open(std::string const& path, std::vector<FrameCaptureStream> const& streams,
+    uint64_t frame_capacity) {
+    close();
+    if (streams.empty() || streams.size() > FRAME_CAPTURE_MAX_STREAMS || frame_capacity == 0) {
+        println(CLL::CRITICAL, "Invalid stream configuration for capture file %s", path.c_str());
+        return false;
+    }
+
+    FrameCaptureHeader header = { };
+    memcpy(header.magic, FRAME_CAPTURE_MAGIC, sizeof(FRAME_CAPTURE_MAGIC));
+    header.version = FRAME_CAPTURE_VERSION;
+    header.num_streams = uint32_t(streams.size());
+    header.frame_capacity = frame_capacity;
+    header.index_offset = align_capture_offset(sizeof(FrameCaptureHeader));
+    header.data_offset = align_capture_offset(header.index_offset + frame_capacity * sizeof(FrameCaptureIndexEntry));
+    for (size_t i = 0; i < streams.size(); ++i) {
+        FrameCaptureStream& stream = header.streams[i];
+        stream = streams[i];
+        stream.name[sizeof(stream.name) - 1] = 0;
+        stream.reserved = 0;
+        // page aligned streams, readbacks start on fresh pages
+        stream.offset = header.frame_stride;
+        stream.size = align_capture_offset(uint64_t(stream.width) * stream.height * frame_capture_pixel_size(stream.pixel_format));
+        header.frame_stride += stream.size;
+    }
+    num_bytes = size_t(header.data_offset + frame_capacity * header.frame_stride);
+    this->path = path;
+
+#ifdef _WIN32
+    file_handle = (void*) CreateFile(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+        CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if ((HANDLE) file_handle == INVALID_HANDLE_VALUE) {
+        file_handle = nullptr;
+        println(CLL::CRITICAL, "Failed to create capture file %s", path.c_str());
+        return false;
+    }
+    LARGE_INTEGER size;
+    size.QuadPart = LONGLONG(num_bytes);
+    mapping_handle = (void*) CreateFileMapping((HANDLE) file_handle, nullptr, PAGE_READWRITE,
+        DWORD(size.HighPart), DWORD(size.LowPart), nullptr);
+    if (mapping_handle)
+        mapping = MapViewOfFile((HANDLE) mapping_handle, FILE_MAP_WRITE, 0, 0, 0);
+#else
+    file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file == -1) {
+        println(CLL::CRITICAL, "Failed to create capture file %s", path.c_str());
+        return false;
+    }
+    // reserve the blocks up front, the capture does not fragment or run out of space midway
+    bool allocated = posix_fallocate(file, 0, off_t(num_bytes)) == 0;
+    if (!allocated)
+        allocated = ftruncate(file, off_t(num_bytes)) == 0;
+    if (allocated) {
+        mapping = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if (mapping == MAP_FAILED)
+            mapping = nullptr;
+        else
+            madvise(mapping, num_bytes, MADV_SEQUENTIAL);
+    }
+#endif
+    if (!mapping) {
+        println(CLL::CRITICAL, "Failed to map capture file %s of %llu bytes", path.c_str(), (unsigned long long) num_bytes);
+        unmap();
+        return false;
+    }
+
+    memcpy(mapping, &header, sizeof(header));
+    pending = { };
+    return true;
+}
+
+uint8_t* FrameCaptureWriter::stream_data(int stream) {
+    FrameCaptureHeader const* h = header();
+    return static_cast<uint8_t*>(mapping) + h->data_offset + h->frame_count * h->frame_stride
+        + h->streams[stream].offset;
+}
+
+void FrameCaptureWriter::set_stream_extent(int stream, uint32_t width, uint32_t height) {
+    pending.stream_mask |= 1u << stream;
+    pending.extents[stream][0] = width;
+    pending.extents[stream][1] = height;
+}
+
+void FrameCaptureWriter::commit_frame(uint64_t frame_number, double time) {
+    FrameCaptureHeader* h = static_cast<FrameCaptureHeader*>(mapping);
+    pending.frame_number = frame_number;
+    pending.time = time;
+    FrameCaptureIndexEntry* index = reinterpret_cast<FrameCaptureIndexEntry*>(
+        static_cast<uint8_t*>(mapping) + h->index_offset);
+    index[h->frame_count] = pending;
+    pending = { };
+
+    // start writing back the finished slot, the page cache does not fill up with dirty frames
+    uint8_t* slot = static_cast<uint8_t*>(mapping) + h->data_offset + h->frame_count * h->frame_stride;
+#ifdef _WIN32
+    FlushViewOfFile(slot, size_t(h->frame_stride));
+#else
+    msync(slot, size_t(h->frame_stride), MS_ASYNC);
+#endif
+    ++h->frame_count;
+}
+
+void FrameCaptureWriter::close() {
+    if (!mapping) {
+        unmap();
+        return;
+    }
+    FrameCaptureHeader const* h = header();
+    const uint64_t used_bytes = h->data_offset + h->frame_count * h->frame_stride;
+    unmap();
+
+    // drop the preallocated slots that were never written
+#ifdef _WIN32
+    HANDLE f = CreateFile(path.c_str(), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (f != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER size;
+        size.QuadPart = LONGLONG(used_bytes);
+        SetFilePointerEx(f, size, nullptr, FILE_BEGIN);
+        SetEndOfFile(f);
+        CloseHandle(f);
+    }
+#else
+    if (truncate(path.c_str(), off_t(used_bytes)) != 0)
+        warning("Failed to truncate capture file %s", path.c_str());
+#endif
+}
+
+void FrameCaptureWriter::unmap() {
+#ifdef _WIN32
+    if (mapping)
+        UnmapViewOfFile(mapping);
+    if (mapping_handle)
+        CloseHandle((HANDLE) mapping_handle);
+    if (file_handle)
+        CloseHandle((HANDLE) file_handle);
+    mapping_handle = nullptr;
+    file_handle = nullptr;
+#else
+    if (mapping)
+        munmap(mapping, num_bytes);
+    if (file != -1)
+        ::close(file);
+    file = -1;
+#endif
+    mapping = nullptr;
+    num_bytes = 0;
+}
+
+FrameCaptureReader::FrameCaptureReader(std::string const& path)
+    : mapping(path) {
+    if (mapping.nbytes() < sizeof(FrameCaptureHeader)
+     || memcmp(header().magic, FRAME_CAPTURE_MAGIC, sizeof(FRAME_CAPTURE_MAGIC)) != 0)
+        throw std::runtime_error(path + " is not a capture file");
+    FrameCaptureHeader const& h = header();
+    if (h.version != FRAME_CAPTURE_VERSION || h.num_streams > FRAME_CAPTURE_MAX_STREAMS)
+        throw std::runtime_error("Unsupported capture file version or streams in " + path);
+    if (h.frame_count > h.frame_capacity
+     || h.index_offset + h.frame_capacity * sizeof(FrameCaptureIndexEntry) > h.data_offset
+     || h.data_offset + h.frame_count * h.frame_stride > mapping.nbytes())
+        throw std::runtime_error("Truncated capture file " + path);
+    for (uint32_t i = 0; i < h.num_streams; ++i) {
+        FrameCaptureStream const& stream = h.streams[i];
+        if (stream.offset + stream.size > h.frame_stride
+         || uint64_t(stream.width) * stream.height * frame_capture_pixel_size(stream.pixel_format) > stream.size)
+            throw std::runtime_error("Invalid stream layout in capture file " + path);
+    }
+}
+
+FrameCaptureHeader const& FrameCaptureReader::header() const {
+    return *reinterpret_cast<FrameCaptureHeader const*>(mapping.data());
+}
+
+FrameCaptureIndexEntry const& FrameCaptureReader::frame(uint64_t i) const {
+    return reinterpret_cast<FrameCaptureIndexEntry const*>(mapping.data() + header().index_offset)[i];
+}
+
+uint8_t const* FrameCaptureReader::stream_data(uint64_t frame, int stream) const {
+    FrameCaptureHeader const& h = header();
+    return mapping.data() + h.data_offset + frame * h.frame_stride + h.streams[stream].offset;
+}
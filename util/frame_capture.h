@@ -0,0 +1,115 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "file_mapping.h"
+
+/* Raw frame sequence container for high frame rate data capture. A capture
+ * file is preallocated for a fixed number of frames and memory-mapped, and
+ * readbacks are copied into the frame slots as they are, without encoding.
+ * Layout, all offsets page aligned:
+ *   FrameCaptureHeader
+ *   frame index, one FrameCaptureIndexEntry per frame slot
+ *   frame slots of frame_stride bytes, each holding all streams of a frame
+ *   at the offsets of the stream descriptions
+ * frame_count in the header is updated after each frame is complete, so files
+ * of interrupted captures stay readable. The convert_capture tool turns
+ * capture files into image sequences.
+ */
+
+#define FRAME_CAPTURE_MAGIC "RPTRCAP"
+#define FRAME_CAPTURE_VERSION 1
+#define FRAME_CAPTURE_MAX_STREAMS 8
+
+enum FrameCapturePixelFormat : uint32_t {
+    FRAME_CAPTURE_RGBA8,
+    FRAME_CAPTURE_RGBA16F,
+    FRAME_CAPTURE_RGBA32F,
+};
+
+inline size_t frame_capture_pixel_size(uint32_t format) {
+    return format == FRAME_CAPTURE_RGBA32F ? 16 : format == FRAME_CAPTURE_RGBA16F ? 8 : 4;
+}
+
+struct FrameCaptureStream {
+    char name[32];
+    uint32_t width, height; // maximum extent
+    uint32_t pixel_format;
+    uint32_t reserved;
+    uint64_t offset; // in the frame slot
+    uint64_t size; // bytes reserved per frame
+};
+
+struct FrameCaptureHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_streams;
+    uint64_t frame_capacity;
+    uint64_t frame_count;
+    uint64_t index_offset;
+    uint64_t data_offset;
+    uint64_t frame_stride;
+    FrameCaptureStream streams[FRAME_CAPTURE_MAX_STREAMS];
+};
+
+struct FrameCaptureIndexEntry {
+    uint64_t frame_number; // label chosen by the capturing application
+    double time;
+    uint32_t stream_mask; // streams written in this frame
+    uint32_t reserved;
+    uint32_t extents[FRAME_CAPTURE_MAX_STREAMS][2]; // width, height of the written pixels
+};
+
+struct FrameCaptureWriter {
+    FrameCaptureWriter() = default;
+    ~FrameCaptureWriter();
+
+    FrameCaptureWriter(FrameCaptureWriter const&) = delete;
+    FrameCaptureWriter& operator=(FrameCaptureWriter const&) = delete;
+
+    // Creates and preallocates the file, only name, extent and pixel_format of the streams are used.
+    bool open(std::string const& path, std::vector<FrameCaptureStream> const& streams, uint64_t frame_capacity);
+    // Truncates the file to the written frames.
+    void close();
+
+    bool is_open() const { return mapping != nullptr; }
+    bool full() const { return header()->frame_count >= header()->frame_capacity; }
+    FrameCaptureHeader const* header() const { return static_cast<FrameCaptureHeader const*>(mapping); }
+
+    // Memory of the stream in the slot of the next frame, valid until commit_frame().
+    uint8_t* stream_data(int stream);
+    void set_stream_extent(int stream, uint32_t width, uint32_t height);
+    // Appends the next frame to the index, with the streams that have an extent.
+    void commit_frame(uint64_t frame_number, double time);
+
+private:
+    void unmap();
+
+    std::string path;
+    void* mapping = nullptr;
+    size_t num_bytes = 0;
+    FrameCaptureIndexEntry pending = { };
+#ifdef _WIN32
+    void* file_handle = nullptr;
+    void* mapping_handle = nullptr;
+#else
+    int file = -1;
+#endif
+};
+
+// Read access to a capture file, throws std::runtime_error for invalid files.
+struct FrameCaptureReader {
+    explicit FrameCaptureReader(std::string const& path);
+
+    FrameCaptureHeader const& header() const;
+    uint64_t frame_count() const { return header().frame_count; }
+    FrameCaptureIndexEntry const& frame(uint64_t i) const;
+    uint8_t const* stream_data(uint64_t frame, int stream) const;
+
+private:
+    FileMapping mapping;
+};
@@ -4,6 +4,8 @@
 #include "image.h"
 #include "stb_image.h"
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 #include <xmmintrin.h>
 
@@ -77,3 +79,144 @@ Image Image::fromFile(const std::string &file, const std::string &name, ColorSpa
 }
 //#endif
 
+
+namespace {
+
+// BC1 color block, 4-color mode is forced for the color part of BC2/BC3 blocks
+void decode_bc1_block(uint8_t const* block, uint8_t out[16][4], bool punchthrough_alpha, bool four_color_mode) {
+    uint16_t c[2] = { uint16_t(block[0] | block[1] << 8), uint16_t(block[2] | block[3] << 8) };
+    uint8_t palette[4][4];
+    for (int i = 0; i < 2; ++i) {
+        palette[i][0] = uint8_t((c[i] >> 11 & 0x1f) * 255 / 31);
+        palette[i][1] = uint8_t((c[i] >> 5 & 0x3f) * 255 / 63);
+        palette[i][2] = uint8_t((c[i] & 0x1f) * 255 / 31);
+        palette[i][3] = 255;
+    }
+    if (four_color_mode || c[0] > c[1]) {
+        for (int k = 0; k < 3; ++k) {
+            palette[2][k] = uint8_t((2 * palette[0][k] + palette[1][k]) / 3);
+            palette[3][k] = uint8_t((palette[0][k] + 2 * palette[1][k]) / 3);
+        }
+        palette[2][3] = palette[3][3] = 255;
+    } else {
+        for (int k = 0; k < 3; ++k) {
+            palette[2][k] = uint8_t((palette[0][k] + palette[1][k]) / 2);
+            palette[3][k] = 0;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = punchthrough_alpha ? 0 : 255;
+    }
+    uint32_t indices = uint32_t(block[4]) | uint32_t(block[5]) << 8 | uint32_t(block[6]) << 16 | uint32_t(block[7]) << 24;
+    for (int t = 0; t < 16; ++t)
+        memcpy(out[t], palette[indices >> (2 * t) & 0x3], 4);
+}
+
+// BC4 single-channel block, signed blocks are remapped to the unsigned range
+void decode_bc4_block(uint8_t const* block, uint8_t out[16][4], int channel, bool is_signed) {
+    int a0 = is_signed ? std::max(int(int8_t(block[0])), -127) : int(block[0]);
+    int a1 = is_signed ? std::max(int(int8_t(block[1])), -127) : int(block[1]);
+    int palette[8] = { a0, a1 };
+    if (a0 > a1) {
+        for (int i = 2; i < 8; ++i)
+            palette[i] = ((8 - i) * a0 + (i - 1) * a1) / 7;
+    } else {
+        for (int i = 2; i < 6; ++i)
+            palette[i] = ((6 - i) * a0 + (i - 1) * a1) / 5;
+        palette[6] = is_signed ? -127 : 0;
+        palette[7] = is_signed ? 127 : 255;
+    }
+    uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i)
+        indices |= uint64_t(block[2 + i]) << (8 * i);
+    for (int t = 0; t < 16; ++t) {
+        int v = palette[indices >> (3 * t) & 0x7];
+        out[t][channel] = uint8_t(is_signed ? (v + 127) * 255 / 254 : v);
+    }
+}
+
+void decode_bc_block(int bcFormat, uint8_t const* block, uint8_t out[16][4]) {
+    switch (bcFormat) {
+    case 1:
+    case -1:
+        decode_bc1_block(block, out, bcFormat < 0, false);
+        break;
+    case 2:
+        decode_bc1_block(block + 8, out, false, true);
+        for (int t = 0; t < 16; ++t)
+            out[t][3] = uint8_t((block[t / 2] >> (4 * (t & 1)) & 0xf) * 17);
+        break;
+    case 3:
+        decode_bc1_block(block + 8, out, false, true);
+        decode_bc4_block(block, out, 3, false);
+        break;
+    case 4:
+    case -4:
+        for (int t = 0; t < 16; ++t) {
+            out[t][1] = out[t][2] = 0;
+            out[t][3] = 255;
+        }
+        decode_bc4_block(block, out, 0, bcFormat < 0);
+        break;
+    case 5:
+    case -5:
+        for (int t = 0; t < 16; ++t) {
+            out[t][2] = 0;
+            out[t][3] = 255;
+        }
+        decode_bc4_block(block, out, 0, bcFormat < 0);
+        decode_bc4_block(block + 8, out, 1, bcFormat < 0);
+        break;
+    }
+}
+
+} // namespace
+
+mapped_vector<uint8_t> Image::decompressBytes(Buffer<uint8_t>& scratch) const {
+    if (!bcFormat)
+        return img;
+
+    int levels = mip_levels();
+    size_t num_texels = 0;
+    for (int level = 0, w = width, h = height; level < levels; ++level) {
+        num_texels += size_t(w) * h;
+        if (w > 1) w /= 2;
+        if (h > 1) h /= 2;
+    }
+    std::vector<uint8_t>& texels = scratch.to_vector();
+    texels.resize(num_texels * 4);
+
+    size_t block_bytes = size_t(bits_per_pixel()) * 16 / 8;
+    uint8_t const* blocks = img.data();
+    uint8_t* level_texels = texels.data();
+    for (int level = 0, w = width, h = height; level < levels; ++level) {
+        int blocks_x = (w + 3) / 4;
+        int blocks_y = (h + 3) / 4;
+        for (int by = 0; by < blocks_y; ++by) {
+            for (int bx = 0; bx < blocks_x; ++bx) {
+                uint8_t decoded[16][4];
+                decode_bc_block(bcFormat, blocks, decoded);
+                blocks += block_bytes;
+                // partial blocks at the borders of small mip levels
+                for (int y = 0; y < 4 && by * 4 + y < h; ++y)
+                    for (int x = 0; x < 4 && bx * 4 + x < w; ++x)
+                        memcpy(level_texels + (size_t(by * 4 + y) * w + bx * 4 + x) * 4, decoded[y * 4 + x], 4);
+            }
+        }
+        level_texels += size_t(w) * h * 4;
+        if (w > 1) w /= 2;
+        if (h > 1) h /= 2;
+    }
+    return mapped_vector<uint8_t>(scratch);
+}
+
+mapped_vector<uint8_t> Image::decompressBytes() const {
+    Buffer<uint8_t> scratch(nullptr);
+    return decompressBytes(scratch);
+}
+
+Image Image::decompress() const {
+    Image result = *this;
+    result.img = decompressBytes();
+    result.bcFormat = 0;
+    return result;
+}
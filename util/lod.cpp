@@ -3,19 +3,14 @@
 
 #include "lod.h"
 #include "error_io.h"
+#include "parallel.h"
 
 void LoDUtils::compute_bounds(Sphere &bounding_sphere, const Mesh &mesh) {
-    // unpack positions for all geometries and contruct a bounding sphere
-    size_t num_total_verts = 0;
-    for (const auto &geom : mesh.geometries)
-        num_total_verts += geom.num_verts();
-    std::vector<glm::vec3> unpacked_positions(num_total_verts);
-    size_t offset = 0;
-    for (const auto &geom : mesh.geometries) {
-        geom.get_vertex_positions(&unpacked_positions[offset]);
-        offset += geom.num_verts();
-    }
-    bounding_sphere = Sphere::boundPoints(unpacked_positions.data(), (int)num_total_verts);
+    // prefer the bounds cached on scene load, otherwise stream over the vertices without unpacking
+    if (mesh.has_current_bounds())
+        bounding_sphere = mesh.bounds.sphere;
+    else
+        bounding_sphere = mesh.compute_bounds().sphere;
 }
 
 // helper function to access LoD mesh by lod group index
@@ -64,7 +59,7 @@ void LoDUtils::compute_lod_distances(float* lod_distances,
 
 LoDSystem::LoDSystem(){}
 
-void LoDSystem::initialize(const Scene &scene) {
+void LoDSystem::initialize(const Scene &scene, double time) {
     // make sure we recompute lod distances, so "invalidate" the remembered fov_y
     _cam_fov_y = -1.0f;
     
@@ -77,21 +72,45 @@ void LoDSystem::initialize(const Scene &scene) {
     for (size_t iGroup = 1; iGroup < num_lod_groups; iGroup++) {
         const auto &lod_group = scene.lod_groups[iGroup];
         auto &lod_info = _lod_group_infos[iGroup];
-        LoDUtils::compute_bounds(lod_info.bounds, scene, lod_group);
-        
         lod_info.lod_distance_offset = num_lod_distances;
         num_lod_distances += lod_group.detail_reduction.size();
 
         lod_info.detail_reductions = lod_group.detail_reduction;
+        lod_info.parameterized_mesh_ids = lod_group.mesh_ids;
+        lod_info.hysteresis = _settings.lod_hysteresis;
+        lod_info.triangle_counts.resize(lod_group.mesh_ids.size());
+        for (size_t iLod = 0; iLod < lod_group.mesh_ids.size(); iLod++)
+            lod_info.triangle_counts[iLod] = scene.meshes[get_mesh_id_from_lod_group(scene, lod_group, int(iLod))].num_tris();
     }
+    // group bounds are independent, mesh bounds not cached by the scene are computed on the fly
+    parallel_for(1, index_t(num_lod_groups), 64, [&](index_t iGroup, int) {
+        auto &lod_info = _lod_group_infos[iGroup];
+        LoDUtils::compute_bounds(lod_info.bounds, scene, scene.lod_groups[iGroup]);
+        lod_info.local_bounds = lod_info.bounds;
+    });
+
+    // instances reference the leading parameterized mesh of a LoD group, bound them by the whole group
+    const size_t num_pmeshes = scene.parameterized_meshes.size();
+    _pmesh_bounds.resize(num_pmeshes);
+    _pmesh_lod_groups.resize(num_pmeshes);
+    parallel_for(0, index_t(num_pmeshes), 256, [&](index_t iPMesh, int) {
+        const auto &pmesh = scene.parameterized_meshes[iPMesh];
+        const auto &lod_group = scene.lod_groups[pmesh.lod_group];
+        if (pmesh.lod_group > 0 && lod_group.mesh_ids[0] == int(iPMesh)) {
+            _pmesh_lod_groups[iPMesh] = pmesh.lod_group;
+            _pmesh_bounds[iPMesh] = _lod_group_infos[pmesh.lod_group].local_bounds;
+        } else {
+            _pmesh_lod_groups[iPMesh] = 0;
+            LoDUtils::compute_bounds(_pmesh_bounds[iPMesh], scene.meshes[pmesh.mesh_id]);
+        }
+    });
 
     std::vector<float> lod_group_inst_counts(num_lod_groups, 0.0f);
     std::vector<float> lod_group_avg_scales(num_lod_groups, 0.0f);
 
     for (auto inst : scene.instances) {
         const auto &animData = scene.animation_data.at(inst.animation_data_index);
-        constexpr uint32_t frame = 0;
-        auto transform = animData.dequantize(inst.transform_index, frame);
+        auto transform = animData.dequantize(inst.transform_index, animData.frame_at(time));
 
         int lod_group_idx = scene.parameterized_meshes[inst.parameterized_mesh_id].lod_group;
         if (lod_group_idx > 0) {
@@ -140,6 +159,10 @@ const LoDSystem::Settings &LoDSystem::get_settings() const
 }
 
 void LoDSystem::update_settings(LoDSystem::Settings &settings) {
+    if (settings.lod_hysteresis != _settings.lod_hysteresis) {
+        for (auto &lod_info : _lod_group_infos)
+            lod_info.hysteresis = settings.lod_hysteresis;
+    }
     _settings = settings;
     apply_global_settings();
 }
@@ -152,6 +175,173 @@ const float *LoDSystem::get_lod_distances_for_group(uint32_t lod_group_idx) cons
     return &_final_lod_distances[_lod_group_infos[lod_group_idx].lod_distance_offset];
 }
 
+namespace {
+    // conservative bounding sphere radius scale of an affine transform
+    inline float max_axis_scale(const glm::mat4 &transform) {
+        const float sx = glm::dot(glm::vec3(transform[0]), glm::vec3(transform[0]));
+        const float sy = glm::dot(glm::vec3(transform[1]), glm::vec3(transform[1]));
+        const float sz = glm::dot(glm::vec3(transform[2]), glm::vec3(transform[2]));
+        return std::sqrt(std::max(sx, std::max(sy, sz)));
+    }
+}
+
+void LoDSystem::select_instances(LoDSelection &selection, const LoDCullingView &view, const LoDInstanceView &instances) const {
+    // frustum planes from the rows of the view projection matrix (Gribb/Hartmann), inward facing.
+    // the near plane assumes a [-1, 1] depth range, which is conservative for [0, 1] projections
+    const glm::mat4 vp = glm::transpose(view.view_projection);
+    glm::vec4 planes[6] = {
+        vp[3] + vp[0], vp[3] - vp[0],
+        vp[3] + vp[1], vp[3] - vp[1],
+        vp[3] + vp[2], vp[3] - vp[2]
+    };
+    for (auto &plane : planes) {
+        const float length = glm::length(glm::vec3(plane));
+        // planes at infinity, e.g. the far plane of an infinite projection, never cull
+        plane = length > 0.0f ? plane / length : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+
+    const float max_distance = view.max_distance > 0.0f ? view.max_distance : FLT_MAX;
+    const bool has_lod_distances = !_final_lod_distances.empty();
+
+    constexpr index_t chunk_size = 4096;
+    const index_t num_instances = index_t(instances.count);
+    const index_t num_chunks = (num_instances + chunk_size - 1) / chunk_size;
+    selection.instance_lods.resize(instances.count);
+    selection.chunk_offsets.assign(num_chunks + 1, 0);
+
+    // LoDs of the previous frame, transitions are only scheduled for an unchanged set of instances
+    const bool has_history = selection.current_lods.size() == instances.count;
+    if (!has_history) {
+        selection.current_lods.assign(instances.count, 0);
+        selection.transitions.clear();
+    }
+    selection.transitions.set_triangle_budget(uint64_t(std::max(_settings.rebuild_triangle_budget, 0)));
+
+    const int num_threads = parallel_thread_count();
+    std::vector<size_t> thread_culled_frustum(num_threads, 0);
+    std::vector<size_t> thread_culled_distance(num_threads, 0);
+    std::vector<std::vector<LoDTransition>> thread_requests(num_threads);
+    std::vector<std::vector<uint32_t>> thread_cancellations(num_threads);
+
+    // pass 1: cull and select LoDs, collect transitions of visible instances
+    parallel_for_ranges(0, num_instances, chunk_size, [&](index_t range_begin, index_t range_end, int thread_idx) {
+        uint32_t visible_count = 0;
+        for (index_t i = range_begin; i < range_end; ++i) {
+            const int pmesh_id = instances.parameterized_mesh_id(i);
+            const glm::mat4 &transform = instances.transform(i);
+            const Sphere &local_bounds = _pmesh_bounds[pmesh_id];
+
+            const glm::vec3 center = glm::vec3(transform * glm::vec4(local_bounds.origin, 1.0f));
+            const float scale = max_axis_scale(transform);
+            const float radius = local_bounds.radius * scale;
+            const float distance = glm::length(center - view.eye);
+
+            bool culled = false;
+            if (distance - radius > max_distance) {
+                ++thread_culled_distance[thread_idx];
+                culled = true;
+            } else if (view.frustum_culling) {
+                for (const auto &plane : planes) {
+                    if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) {
+                        ++thread_culled_frustum[thread_idx];
+                        culled = true;
+                        break;
+                    }
+                }
+            }
+
+            const int lod_group_idx = _pmesh_lod_groups[pmesh_id];
+            int32_t current_lod = selection.current_lods[i];
+            int32_t lod = 0;
+            float threshold_overshoot = 0.0f;
+            if (lod_group_idx > 0 && has_lod_distances) {
+                const auto &lod_info = _lod_group_infos[lod_group_idx];
+                const float *lod_distances = &_final_lod_distances[lod_info.lod_distance_offset];
+                // group distances are computed for the average instance scale, so the projected
+                // error of this instance matches the group's at a scale-corrected distance
+                const float scaled_distance = scale > 0.0f ? distance * lod_info.avg_scale / scale : FLT_MAX;
+                const int num_lods = int(lod_info.detail_reductions.size());
+                // hysteresis: thresholds already crossed move closer, others move farther away
+                auto band_distance = [&](int threshold_lod) {
+                    return lod_distances[threshold_lod] * (threshold_lod <= current_lod
+                        ? 1.0f - lod_info.hysteresis : 1.0f + lod_info.hysteresis);
+                };
+                while (lod + 1 < num_lods && scaled_distance >= band_distance(lod + 1))
+                    ++lod;
+                if (lod != current_lod) {
+                    int threshold_lod = std::max(lod, current_lod);
+                    threshold_overshoot = std::abs(scaled_distance / std::max(band_distance(threshold_lod), FLT_MIN) - 1.0f);
+                }
+            }
+
+            if (!has_history || culled) {
+                // instances that are not part of the acceleration structure switch for free
+                if (has_history && lod != current_lod && selection.transitions.is_pending(uint32_t(i)))
+                    thread_cancellations[thread_idx].push_back(uint32_t(i));
+                current_lod = lod;
+                selection.current_lods[i] = lod;
+            } else if (lod != current_lod) {
+                LoDTransition transition;
+                transition.instance_id = uint32_t(i);
+                transition.from_lod = uint32_t(current_lod);
+                transition.to_lod = uint32_t(lod);
+                transition.triangle_cost = _lod_group_infos[lod_group_idx].triangle_counts[lod];
+                transition.priority = threshold_overshoot;
+                thread_requests[thread_idx].push_back(transition);
+            } else if (selection.transitions.is_pending(uint32_t(i))) {
+                thread_cancellations[thread_idx].push_back(uint32_t(i));
+            }
+
+            selection.instance_lods[i] = culled ? -1 : current_lod;
+            visible_count += !culled;
+        }
+        selection.chunk_offsets[range_begin / chunk_size + 1] = visible_count;
+    });
+
+    // admit transitions within the triangle budget, defer the rest to later frames
+    for (int t = 0; t < num_threads; ++t) {
+        for (uint32_t instance_id : thread_cancellations[t])
+            selection.transitions.cancel(instance_id);
+        for (auto const &transition : thread_requests[t])
+            selection.transitions.request(transition);
+    }
+    for (auto const &transition : selection.transitions.schedule()) {
+        selection.current_lods[transition.instance_id] = int32_t(transition.to_lod);
+        selection.instance_lods[transition.instance_id] = int32_t(transition.to_lod);
+    }
+    selection.admitted_transitions = selection.transitions.admitted().size();
+    selection.deferred_transitions = selection.transitions.pending_count();
+
+    for (index_t c = 0; c < num_chunks; ++c)
+        selection.chunk_offsets[c + 1] += selection.chunk_offsets[c];
+    selection.instances.resize(selection.chunk_offsets[num_chunks]);
+
+    // pass 2: compact visible instances in instance order
+    parallel_for_ranges(0, num_instances, chunk_size, [&](index_t range_begin, index_t range_end, int) {
+        uint32_t out = selection.chunk_offsets[range_begin / chunk_size];
+        for (index_t i = range_begin; i < range_end; ++i) {
+            const int32_t lod = selection.instance_lods[i];
+            if (lod < 0)
+                continue;
+            const int pmesh_id = instances.parameterized_mesh_id(i);
+            const int lod_group_idx = _pmesh_lod_groups[pmesh_id];
+            LoDSelection::Entry entry;
+            entry.instance_id = uint32_t(i);
+            entry.parameterized_mesh_id = lod_group_idx > 0
+                ? _lod_group_infos[lod_group_idx].parameterized_mesh_ids[lod] : pmesh_id;
+            entry.lod = uint32_t(lod);
+            selection.instances[out++] = entry;
+        }
+    });
+
+    selection.culled_frustum = 0;
+    selection.culled_distance = 0;
+    for (size_t t = 0; t < thread_culled_frustum.size(); ++t) {
+        selection.culled_frustum += thread_culled_frustum[t];
+        selection.culled_distance += thread_culled_distance[t];
+    }
+}
+
 void LoDSystem::force_dirty() {
     _is_dirty = true;
 }
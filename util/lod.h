@@ -5,6 +5,7 @@
 
 #include "../librender/bounds.h"
 #include "../librender/scene.h"
+#include "lod_transitions.h"
 
 // Utilities related to LoD system
 
@@ -28,26 +29,77 @@ struct LoDUtils {
                                       const std::vector<float> &detail_reductions);
 };
 
+// Camera state used by the per-instance LoD selection and culling pass
+struct LoDCullingView {
+    glm::vec3 eye = glm::vec3(0.0f);
+    glm::mat4 view_projection = glm::mat4(1.0f); // world to clip space, used for frustum culling
+    bool frustum_culling = true;
+    float max_distance = 0.0f; // instances farther away are culled, 0 disables distance culling
+};
+
+// Strided view of instance data, e.g. an array of structs holding a parameterized mesh id and a transform
+struct LoDInstanceView {
+    const int32_t *parameterized_mesh_ids = nullptr;
+    const glm::mat4 *transforms = nullptr;
+    size_t stride = 0; // in bytes, 0 for tightly packed arrays
+    size_t count = 0;
+
+    int32_t parameterized_mesh_id(size_t i) const {
+        return *reinterpret_cast<const int32_t*>(reinterpret_cast<const char*>(parameterized_mesh_ids) + i * (stride ? stride : sizeof(int32_t)));
+    }
+    const glm::mat4 &transform(size_t i) const {
+        return *reinterpret_cast<const glm::mat4*>(reinterpret_cast<const char*>(transforms) + i * (stride ? stride : sizeof(glm::mat4)));
+    }
+};
+
+// Compacted list of visible instances with their selected levels of detail
+struct LoDSelection {
+    struct Entry {
+        uint32_t instance_id;
+        int32_t parameterized_mesh_id; // parameterized mesh of the selected LoD
+        uint32_t lod;
+    };
+    std::vector<Entry> instances;
+    size_t culled_frustum = 0;
+    size_t culled_distance = 0;
+    size_t admitted_transitions = 0;
+    size_t deferred_transitions = 0;
+
+    // LoD state carried across frames, reset when the instance count changes
+    std::vector<int32_t> current_lods;
+    LoDTransitionScheduler transitions;
+
+    // scratch data reused across frames
+    std::vector<int32_t> instance_lods; // selected LoD per input instance, -1 if culled
+    std::vector<uint32_t> chunk_offsets;
+};
+
 class LoDSystem {
 public:
     struct Settings {
         float global_lod_range_scale = 1.0f;
         float global_lod_range_offset = 0.0f;
+        float lod_hysteresis = 0.1f; // relative width of the band around each LoD distance
+        int rebuild_triangle_budget = RBO_rebuild_triangle_budget_DEFAULT; // per frame, for LoD transitions
     };
 
     // Unfortunately the Scene class is not alive during rendering, so we need to retain
     // specific information for LOD groups
     struct LoDGroupInfo {
         Sphere bounds;
-        float avg_scale; // the average scale transformation applied through instance transforms
+        Sphere local_bounds; // object space, not scaled by avg_scale
+        float avg_scale = 1.0f; // the average scale transformation applied through instance transforms
         uint32_t lod_distance_offset = 0;
         std::vector<float> detail_reductions;
+        std::vector<int> parameterized_mesh_ids;
+        std::vector<uint64_t> triangle_counts; // per LoD
+        float hysteresis = 0.1f; // relative band, switching requires crossing a LoD distance by this fraction
     };
 
     LoDSystem();
 
     // Call this method every time scene or mesh geometry changed
-    void initialize(const Scene& scene);
+    void initialize(const Scene& scene, double time = 0.0);
 
     // Call this method after camera fovy changed
     void update_camera(float fov_y);
@@ -63,6 +115,13 @@ public:
     // The pointer is safe to be incremented up to the number of LoD levels in the group
     const float *get_lod_distances_for_group(uint32_t lod_group_idx) const;
 
+    // Multithreaded per-instance pass for the current camera (see update_camera): culls instances outside
+    // the view frustum or beyond the maximum distance and selects the LoD whose distance range contains
+    // the instance, corrected for the instance scale. Writes a compacted list in instance order.
+    // LoD switches of visible instances are damped by the group hysteresis bands and scheduled
+    // within the rebuild triangle budget, deferred switches keep their previous LoD.
+    void select_instances(LoDSelection &selection, const LoDCullingView &view, const LoDInstanceView &instances) const;
+
     // Force-invalidate the LOD system (to make sure dependent buffers get updated, etc)
     void force_dirty();
     
@@ -76,6 +135,9 @@ private:
     float _cam_fov_y = -1.0f;
     Settings _settings;
     std::vector<LoDGroupInfo> _lod_group_infos;
+    // object-space bounds and LoD group of every parameterized mesh, for per-instance culling
+    std::vector<Sphere> _pmesh_bounds;
+    std::vector<int> _pmesh_lod_groups;
     // camera-dependent (but not yet scaled) lod ranges for each lod group stored in a linearized array
     std::vector<float> _camera_lod_distances;
     std::vector<float> _final_lod_distances;
@@ -0,0 +1,84 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "lod_transitions.h"
+#include <algorithm>
+
+LoDTransitionScheduler::LoDTransitionScheduler(uint64_t triangle_budget)
+    : _triangle_budget(triangle_budget) {
+}
+
+void LoDTransitionScheduler::request(const LoDTransition &transition) {
+    auto it = _pending_index.find(transition.instance_id);
+    if (it != _pending_index.end()) {
+        // keep the age of the pending request, the target may have changed
+        LoDTransition &pending = _pending[it->second];
+        uint32_t deferred_frames = pending.deferred_frames;
+        pending = transition;
+        pending.deferred_frames = deferred_frames;
+        return;
+    }
+    _pending_index[transition.instance_id] = _pending.size();
+    _pending.push_back(transition);
+    _pending.back().deferred_frames = 0;
+}
+
+void LoDTransitionScheduler::cancel(uint32_t instance_id) {
+    auto it = _pending_index.find(instance_id);
+    if (it == _pending_index.end())
+        return;
+    size_t idx = it->second;
+    _pending_index.erase(it);
+    if (idx + 1 != _pending.size()) {
+        _pending[idx] = _pending.back();
+        _pending_index[_pending[idx].instance_id] = idx;
+    }
+    _pending.pop_back();
+}
+
+const std::vector<LoDTransition> &LoDTransitionScheduler::schedule() {
+    _admitted.clear();
+    _admitted_triangles = 0;
+    if (_pending.empty())
+        return _admitted;
+
+    auto effective_priority = [this](const LoDTransition &t) {
+        return t.priority + _aging_rate * float(t.deferred_frames);
+    };
+    // stable tie-breaking by instance for reproducible schedules
+    std::sort(_pending.begin(), _pending.end(), [&](const LoDTransition &a, const LoDTransition &b) {
+        float pa = effective_priority(a), pb = effective_priority(b);
+        if (pa != pb)
+            return pa > pb;
+        return a.instance_id < b.instance_id;
+    });
+
+    // strictly in priority order: once a transition does not fit, all following ones wait,
+    // so large transitions cannot be starved by a stream of small ones
+    std::vector<LoDTransition> deferred;
+    bool budget_exhausted = false;
+    for (auto &transition : _pending) {
+        budget_exhausted |= _admitted_triangles + transition.triangle_cost > _triangle_budget;
+        if (!budget_exhausted || _admitted.empty()) {
+            budget_exhausted = false;
+            _admitted_triangles += transition.triangle_cost;
+            _admitted.push_back(transition);
+        } else {
+            ++transition.deferred_frames;
+            deferred.push_back(transition);
+        }
+    }
+
+    _pending = std::move(deferred);
+    _pending_index.clear();
+    for (size_t i = 0; i < _pending.size(); ++i)
+        _pending_index[_pending[i].instance_id] = i;
+    return _admitted;
+}
+
+void LoDTransitionScheduler::clear() {
+    _pending.clear();
+    _pending_index.clear();
+    _admitted.clear();
+    _admitted_triangles = 0;
+}
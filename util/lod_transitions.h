@@ -0,0 +1,55 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// A requested change of the level of detail of one instance
+struct LoDTransition {
+    uint32_t instance_id = 0;
+    uint32_t from_lod = 0;
+    uint32_t to_lod = 0;
+    uint64_t triangle_cost = 0; // triangles of the target LoD that need to be (re)built
+    float priority = 0.0f; // higher priorities are admitted first
+    uint32_t deferred_frames = 0; // maintained by the scheduler
+};
+
+/* Admits LoD transitions per frame in priority order until the triangle budget
+ * is used up and defers the remaining ones to later frames. Deferred transitions
+ * age, so their priority increases until they are eventually admitted.
+ * At least one transition is admitted per frame, even if it exceeds the budget.
+ */
+class LoDTransitionScheduler {
+public:
+    explicit LoDTransitionScheduler(uint64_t triangle_budget = 500000);
+
+    void set_triangle_budget(uint64_t triangle_budget) { _triangle_budget = triangle_budget; }
+    uint64_t triangle_budget() const { return _triangle_budget; }
+    // priority added per frame a transition has been deferred
+    void set_aging_rate(float aging_rate) { _aging_rate = aging_rate; }
+
+    // Requests a transition, replacing any pending request of the same instance
+    void request(const LoDTransition &transition);
+    // Drops a pending request, e.g. when the instance returned to its current LoD
+    void cancel(uint32_t instance_id);
+    // Selects the transitions to apply this frame, the rest stay pending
+    const std::vector<LoDTransition> &schedule();
+
+    const std::vector<LoDTransition> &admitted() const { return _admitted; }
+    uint64_t admitted_triangles() const { return _admitted_triangles; }
+    size_t pending_count() const { return _pending.size(); }
+    bool is_pending(uint32_t instance_id) const { return _pending_index.count(instance_id) != 0; }
+    void clear();
+
+private:
+    std::vector<LoDTransition> _pending;
+    std::unordered_map<uint32_t, size_t> _pending_index;
+    std::vector<LoDTransition> _admitted;
+    uint64_t _admitted_triangles = 0;
+    uint64_t _triangle_budget;
+    float _aging_rate = 0.1f;
+};
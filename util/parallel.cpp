@@ -0,0 +1,188 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "parallel.h"
+#include "profiling.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct ParallelJob {
+    std::function<void(index_t, index_t, int)> const* range_fn;
+    index_t end;
+    index_t grain_size;
+    std::atomic<index_t> next;
+
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    void run(int thread_idx) {
+        while (true) {
+            index_t range_begin = next.fetch_add(grain_size, std::memory_order_relaxed);
+            if (range_begin >= end)
+                break;
+            try {
+                (*range_fn)(range_begin, std::min(range_begin + grain_size, end), thread_idx);
+            } catch (...) {
+                std::lock_guard<std::mutex> g(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+                next.store(end, std::memory_order_relaxed); // cancel remaining chunks
+            }
+        }
+    }
+};
+
+thread_local bool in_parallel_region = false;
+thread_local bool serial_thread = false;
+thread_local int current_thread_idx = 0; // keeps per-thread indices unique in nested serial calls
+
+struct ParallelPool {
+    std::mutex submit_mutex; // one job at a time, concurrent submitters queue up here
+    std::mutex mutex;
+    std::condition_variable job_available;
+    std::condition_variable job_done;
+    std::vector<std::thread> workers;
+    ParallelJob* job = nullptr;
+    unsigned long long job_generation = 0;
+    int busy_workers = 0;
+    bool shutdown = false;
+    int requested_thread_count = 0;
+
+    ~ParallelPool() {
+        stop();
+    }
+
+    int thread_count() const {
+        return int(workers.size()) + 1;
+    }
+
+    void start(int num_threads) {
+        for (int i = 1; i < num_threads; ++i)
+            workers.emplace_back(&ParallelPool::worker_loop, this, i);
+    }
+    void stop() {
+        {
+            std::lock_guard<std::mutex> g(mutex);
+            shutdown = true;
+        }
+        job_available.notify_all();
+        for (auto& worker : workers)
+            worker.join();
+        workers.clear();
+        shutdown = false;
+    }
+    void ensure_started() {
+        if (!workers.empty() || requested_thread_count == 1)
+            return;
+        int num_threads = requested_thread_count;
+        if (num_threads <= 0)
+            num_threads = std::max(int(std::thread::hardware_concurrency()), 1);
+        requested_thread_count = num_threads;
+        start(num_threads);
+    }
+
+    void worker_loop(int thread_idx) {
+        in_parallel_region = true;
+        current_thread_idx = thread_idx;
+        char name[32];
+        snprintf(name, sizeof(name), "Parallel worker %d", thread_idx);
+        set_profiling_thread_name(name);
+        unsigned long long seen_generation = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            job_available.wait(lock, [&]() { return shutdown || job_generation != seen_generation; });
+            if (shutdown)
+                return;
+            seen_generation = job_generation;
+            // late wake-ups may find the job already retired
+            ParallelJob* current_job = job;
+            if (!current_job)
+                continue;
+            ++busy_workers;
+            lock.unlock();
+            current_job->run(thread_idx);
+            lock.lock();
+            if (--busy_workers == 0)
+                job_done.notify_all();
+        }
+    }
+} parallel_pool;
+
+} // namespace
+
+int parallel_thread_count() {
+    if (serial_thread && !in_parallel_region)
+        return 1;
+    // pool cannot be reconfigured while a job is running
+    if (in_parallel_region)
+        return parallel_pool.thread_count();
+    std::lock_guard<std::mutex> g(parallel_pool.submit_mutex);
+    parallel_pool.ensure_started();
+    return parallel_pool.thread_count();
+}
+
+void set_parallel_thread_count(int num_threads) {
+    // the submitting thread holds submit_mutex and stop() would join the calling worker
+    if (in_parallel_region)
+        return;
+    std::lock_guard<std::mutex> g(parallel_pool.submit_mutex);
+    parallel_pool.stop();
+    parallel_pool.requested_thread_count = std::max(num_threads, 0);
+}
+
+void set_parallel_thread_serial(bool serial) {
+    serial_thread = serial;
+}
+
+void parallel_for_ranges(index_t begin, index_t end, index_t grain_size,
+    std::function<void(index_t, index_t, int)> const& range_fn) {
+    if (begin >= end)
+        return;
+    grain_size = std::max(grain_size, index_t(1));
+
+    // nested, background or trivial work stays on the calling thread
+    if (in_parallel_region || serial_thread || end - begin <= grain_size) {
+        range_fn(begin, end, current_thread_idx);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit_guard(parallel_pool.submit_mutex);
+    parallel_pool.ensure_started();
+    if (parallel_pool.workers.empty()) {
+        range_fn(begin, end, 0);
+        return;
+    }
+
+    ParallelJob job;
+    job.range_fn = &range_fn;
+    job.end = end;
+    job.grain_size = grain_size;
+    job.next.store(begin, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> g(parallel_pool.mutex);
+        parallel_pool.job = &job;
+        ++parallel_pool.job_generation;
+    }
+    parallel_pool.job_available.notify_all();
+
+    in_parallel_region = true;
+    job.run(0);
+    in_parallel_region = false;
+
+    {
+        std::unique_lock<std::mutex> lock(parallel_pool.mutex);
+        parallel_pool.job_done.wait(lock, [&]() { return parallel_pool.busy_workers == 0; });
+        parallel_pool.job = nullptr;
+    }
+
+    if (job.error)
+        std::rethrow_exception(job.error);
+}
@@ -0,0 +1,33 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include "types.h"
+
+// number of threads participating in parallel_for, including the calling thread
+int parallel_thread_count();
+// overrides the number of threads used by parallel_for, 0 restores the hardware default,
+// ignored when called from within parallel_for
+void set_parallel_thread_count(int num_threads);
+// Background threads mark themselves serial so that their parallel_for calls run on the
+// calling thread, instead of holding the pool from the main thread for long jobs.
+void set_parallel_thread_serial(bool serial);
+
+// Calls range_fn(range_begin, range_end, thread_idx) on disjoint sub-ranges of [begin, end),
+// handing out chunks of up to grain_size elements dynamically to a persistent worker pool.
+// The calling thread participates as thread 0, thread_idx < parallel_thread_count().
+// Nested calls from within a worker run serially on the calling thread.
+// Exceptions thrown by range_fn cancel remaining chunks and are rethrown on the calling thread.
+void parallel_for_ranges(index_t begin, index_t end, index_t grain_size,
+    std::function<void(index_t, index_t, int)> const& range_fn);
+
+// per-element convenience wrapper, calls fn(i, thread_idx)
+template <class F>
+inline void parallel_for(index_t begin, index_t end, index_t grain_size, F&& fn) {
+    parallel_for_ranges(begin, end, grain_size, [&fn](index_t range_begin, index_t range_end, int thread_idx) {
+        for (index_t i = range_begin; i < range_end; ++i)
+            fn(i, thread_idx);
+    });
+}
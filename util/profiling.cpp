@@ -11,6 +11,16 @@
 #include "error_io.h"
 #include <mutex>
 #include <atomic>
+#include <cstdio>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define PROFILING_TRACE_TSC
+#endif
 
 ProfilingScopeRecord::ProfilingScopeRecord(char const* name)
     : name(name) {
@@ -41,9 +51,86 @@ struct ProfilingTable {
 
 thread_local int current_scope_level = 0;
 
+namespace {
+
+unsigned long long steady_clock_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// raw TSC ticks, converted to nanoseconds on export
+inline unsigned long long trace_ticks() {
+#ifdef PROFILING_TRACE_TSC
+    return __rdtsc();
+#else
+    return steady_clock_ns();
+#endif
+}
+
+// relaxed atomics, the exporter may read slots that are being overwritten
+struct ProfilingTraceEvent {
+    std::atomic<unsigned long long> ticks; // top bit set for end events
+    std::atomic<char const*> name;
+};
+
+struct ProfilingTraceBuffer {
+    static const unsigned long long CAPACITY = 1 << 14;
+    static const unsigned long long END_EVENT = 1ull << 63;
+    static const int MAX_NAME_LEN = 31;
+
+    // only written by the owning thread, counts all events ever recorded
+    std::atomic<unsigned long long> head = { 0 };
+    ProfilingTraceEvent events[CAPACITY];
+    ProfilingTraceBuffer* next = nullptr;
+    int thread_index = 0;
+    char thread_name[MAX_NAME_LEN + 1];
+};
+
+struct ProfilingTrace {
+    std::atomic<bool> enabled = { false };
+    // buffers are never freed, events of finished threads remain exportable
+    std::atomic<ProfilingTraceBuffer*> buffers = { nullptr };
+    std::atomic<int> num_buffers = { 0 };
+    // clock reference for the tick to time conversion
+    std::atomic<unsigned long long> calibration_ticks = { 0 };
+    std::atomic<unsigned long long> calibration_ns = { 0 };
+} profiling_trace;
+
+thread_local ProfilingTraceBuffer* thread_trace_buffer = nullptr;
+thread_local char thread_trace_name[ProfilingTraceBuffer::MAX_NAME_LEN + 1] = "";
+
+ProfilingTraceBuffer* acquire_trace_buffer() {
+    ProfilingTraceBuffer* buffer = new ProfilingTraceBuffer();
+    buffer->thread_index = profiling_trace.num_buffers.fetch_add(1, std::memory_order_relaxed);
+    if (thread_trace_name[0])
+        memcpy(buffer->thread_name, thread_trace_name, sizeof(buffer->thread_name));
+    else
+        snprintf(buffer->thread_name, sizeof(buffer->thread_name), "Thread %d", buffer->thread_index);
+    buffer->next = profiling_trace.buffers.load(std::memory_order_relaxed);
+    while (!profiling_trace.buffers.compare_exchange_weak(buffer->next, buffer,
+        std::memory_order_release, std::memory_order_relaxed))
+        ;
+    return buffer;
+}
+
+inline void record_trace_event(char const* name, unsigned long long phase) {
+    ProfilingTraceBuffer* buffer = thread_trace_buffer;
+    if (!buffer)
+        buffer = thread_trace_buffer = acquire_trace_buffer();
+    unsigned long long head = buffer->head.load(std::memory_order_relaxed);
+    ProfilingTraceEvent& event = buffer->events[head & (ProfilingTraceBuffer::CAPACITY - 1)];
+    event.ticks.store(trace_ticks() | phase, std::memory_order_relaxed);
+    event.name.store(name, std::memory_order_relaxed);
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+} // namespace
+
 void BasicProfilingScope::begin() {
-    if (persistent_record)
+    if (persistent_record) {
         persistent_record->scope_level = current_scope_level++;
+        if (profiling_trace.enabled.load(std::memory_order_relaxed))
+            record_trace_event(persistent_record->name, 0);
+    }
 
     begin_timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
 }
@@ -52,6 +139,8 @@ void BasicProfilingScope::end() {
     end_timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
 
     if (persistent_record) {
+        if (profiling_trace.enabled.load(std::memory_order_relaxed))
+            record_trace_event(persistent_record->name, ProfilingTraceBuffer::END_EVENT);
         --current_scope_level;
         assert(persistent_record->scope_level == current_scope_level);
 
@@ -136,3 +225,116 @@ void log_profiling_times(bool start_at_watermark) {
     }
     profiling_table.logging_watermark = watermark;
 }
+
+void set_profiling_trace_enabled(bool enabled) {
+    if (enabled && !profiling_trace.calibration_ticks.load(std::memory_order_relaxed)) {
+        profiling_trace.calibration_ns.store(steady_clock_ns(), std::memory_order_relaxed);
+        profiling_trace.calibration_ticks.store(trace_ticks(), std::memory_order_relaxed);
+    }
+    profiling_trace.enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool profiling_trace_enabled() {
+    return profiling_trace.enabled.load(std::memory_order_relaxed);
+}
+
+void set_profiling_thread_name(char const* name) {
+    strncpy(thread_trace_name, name, ProfilingTraceBuffer::MAX_NAME_LEN);
+    thread_trace_name[ProfilingTraceBuffer::MAX_NAME_LEN] = 0;
+    if (thread_trace_buffer)
+        memcpy(thread_trace_buffer->thread_name, thread_trace_name, sizeof(thread_trace_name));
+}
+
+static void write_trace_string(FILE* file, char const* str) {
+    fputc('"', file);
+    for (; *str; ++str) {
+        unsigned char c = (unsigned char) *str;
+        if (c == '"' || c == '\\')
+            fprintf(file, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(file, "\\u%04x", c);
+        else
+            fputc(c, file);
+    }
+    fputc('"', file);
+}
+
+bool write_profiling_trace(char const* filename) {
+    unsigned long long reference_ticks = profiling_trace.calibration_ticks.load(std::memory_order_relaxed);
+    unsigned long long reference_ns = profiling_trace.calibration_ns.load(std::memory_order_relaxed);
+    if (!reference_ticks) {
+        reference_ns = steady_clock_ns();
+        reference_ticks = trace_ticks();
+    }
+    // calibrate over at least 10 ms
+    unsigned long long now_ns, now_ticks;
+    do {
+        now_ns = steady_clock_ns();
+        now_ticks = trace_ticks();
+    } while (now_ns - reference_ns < 10000000);
+    double ns_per_tick = double(now_ns - reference_ns) / double(now_ticks - reference_ticks);
+
+    struct ThreadEvents {
+        ProfilingTraceBuffer const* buffer;
+        std::vector<std::pair<unsigned long long, char const*>> events;
+    };
+    std::vector<ThreadEvents> threads;
+    unsigned long long base_ticks = ~0ull;
+    for (ProfilingTraceBuffer const* buffer = profiling_trace.buffers.load(std::memory_order_acquire);
+         buffer; buffer = buffer->next) {
+        ThreadEvents thread = { buffer, { } };
+        unsigned long long end = buffer->head.load(std::memory_order_acquire);
+        unsigned long long begin = end > ProfilingTraceBuffer::CAPACITY ? end - ProfilingTraceBuffer::CAPACITY : 0;
+        thread.events.reserve(size_t(end - begin));
+        for (unsigned long long i = begin; i < end; ++i) {
+            ProfilingTraceEvent const& event = buffer->events[i & (ProfilingTraceBuffer::CAPACITY - 1)];
+            thread.events.emplace_back(event.ticks.load(std::memory_order_relaxed), event.name.load(std::memory_order_relaxed));
+        }
+        // drop the oldest events, the owning thread may have overwritten them while copying
+        std::atomic_thread_fence(std::memory_order_acquire);
+        unsigned long long overwritten = buffer->head.load(std::memory_order_relaxed) - begin;
+        overwritten = overwritten > ProfilingTraceBuffer::CAPACITY ? overwritten - ProfilingTraceBuffer::CAPACITY : 0;
+        thread.events.erase(thread.events.begin(), thread.events.begin() + size_t(std::min(overwritten, end - begin)));
+        for (auto const& event : thread.events)
+            base_ticks = std::min(base_ticks, event.first & ~ProfilingTraceBuffer::END_EVENT);
+        threads.push_back(std::move(thread));
+    }
+
+    FILE* file = fopen(filename, "w");
+    if (!file) {
+        println(CLL::CRITICAL, "Failed to open profiling trace file %s", filename);
+        return false;
+    }
+    fprintf(file, "{\n\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [");
+    bool first = true;
+    size_t num_events = 0;
+    for (auto const& thread : threads) {
+        int tid = thread.buffer->thread_index;
+        fprintf(file, "%s\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": ", first ? "" : ",", tid);
+        write_trace_string(file, thread.buffer->thread_name);
+        fprintf(file, "}}");
+        first = false;
+
+        // ends of scopes that began before the oldest recorded event have no match
+        int depth = 0;
+        for (auto const& event : thread.events) {
+            bool end_event = (event.first & ProfilingTraceBuffer::END_EVENT) != 0;
+            if (end_event && depth == 0)
+                continue;
+            depth += end_event ? -1 : 1;
+            double us = double((event.first & ~ProfilingTraceBuffer::END_EVENT) - base_ticks) * ns_per_tick * 1.0e-3;
+            fprintf(file, ",\n{\"name\": ");
+            write_trace_string(file, event.second);
+            fprintf(file, ", \"ph\": \"%c\", \"ts\": %.3f, \"pid\": 1, \"tid\": %d}", end_event ? 'E' : 'B', us, tid);
+            ++num_events;
+        }
+    }
+    fprintf(file, "\n]\n}\n");
+    bool success = ferror(file) == 0;
+    success = fclose(file) == 0 && success;
+    if (success)
+        println(CLL::INFORMATION, "Wrote %d profiling events of %d threads to %s", int(num_events), int(threads.size()), filename);
+    else
+        println(CLL::CRITICAL, "Failed to write profiling trace file %s", filename);
+    return success;
+}
@@ -0,0 +1,28 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdio>
+
+// Minimal harness of the unit test executables: CHECK() reports failed
+// conditions and continues, main() returns finish_checks().
+
+static int num_failed = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++num_failed; \
+        } \
+    } while (false)
+
+static int finish_checks() {
+    if (num_failed) {
+        printf("FAILED (%d checks)\n", num_failed);
+        return 1;
+    }
+    printf("passed\n");
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "../compute_cpu.h"
+#include "../parallel.h"
+#include "check.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+struct ScaleParams {
+    float scale;
+    float bias;
+};
+
+// y[i] = scale * x[i] + bias over a 2D dispatch, parameters in a uniform buffer
+static void scale_bias_kernel(CpuComputeWorkgroup const& wg) {
+    auto const* params = wg.buffer<ScaleParams const>(0, 0);
+    float const* x = wg.buffer<float const>(0, 1);
+    float* y = wg.buffer<float>(0, 2);
+    for (unsigned row = wg.begin.y; row < wg.end.y; ++row) {
+        size_t offset = size_t(row) * wg.dispatch_dim.x;
+        for (unsigned col = wg.begin.x; col < wg.end.x; ++col)
+            y[offset + col] = params->scale * x[offset + col] + params->bias;
+    }
+}
+static CpuComputeKernelRegistration register_scale_bias("test_scale_bias", glm::uvec2(16, 4), scale_bias_kernel);
+
+// counts invocations per element, reads the counter buffer of an inherited pipeline
+static void count_kernel(CpuComputeWorkgroup const& wg) {
+    unsigned* counts = wg.buffer<unsigned>(1, 0);
+    for (unsigned row = wg.begin.y; row < wg.end.y; ++row)
+        for (unsigned col = wg.begin.x; col < wg.end.x; ++col)
+            ++counts[size_t(row) * wg.dispatch_dim.x + col];
+}
+static CpuComputeKernelRegistration register_count("test_count", glm::uvec2(8, 8), count_kernel);
+
+void test_dispatch_partial_workgroups() {
+    auto device = create_cpu_compute_device();
+    // dimensions that are not multiples of the workgroup size
+    glm::uvec2 dims(133, 37);
+    size_t count = size_t(dims.x) * dims.y;
+
+    auto params_buffer = device->create_uniform_buffer(sizeof(ScaleParams));
+    auto x_buffer = device->create_buffer(count * sizeof(float));
+    auto y_buffer = device->create_buffer(count * sizeof(float));
+    ScaleParams params = { 2.0f, 1.0f };
+    std::memcpy(params_buffer->map(), &params, sizeof(params));
+    params_buffer->unmap();
+    float* x = (float*) x_buffer->map();
+    for (size_t i = 0; i < count; ++i)
+        x[i] = float(i);
+    x_buffer->unmap();
+
+    auto pipeline = device->create_pipeline();
+    pipeline->add_buffer(0, params_buffer.get(), true);
+    pipeline->add_buffer(1, x_buffer.get());
+    pipeline->add_buffer(2, y_buffer.get());
+    int shader = pipeline->add_shader("test_scale_bias");
+    CHECK(shader == 0);
+    CHECK(pipeline->add_shader("does_not_exist") == -1);
+    pipeline->finalize_build();
+
+    auto* stream = device->sync_command_stream();
+    stream->begin_record();
+    pipeline->run(stream, shader, dims);
+    stream->end_submit();
+
+    float const* y = (float const*) y_buffer->map();
+    int mismatches = 0;
+    for (size_t i = 0; i < count; ++i)
+        mismatches += y[i] != 2.0f * float(i) + 1.0f;
+    CHECK(mismatches == 0);
+    y_buffer->unmap();
+}
+
+void test_inherited_pipeline() {
+    auto device = create_cpu_compute_device();
+    glm::uvec2 dims(70, 70);
+    size_t count = size_t(dims.x) * dims.y;
+    auto counts_buffer = device->create_buffer(count * sizeof(unsigned));
+
+    auto shared = device->create_pipeline();
+    shared->add_buffer(0, counts_buffer.get());
+    shared->finalize_build();
+
+    auto pipeline = device->create_pipeline();
+    pipeline->add_pipeline(0, shared.get());
+    int shader = pipeline->add_shader("test_count");
+    pipeline->finalize_build();
+    for (int i = 0; i < 3; ++i)
+        pipeline->run(device->sync_command_stream(), shader, dims);
+
+    unsigned const* counts = (unsigned const*) counts_buffer->map();
+    int mismatches = 0;
+    for (size_t i = 0; i < count; ++i)
+        mismatches += counts[i] != 3;
+    CHECK(mismatches == 0);
+    counts_buffer->unmap();
+}
+
+int main() {
+    test_dispatch_partial_workgroups();
+    test_inherited_pipeline();
+    set_parallel_thread_count(1);
+    test_dispatch_partial_workgroups();
+    set_parallel_thread_count(0);
+    return finish_checks();
+}
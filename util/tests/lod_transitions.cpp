@@ -0,0 +1,95 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#include "../lod_transitions.h"
+#include "check.h"
+
+#include <cstdio>
+
+static LoDTransition make_transition(uint32_t instance_id, uint32_t to_lod, uint64_t triangle_cost, float priority) {
+    LoDTransition transition;
+    transition.instance_id = instance_id;
+    transition.from_lod = 0;
+    transition.to_lod = to_lod;
+    transition.triangle_cost = triangle_cost;
+    transition.priority = priority;
+    return transition;
+}
+
+void test_priority_order_within_budget() {
+    LoDTransitionScheduler scheduler(1000);
+    scheduler.request(make_transition(0, 1, 400, 0.1f));
+    scheduler.request(make_transition(1, 1, 400, 0.9f));
+    scheduler.request(make_transition(2, 1, 400, 0.5f));
+
+    auto const& admitted = scheduler.schedule();
+    CHECK(admitted.size() == 2);
+    CHECK(admitted.size() == 2 && admitted[0].instance_id == 1 && admitted[1].instance_id == 2);
+    CHECK(scheduler.admitted_triangles() == 800);
+    CHECK(scheduler.pending_count() == 1);
+    CHECK(scheduler.is_pending(0));
+
+    auto const& next = scheduler.schedule();
+    CHECK(next.size() == 1 && next[0].instance_id == 0);
+    CHECK(scheduler.pending_count() == 0);
+}
+
+void test_strict_order_and_oversized() {
+    LoDTransitionScheduler scheduler(100);
+    // a transition larger than the whole budget is still admitted alone
+    scheduler.request(make_transition(0, 2, 500, 1.0f));
+    scheduler.request(make_transition(1, 1, 10, 0.5f));
+    auto const& admitted = scheduler.schedule();
+    CHECK(admitted.size() == 1 && admitted[0].instance_id == 0);
+    CHECK(scheduler.is_pending(1));
+
+    // small transitions do not overtake a deferred higher priority one
+    scheduler.clear();
+    scheduler.request(make_transition(0, 1, 60, 1.0f));
+    scheduler.request(make_transition(1, 1, 60, 0.8f));
+    scheduler.request(make_transition(2, 1, 10, 0.2f));
+    auto const& strict = scheduler.schedule();
+    CHECK(strict.size() == 1 && strict[0].instance_id == 0);
+    CHECK(scheduler.pending_count() == 2);
+}
+
+void test_aging() {
+    LoDTransitionScheduler scheduler(10);
+    scheduler.set_aging_rate(1.0f);
+    scheduler.request(make_transition(0, 1, 10, 0.0f));
+    scheduler.request(make_transition(1, 1, 10, 1.5f));
+    CHECK(scheduler.schedule()[0].instance_id == 1);
+    // instance 0 has waited one frame, a fresh request of equal base priority does not overtake it
+    scheduler.request(make_transition(2, 1, 10, 0.5f));
+    CHECK(scheduler.schedule()[0].instance_id == 0);
+    CHECK(scheduler.schedule()[0].instance_id == 2);
+}
+
+void test_replace_and_cancel() {
+    LoDTransitionScheduler scheduler(0);
+    scheduler.request(make_transition(0, 1, 10, 0.0f));
+    scheduler.request(make_transition(1, 1, 10, 0.0f));
+    scheduler.request(make_transition(2, 1, 10, 0.0f));
+    scheduler.schedule(); // admits instance 0 only
+    CHECK(scheduler.pending_count() == 2);
+
+    // re-requesting replaces the target but keeps a single entry
+    scheduler.request(make_transition(1, 3, 20, 0.0f));
+    CHECK(scheduler.pending_count() == 2);
+    scheduler.cancel(2);
+    CHECK(scheduler.pending_count() == 1);
+    CHECK(!scheduler.is_pending(2));
+    scheduler.cancel(2);
+
+    auto const& admitted = scheduler.schedule();
+    CHECK(admitted.size() == 1 && admitted[0].instance_id == 1 && admitted[0].to_lod == 3);
+    CHECK(scheduler.schedule().empty());
+}
+
+int main() {
+    test_priority_order_within_budget();
+    test_strict_order_and_oversized();
+    test_aging();
+    test_replace_and_cancel();
+    return finish_checks();
+}
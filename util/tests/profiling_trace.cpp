@@ -0,0 +1,96 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Records profiling scopes on all threads, including more events than fit in
+// a ring buffer, and checks that the exported Chrome trace contains balanced
+// begin and end events. Then measures the tracing overhead per scope against
+// the budget documented in profiling.h.
+
+#include "../profiling.h"
+#include "../parallel.h"
+#include "check.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+static std::string read_file(std::string const& path) {
+    std::ifstream f(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>() };
+}
+
+static int count(std::string const& text, char const* pattern) {
+    int n = 0;
+    for (size_t i = text.find(pattern); i != std::string::npos; i = text.find(pattern, i + 1))
+        ++n;
+    return n;
+}
+
+static void nested_scopes() {
+    ProfilingScope outer("Trace outer");
+    ProfilingScope inner("Trace \"inner\"");
+}
+
+static void test_export() {
+    set_profiling_thread_name("Test main");
+    // at least one worker thread besides this one
+    int const num_threads = std::max(parallel_thread_count(), 2);
+    set_parallel_thread_count(num_threads);
+    set_profiling_trace_enabled(true);
+    parallel_for(0, 64 * num_threads, 1, [](index_t, int) {
+        nested_scopes();
+    });
+    // wraps the ring buffer of this thread
+    for (int i = 0; i < 20000; ++i)
+        nested_scopes();
+    set_profiling_trace_enabled(false);
+    // not recorded
+    nested_scopes();
+
+    CHECK(write_profiling_trace("test_profiling_trace.json"));
+    std::string trace = read_file("test_profiling_trace.json");
+    int num_begin = count(trace, "\"ph\": \"B\"");
+    int num_end = count(trace, "\"ph\": \"E\"");
+    CHECK(num_begin > 0 && num_begin == num_end);
+    CHECK(count(trace, "\"thread_name\"") >= 1);
+    CHECK(count(trace, "\"Test main\"") == 1);
+    // begin and end of the inner scopes, escaped
+    CHECK(count(trace, "\"Trace \\\"inner\\\"\"") == num_begin);
+    // the main thread keeps its most recent events, the workers all of theirs
+    CHECK(num_begin <= (1 << 14) / 2 + 2 * 64 * num_threads);
+    printf("exported %d scopes of %d threads\n", num_begin, count(trace, "\"thread_name\""));
+    set_parallel_thread_count(0);
+}
+
+static double scope_ns(bool traced, int iterations) {
+    set_profiling_trace_enabled(traced);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        ProfilingScope scope("Trace overhead");
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    set_profiling_trace_enabled(false);
+    return ns / iterations;
+}
+
+static void test_overhead() {
+    const int iterations = 1000000;
+    double untraced = 1.0e30, traced = 1.0e30;
+    for (int run = 0; run < 5; ++run) {
+        untraced = std::min(untraced, scope_ns(false, iterations));
+        traced = std::min(traced, scope_ns(true, iterations));
+    }
+    double overhead = std::max(traced - untraced, 0.0);
+    printf("scope: %.1f ns untraced, %.1f ns traced, %.1f ns tracing overhead (budget 100 ns)\n",
+        untraced, traced, overhead);
+    CHECK(overhead < 100.0);
+}
+
+int main() {
+    test_export();
+    test_overhead();
+    return finish_checks();
+}
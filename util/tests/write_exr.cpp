@@ -0,0 +1,116 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+// Checks that the parallel EXR block writer produces the same files as the
+// serial tinyexr path for all compressions, and the SSE2 float to half
+// conversion against the scalar reference. Then measures both writers.
+
+#include "../write_image.h"
+#include "../compute_util.h"
+#include "../parallel.h"
+#include "check.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::vector<char> read_file(std::string const& path) {
+    std::ifstream f(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>() };
+}
+
+static std::vector<float> random_rgba(int width, int height) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    std::vector<float> rgba(size_t(width) * height * 4);
+    for (size_t i = 0; i < rgba.size(); i += 4) {
+        // smooth gradients with noise, so that all compressions have something to do
+        size_t pixel = i / 4;
+        for (int c = 0; c < 3; ++c)
+            rgba[i + c] = float(pixel % width) / float(width) + 0.1f * u01(rng);
+        rgba[i + 3] = 1.0f;
+    }
+    return rgba;
+}
+
+void test_float_to_half() {
+    std::mt19937 rng(3);
+    std::vector<float> values;
+    // all exponents including subnormals, infinities and NaNs, random mantissas
+    for (unsigned e = 0; e < 512; ++e) {
+        for (int i = 0; i < 2048; ++i) {
+            FP32 f;
+            f.u = (e << 23) | (rng() & 0x7fffffu);
+            values.push_back(f.f);
+        }
+    }
+    std::vector<unsigned short> halfs(values.size());
+    float_to_half_array(halfs.data(), values.data(), values.size());
+    int mismatches = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        FP32 f;
+        f.f = values[i];
+        mismatches += halfs[i] != float_to_half(f).u;
+    }
+    CHECK(mismatches == 0);
+    printf("float to half: %d mismatches in %d values\n", mismatches, int(values.size()));
+}
+
+template <class F>
+static double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void test_block_writer() {
+    int const width = 1920, height = 1080 + 7; // partial chunks at the bottom
+    std::vector<float> rgba = random_rgba(width, height);
+    std::vector<unsigned short> halfs(rgba.size());
+    float_to_half_array(halfs.data(), rgba.data(), rgba.size());
+
+    // at least two threads, single core machines still take the block path
+    int const num_threads = std::max(parallel_thread_count(), 2);
+    char const* names[] = { "zip", "piz", "rle", "none" };
+    for (int compression = EXR_COMPRESSION_ZIP; compression <= EXR_COMPRESSION_NONE; ++compression) {
+        for (int half = 0; half < 3; ++half) {
+            // half 1: converted by the caller, half 2: converted by write_exr_half
+            auto write = [&](char const* filename) {
+                if (half == 0)
+                    return WriteImage::write_exr(filename, width, height, 4, rgba.data(), ExrCompression(compression));
+                if (half == 1)
+                    return WriteImage::write_exr(filename, width, height, 4, halfs.data(), ExrCompression(compression));
+                return WriteImage::write_exr_half(filename, width, height, 4, rgba.data(), ExrCompression(compression));
+            };
+            set_parallel_thread_count(num_threads);
+            bool parallel_ok = false;
+            double parallel_ms = time_ms([&]() { parallel_ok = write("test_write_exr_parallel"); });
+            set_parallel_thread_count(1);
+            bool serial_ok = false;
+            double serial_ms = time_ms([&]() { serial_ok = write("test_write_exr_serial"); });
+            CHECK(parallel_ok && serial_ok);
+
+            std::vector<char> parallel_file = read_file("test_write_exr_parallel.exr");
+            std::vector<char> serial_file = read_file("test_write_exr_serial.exr");
+            CHECK(!parallel_file.empty() && parallel_file == serial_file);
+            printf("%-4s %s: %.1f ms serial, %.1f ms parallel, %s\n"
+                , names[compression], half ? "half " : "float", serial_ms, parallel_ms
+                , parallel_file == serial_file ? "identical" : "DIFFERENT");
+        }
+    }
+    set_parallel_thread_count(0);
+    std::remove("test_write_exr_parallel.exr");
+    std::remove("test_write_exr_serial.exr");
+}
+
+int main() {
+    test_float_to_half();
+    test_block_writer();
+    return finish_checks();
+}
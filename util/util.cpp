@@ -87,6 +87,13 @@ bool directory_exists(const std::string &directory)
     return std::filesystem::is_directory(directory);
 }
 
+bool create_directories(const std::string &directory)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    return std::filesystem::is_directory(directory, ec);
+}
+
 void get_all_files_in_directory(const std::string &directory, std::vector<std::string> &outputFiles)
 {
     std::filesystem::path dirPath(directory);
@@ -314,6 +321,8 @@ bool launch_sibling_process(const std::vector<std::string>& args) {
 void send_launch_signal(int i) { }
 void wait_for_signal(int i) { }
 
+static unsigned long current_process_id() { return (unsigned long) GetCurrentProcessId(); }
+
 #else
 
 #include <sys/types.h>
@@ -321,6 +330,8 @@ void wait_for_signal(int i) { }
 #include <unistd.h>
 #include <signal.h>
 
+static unsigned long current_process_id() { return (unsigned long) getpid(); }
+
 unsigned long long get_last_modified(char const* fname) {
     struct stat mstat;
     if (stat(fname, &mstat))
@@ -389,3 +400,24 @@ bool in_stack_unwind() { return std::uncaught_exceptions() != 0; }
 void chrono_sleep(int milliseconds) {
     std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
 }
+
+bool write_file_atomically(const std::string &fname, std::function<bool(FILE*)> const& write) {
+    std::string temp_file = fname + "." + std::to_string(current_process_id())
+        + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+    FILE* f = fopen(temp_file.c_str(), "wb");
+    if (!f)
+        return false;
+    bool success = write(f);
+    success &= fclose(f) == 0;
+    if (success) {
+        // replaces the target atomically, concurrent readers see the old or the new file
+#ifdef _WIN32
+        success = MoveFileExA(temp_file.c_str(), fname.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+        success = std::rename(temp_file.c_str(), fname.c_str()) == 0;
+#endif
+    }
+    if (!success)
+        std::remove(temp_file.c_str());
+    return success;
+}
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstdio>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -33,9 +35,15 @@ void canonicalize_path_separator(std::string &path);
 // OS-specific preferred path separator
 char path_separator();
 bool directory_exists(const std::string &directory);
+// creates the directory and missing parents, returns true if the directory exists afterwards
+bool create_directories(const std::string &directory);
 bool file_exists(const std::string &fname);
 std::string read_text_file(const std::string &fname);
 void write_text_file(const std::string &fname, char const* text);
+// writes a file through a temporary file named by process and thread, renamed into place when
+// complete, so that concurrent readers and writers (e.g. of caches) never see partial results;
+// returns false and removes the temporary file if writing failed
+bool write_file_atomically(const std::string &fname, std::function<bool(FILE*)> const& write);
 
 // function that returns all the files inside a directory
 void get_all_files_in_directory(const std::string &directory, std::vector<std::string>& outputFiles);
@@ -5,9 +5,16 @@
 #include "stb_image_write.h"
 #include "tinyexr.h"
 #include "error_io.h"
+#include "compute_util.h"
+#include "parallel.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 bool WriteImage::write_png(const char *filename,
@@ -95,21 +102,63 @@ std::vector<T> separate_interleaved_channels(size_t num_pixels, size_t num_chann
     return sep;
 }
 
-template <class T>
-static bool write_exr_generic(const char *filename, size_t width,
-        size_t height, size_t channels,
-        const T *pixels, ExrCompression compression)
+static int exr_compression_type(ExrCompression compression)
 {
-    constexpr size_t num_channels = 4;
-    if (width == 0 || height == 0 || channels != num_channels || !pixels) {
-        print(CLL::CRITICAL, "Invalid image passed to write_exr\n");
-        return false;
+    switch (compression) {
+        case EXR_COMPRESSION_ZIP:
+            return TINYEXR_COMPRESSIONTYPE_ZIP;
+        case EXR_COMPRESSION_PIZ:
+            return TINYEXR_COMPRESSIONTYPE_PIZ;
+        case EXR_COMPRESSION_RLE:
+            return TINYEXR_COMPRESSIONTYPE_RLE;
+        default:
+            return TINYEXR_COMPRESSIONTYPE_NONE;
     }
+}
 
-    const size_t num_pixels = width * height;
+// Scanlines per chunk, as defined by the EXR format for each compression.
+static int exr_lines_per_block(int compression_type)
+{
+    switch (compression_type) {
+        case TINYEXR_COMPRESSIONTYPE_ZIP:
+            return 16;
+        case TINYEXR_COMPRESSIONTYPE_PIZ:
+            return 32;
+        default:
+            return 1;
+    }
+}
 
-    std::string path{filename};
-    path += ".exr";
+// Note: Channels must be in alphabetical order.
+static void init_exr_rgba_header(EXRHeader &header, EXRChannelInfo (&channel_info)[4],
+    int (&pixel_types)[4], int (&requested_pixel_types)[4],
+    int pixel_type, int requested_pixel_type, int compression_type)
+{
+    memset(channel_info, 0, sizeof(channel_info));
+    channel_info[0].name[0] = 'A';
+    channel_info[1].name[0] = 'B';
+    channel_info[2].name[0] = 'G';
+    channel_info[3].name[0] = 'R';
+    for (int c = 0; c < 4; ++c) {
+        pixel_types[c] = pixel_type;
+        requested_pixel_types[c] = requested_pixel_type;
+    }
+
+    InitEXRHeader(&header);
+    header.num_channels = 4;
+    header.channels = channel_info;
+    header.pixel_types = pixel_types;
+    header.requested_pixel_types = requested_pixel_types;
+    header.compression_type = compression_type;
+}
+
+template <class T>
+static bool write_exr_generic(const std::string &path, size_t width,
+        size_t height, const T *pixels,
+        int requested_pixel_type, int compression_type)
+{
+    constexpr size_t num_channels = 4;
+    const size_t num_pixels = width * height;
 
     // EXR expects the channels to be separated.
     std::vector<T> separated = separate_interleaved_channels(num_pixels,
@@ -120,43 +169,12 @@ static bool write_exr_generic(const char *filename, size_t width,
     img_ptrs[2] = separated.data() + 1 * num_pixels;
     img_ptrs[3] = separated.data();
 
-    // Note: Channels must be in alphabetical order.
     EXRChannelInfo channel_info[num_channels];
-    memset(channel_info, 0, sizeof(EXRChannelInfo)*num_channels);
-
-    channel_info[0].name[0] = 'A';
-    channel_info[1].name[0] = 'B';
-    channel_info[2].name[0] = 'G';
-    channel_info[3].name[0] = 'R';
-
-    int pixel_types[] = { PixelType<T>::pixel_type,
-                          PixelType<T>::pixel_type,
-                          PixelType<T>::pixel_type,
-                          PixelType<T>::pixel_type };
-
+    int pixel_types[num_channels];
+    int requested_pixel_types[num_channels];
     EXRHeader header;
-    InitEXRHeader(&header);
-    header.num_channels = num_channels;
-    header.channels = channel_info;
-    header.pixel_types = pixel_types;
-    header.requested_pixel_types = pixel_types;
-
-    // Compression is slow; >1s for a ZIP compressed full hd image, or 0.5 s
-    // for PIZ compressed. So if possible this should be done in a post process.
-    switch (compression) {
-        case EXR_COMPRESSION_ZIP:
-            header.compression_type = TINYEXR_COMPRESSIONTYPE_ZIP;
-            break;
-        case EXR_COMPRESSION_PIZ:
-            header.compression_type = TINYEXR_COMPRESSIONTYPE_PIZ;
-            break;
-        case EXR_COMPRESSION_RLE:
-            header.compression_type = TINYEXR_COMPRESSIONTYPE_RLE;
-            break;
-        default:
-            header.compression_type = TINYEXR_COMPRESSIONTYPE_NONE;
-            break;
-    }
+    init_exr_rgba_header(header, channel_info, pixel_types, requested_pixel_types,
+        PixelType<T>::pixel_type, requested_pixel_type, compression_type);
 
     EXRImage image;
     InitEXRImage(&image);
@@ -172,16 +190,251 @@ static bool write_exr_generic(const char *filename, size_t width,
     return ret == TINYEXR_SUCCESS;
 }
 
+// Compression is slow; >1s for a ZIP compressed full hd image, or 0.5 s
+// for PIZ compressed, when all chunks are compressed one after another. The
+// block writer below splits the image into strips of whole chunks, which are
+// deinterleaved straight from the source pixels and compressed in parallel,
+// each strip encoded by tinyexr as a small EXR in memory. The chunks are then
+// cut out of the strip files and written in order with one offset table.
+
+// Scanlines per parallel task, a multiple of the lines of every chunk type.
+static const size_t exr_strip_lines = 32;
+
+// Header of a single part scanline EXR, up to the offset table.
+struct ExrHeaderLayout
+{
+    size_t size = 0;
+    size_t data_window = 0; // box2i attribute values
+    size_t display_window = 0;
+};
+
+static uint32_t read_u32(const unsigned char *p) { uint32_t v; memcpy(&v, p, 4); return v; }
+static uint64_t read_u64(const unsigned char *p) { uint64_t v; memcpy(&v, p, 8); return v; }
+
+static bool parse_exr_header(const unsigned char *file, size_t file_size, ExrHeaderLayout &layout)
+{
+    // magic number and version
+    size_t pos = 8;
+    // attributes are name, type, size and value, terminated by an empty name
+    while (pos < file_size && file[pos]) {
+        const char *name = reinterpret_cast<const char*>(file + pos);
+        const void *name_end = memchr(file + pos, 0, file_size - pos);
+        if (!name_end)
+            return false;
+        pos = static_cast<const unsigned char*>(name_end) - file + 1;
+        const void *type_end = memchr(file + pos, 0, file_size - pos);
+        if (!type_end)
+            return false;
+        pos = static_cast<const unsigned char*>(type_end) - file + 1;
+        if (pos + 4 > file_size)
+            return false;
+        size_t value_size = read_u32(file + pos);
+        pos += 4;
+        if (!strcmp(name, "dataWindow") && value_size == 16)
+            layout.data_window = pos;
+        else if (!strcmp(name, "displayWindow") && value_size == 16)
+            layout.display_window = pos;
+        pos += value_size;
+    }
+    layout.size = pos + 1;
+    return layout.size <= file_size && layout.data_window && layout.display_window;
+}
+
+template <class T>
+static void separate_channel(T *dst, const T *src, size_t channel, size_t num_pixels, std::vector<float>&)
+{
+    for (size_t i = 0; i < num_pixels; ++i)
+        dst[i] = src[4 * i + channel];
+}
+
+static void separate_channel(uint16_t *dst, const float *src, size_t channel, size_t num_pixels,
+    std::vector<float> &scratch)
+{
+    scratch.resize(num_pixels);
+    for (size_t i = 0; i < num_pixels; ++i)
+        scratch[i] = src[4 * i + channel];
+    float_to_half_array(dst, scratch.data(), num_pixels);
+}
+
+// Returns false if the strips could not be encoded, without writing anything.
+template <class Stored, class T>
+static bool write_exr_blocks(const std::string &path, size_t width,
+        size_t height, const T *pixels, int compression_type, bool &write_failed)
+{
+    const size_t lines_per_block = exr_lines_per_block(compression_type);
+    const size_t num_strips = (height + exr_strip_lines - 1) / exr_strip_lines;
+
+    struct Strip
+    {
+        std::vector<unsigned char> header; // of the first strip only
+        ExrHeaderLayout layout;
+        std::vector<unsigned char> chunks;
+        std::vector<size_t> chunk_offsets;
+    };
+    std::vector<Strip> strips(num_strips);
+    std::atomic<bool> encoding_failed{false};
+
+    struct Scratch
+    {
+        std::vector<Stored> planes;
+        std::vector<float> channel;
+    };
+    std::vector<Scratch> scratch(parallel_thread_count());
+
+    parallel_for(0, num_strips, 1, [&](index_t s, int thread_idx) {
+        if (encoding_failed)
+            return;
+        Strip &strip = strips[s];
+        const size_t y0 = s * exr_strip_lines;
+        const size_t lines = std::min(exr_strip_lines, height - y0);
+        const size_t strip_pixels = lines * width;
+        const T *src = pixels + y0 * width * 4;
+
+        Scratch &tmp = scratch[thread_idx];
+        tmp.planes.resize(4 * strip_pixels);
+        Stored *img_ptrs[4];
+        for (size_t c = 0; c < 4; ++c) {
+            img_ptrs[c] = tmp.planes.data() + c * strip_pixels;
+            // Flip for ABGR order!
+            separate_channel(img_ptrs[c], src, 3 - c, strip_pixels, tmp.channel);
+        }
+
+        EXRChannelInfo channel_info[4];
+        int pixel_types[4];
+        int requested_pixel_types[4];
+        EXRHeader header;
+        init_exr_rgba_header(header, channel_info, pixel_types, requested_pixel_types,
+            PixelType<Stored>::pixel_type, PixelType<Stored>::pixel_type, compression_type);
+
+        EXRImage image;
+        InitEXRImage(&image);
+        image.num_channels = 4;
+        image.images = reinterpret_cast<unsigned char**>(img_ptrs);
+        image.width = int(width);
+        image.height = int(lines);
+
+        unsigned char *memory = nullptr;
+        const char *err = nullptr;
+        const size_t memory_size = SaveEXRImageToMemory(&image, &header, &memory, &err);
+        if (!memory_size) {
+            FreeEXRErrorMessage(err);
+            encoding_failed = true;
+            return;
+        }
+
+        bool valid = parse_exr_header(memory, memory_size, strip.layout);
+        const size_t num_blocks = (lines + lines_per_block - 1) / lines_per_block;
+        const size_t table_end = strip.layout.size + 8 * num_blocks;
+        valid = valid && table_end <= memory_size;
+        for (size_t b = 0; valid && b < num_blocks; ++b) {
+            // chunks are the y coordinate, the data size and the data
+            const size_t offset = read_u64(memory + strip.layout.size + 8 * b);
+            valid = offset >= table_end && offset + 8 <= memory_size
+                && read_u32(memory + offset) == b * lines_per_block
+                && offset + 8 + read_u32(memory + offset + 4) <= memory_size;
+            if (valid)
+                strip.chunk_offsets.push_back(offset - table_end);
+        }
+        if (valid) {
+            strip.chunks.assign(memory + table_end, memory + memory_size);
+            if (s == 0)
+                strip.header.assign(memory, memory + strip.layout.size);
+        }
+        else
+            encoding_failed = true;
+        free(memory);
+    });
+    if (encoding_failed)
+        return false;
+
+    // the header of the first strip describes the whole image but for its height
+    std::vector<unsigned char> &header = strips[0].header;
+    const int32_t y_max = int32_t(height - 1);
+    memcpy(header.data() + strips[0].layout.data_window + 12, &y_max, 4);
+    memcpy(header.data() + strips[0].layout.display_window + 12, &y_max, 4);
+
+    const size_t num_blocks = (height + lines_per_block - 1) / lines_per_block;
+    std::vector<uint64_t> offsets;
+    offsets.reserve(num_blocks);
+    uint64_t file_pos = header.size() + 8 * num_blocks;
+    for (size_t s = 0; s < num_strips; ++s) {
+        Strip &strip = strips[s];
+        const int32_t y0 = int32_t(s * exr_strip_lines);
+        for (size_t chunk_offset : strip.chunk_offsets) {
+            offsets.push_back(file_pos + chunk_offset);
+            // chunk y coordinates are relative to the strip
+            int32_t y;
+            memcpy(&y, strip.chunks.data() + chunk_offset, 4);
+            y += y0;
+            memcpy(strip.chunks.data() + chunk_offset, &y, 4);
+        }
+        file_pos += strip.chunks.size();
+    }
+
+    FILE* f = fopen(path.c_str(), "wb");
+    bool written = f
+        && fwrite(header.data(), 1, header.size(), f) == header.size()
+        && fwrite(offsets.data(), sizeof(uint64_t), offsets.size(), f) == offsets.size();
+    for (size_t s = 0; written && s < num_strips; ++s)
+        written = fwrite(strips[s].chunks.data(), 1, strips[s].chunks.size(), f) == strips[s].chunks.size();
+    if (f)
+        written = (fclose(f) == 0) && written;
+    if (!written) {
+        print(CLL::CRITICAL, "Failed to write %s\n", path.c_str());
+        write_failed = true;
+    }
+    return true;
+}
+
+template <class Stored, class T>
+static bool write_exr_rgba(const char *filename, size_t width,
+        size_t height, size_t channels,
+        const T *pixels, ExrCompression compression)
+{
+    if (width == 0 || height == 0 || channels != 4 || !pixels) {
+        print(CLL::CRITICAL, "Invalid image passed to write_exr\n");
+        return false;
+    }
+
+    std::string path{filename};
+    path += ".exr";
+
+    const int compression_type = exr_compression_type(compression);
+    if (height > exr_strip_lines && parallel_thread_count() > 1) {
+        bool write_failed = false;
+        if (write_exr_blocks<Stored>(path, width, height, pixels, compression_type, write_failed))
+            return !write_failed;
+        print(CLL::WARNING, "Falling back to serial EXR encoding for %s\n", path.c_str());
+    }
+    if constexpr (!std::is_same<Stored, T>::value) {
+        // same rounding as the block writer, tinyexr's own conversion rounds ties up
+        std::vector<Stored> converted(width * height * 4);
+        float_to_half_array(converted.data(), pixels, converted.size());
+        return write_exr_generic(path, width, height, converted.data(),
+            PixelType<Stored>::pixel_type, compression_type);
+    }
+    else
+        return write_exr_generic(path, width, height, pixels,
+            PixelType<Stored>::pixel_type, compression_type);
+}
+
 bool WriteImage::write_exr(const char *filename,
     unsigned width, unsigned height, unsigned channels,
     const float *pixels, ExrCompression compression)
 {
-    return write_exr_generic(filename, width, height, channels, pixels, compression);
+    return write_exr_rgba<float>(filename, width, height, channels, pixels, compression);
 }
 
 bool WriteImage::write_exr(const char *filename,
     unsigned width, unsigned height, unsigned channels,
         const uint16_t *pixels, ExrCompression compression)
 {
-    return write_exr_generic(filename, width, height, channels, pixels, compression);
+    return write_exr_rgba<uint16_t>(filename, width, height, channels, pixels, compression);
+}
+
+bool WriteImage::write_exr_half(const char *filename,
+    unsigned width, unsigned height, unsigned channels,
+    const float *pixels, ExrCompression compression)
+{
+    return write_exr_rgba<uint16_t>(filename, width, height, channels, pixels, compression);
 }
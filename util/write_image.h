@@ -39,4 +39,9 @@ struct WriteImage
     static bool write_exr(const char *filename,
         unsigned width, unsigned height, unsigned channels,
         const uint16_t *pixels, ExrCompression compression);
+
+    // 32 bit float input, stored as 16 bit float
+    static bool write_exr_half(const char *filename,
+        unsigned width, unsigned height, unsigned channels,
+        const float *pixels, ExrCompression compression);
 };
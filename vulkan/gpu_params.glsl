@@ -109,6 +109,7 @@ struct PushConstantParams {
     LOCAL_RENDER_PARAMETER_POOL \
 
 #include "../rendering/lights/sky_model_arhosek/sky_model.h.glsl"
+#include "../rendering/lights/sky_map.h.glsl"
 
 struct LightSamplingSceneParams {
     int32_t light_count;
@@ -128,6 +129,7 @@ struct SceneParams {
     int32_t _pad3;
 
     LightSamplingSceneParams light_sampling;
+    SkySamplingParams sky_sampling;
 };
 
 #define GLOBAL_RENDER_PARAMETER_POOL \
@@ -158,6 +160,7 @@ struct RasterUniformParams {
 #define SCENE_PARAMS_BIND_POINT 4
 #define RANDOM_NUMBERS_BIND_POINT 5
 #define INSTANCES_BIND_POINT 6
+#define LIGHT_GRID_BIND_POINT 7
 
 #define FRAMEBUFFER_BIND_POINT 8
 #define ACCUMBUFFER_BIND_POINT 9
@@ -177,6 +180,8 @@ struct RasterUniformParams {
 #define HISTORY_AOV_BUFFER2_BIND_POINT 19
 
 #define DENOISE_BUFFER_BIND_POINT 20
+#define LIGHT_GRID_ENTRIES_BIND_POINT 21
+#define SKY_SAMPLING_BIND_POINT 22
 
 #define DEBUG_MODE_BUFFER 24
 
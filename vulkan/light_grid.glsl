@@ -0,0 +1,29 @@
+// Copyright 2023 Intel Corporation.
+// SPDX-License-Identifier: MIT
+
+#ifndef VULKAN_LIGHT_GRID_GLSL
+#define VULKAN_LIGHT_GRID_GLSL
+
+// spatial light grid of the binned light extension, selects NEE lights in
+// the grid light sampling variant
+
+#include "mc/light_sampling.h"
+
+#if RBO_light_sampling_variant == LIGHT_SAMPLING_VARIANT_GRID
+#include "lights/light_grid.h.glsl"
+
+layout(binding = LIGHT_GRID_BIND_POINT, set = 0, std430) buffer LightGridBuffer {
+    LightGridParams light_grid;
+    LightGridCell light_grid_cells[];
+};
+
+layout(binding = LIGHT_GRID_ENTRIES_BIND_POINT, set = 0, std430) buffer LightGridEntriesBuffer {
+    LightGridEntry light_grid_entries[];
+};
+
+#define SCENE_GET_LIGHT_GRID_PARAMS() light_grid
+#define SCENE_GET_LIGHT_GRID_CELL(cell_id) light_grid_cells[cell_id]
+#define SCENE_GET_LIGHT_GRID_ENTRY(entry_id) light_grid_entries[entry_id]
+#endif
+
+#endif
@@ -10,6 +10,7 @@
 #include "types.h"
 #include "util.h"
 #include "profiling.h"
+#include "error_io.h"
 
 #include <algorithm>
 #include <numeric>
@@ -45,6 +46,9 @@ void RenderBinnedLightsVulkan::internal_release_resources() {
     if (backend->binned_light_params == light_params)
         backend->binned_light_params = nullptr;
     light_params = nullptr;
+    light_params_back = nullptr;
+    light_grid = nullptr;
+    light_grid_entries = nullptr;
 }
 
 std::string RenderBinnedLightsVulkan::name() const {
@@ -56,13 +60,83 @@ void RenderBinnedLightsVulkan::initialize(const int fb_width, const int fb_heigh
 }
 
 bool RenderBinnedLightsVulkan::is_active_for(RenderBackendOptions const& rbo) const {
-    return rbo.light_sampling_variant == LIGHT_SAMPLING_VARIANT_RIS;
+    return rbo.light_sampling_variant == LIGHT_SAMPLING_VARIANT_RIS
+        || rbo.light_sampling_variant == LIGHT_SAMPLING_VARIANT_GRID;
 }
 
 void RenderBinnedLightsVulkan::preprocess(CommandStream* cmd_stream, int variant_idx) {
     assert(is_active_for(backend->active_options));
 
-    //printf("Todo: update lights\n");
+    if (lights && active_scene && lights->dynamic.has_animated_emitters())
+        update_dynamic_lights(static_cast<vkrt::CommandStream*>(cmd_stream));
+}
+
+void RenderBinnedLightsVulkan::update_dynamic_lights(vkrt::CommandStream* cmd_stream) {
+    lights->dynamic.update(*active_scene, backend->time);
+    if (lights->dynamic.changed_emitters.empty())
+        return;
+
+    std::vector<glm::uvec2> dirty_ranges;
+    refit_light_sampling(lights->binned, lights->dynamic.emitters, lights->dynamic.changed_emitters, dirty_ranges);
+    lights->dynamic.changed_emitters.clear();
+    // note: the light grid is not refit, moved lights stay reachable through its global fallback
+
+    // the back buffer is missing the changes of the previous update and this one
+    std::swap(light_params, light_params_back);
+    std::vector<glm::uvec2> upload_ranges(back_dirty_ranges);
+    upload_ranges.insert(upload_ranges.end(), dirty_ranges.begin(), dirty_ranges.end());
+    std::sort(upload_ranges.begin(), upload_ranges.end(), [](glm::uvec2 a, glm::uvec2 b) { return a.x < b.x; });
+    std::vector<VkBufferCopy> copy_regions;
+    for (auto range : upload_ranges) {
+        if (!copy_regions.empty() && copy_regions.back().srcOffset + copy_regions.back().size >= range.x * sizeof(TriLightData)) {
+            auto& prev = copy_regions.back();
+            prev.size = std::max(prev.size, range.y * sizeof(TriLightData) - prev.srcOffset);
+            continue;
+        }
+        VkBufferCopy copy_cmd = {};
+        copy_cmd.srcOffset = range.x * sizeof(TriLightData);
+        copy_cmd.dstOffset = copy_cmd.srcOffset;
+        copy_cmd.size = (range.y - range.x) * sizeof(TriLightData);
+        copy_regions.push_back(copy_cmd);
+    }
+    back_dirty_ranges = std::move(dirty_ranges);
+
+    // note: the staging buffer of the back buffer was last read by the copy for the frame before the previous one
+    auto upload_light_params = light_params->secondary_for_host(VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    char *map = (char*) upload_light_params->map();
+    for (auto const& region : copy_regions)
+        std::memcpy(map + region.srcOffset, (char const*) lights->binned.emitters.data() + region.srcOffset, region.size);
+    upload_light_params->unmap();
+
+    bool own_stream = !cmd_stream;
+    if (own_stream) {
+        cmd_stream = device.sync_command_stream();
+        cmd_stream->begin_record();
+    }
+
+    vkCmdCopyBuffer(cmd_stream->current_buffer,
+                    upload_light_params->handle(),
+                    light_params->handle(),
+                    uint32_t(copy_regions.size()),
+                    copy_regions.data());
+
+    BUFFER_BARRIER(buf_barrier);
+    buf_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buf_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    buf_barrier.buffer = light_params->handle();
+    vkCmdPipelineBarrier(cmd_stream->current_buffer,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                         0,
+                         0, nullptr,
+                         1, &buf_barrier,
+                         0, nullptr);
+
+    if (own_stream)
+        cmd_stream->end_submit();
+
+    // export for interop extensions
+    backend->binned_light_params = light_params;
 }
 
 void RenderBinnedLightsVulkan::update_scene_from_backend(const Scene &scene) {
@@ -76,7 +150,9 @@ void RenderBinnedLightsVulkan::update_scene_from_backend(const Scene &scene) {
     if (this->lights_revision != scene.lights_revision) {
         if (!lights)
             lights = std::make_unique<LightSamplingSetup>();
-        lights->emitters = collect_emitters(scene);
+        lights->dynamic.initialize(scene, backend->time);
+        lights->emitters = lights->dynamic.emitters;
+        lights->scene_bounds = scene.compute_bounds();
         update_lights(backend->lighting_params);
         this->lights_revision = scene.lights_revision;
     }
@@ -84,6 +160,7 @@ void RenderBinnedLightsVulkan::update_scene_from_backend(const Scene &scene) {
     device->flush_sync_and_async_device_copies();
 
     unique_scene_id = scene.unqiue_id;
+    active_scene = &scene;
 }
 
 void RenderBinnedLightsVulkan::register_descriptors(vkrt::BindingLayoutCollector collector, vkrt::RenderPipelineOptions const& options) const {
@@ -91,32 +168,39 @@ void RenderBinnedLightsVulkan::register_descriptors(vkrt::BindingLayoutCollector
     set_layout
         .add_binding(
             LIGHTS_BIND_POINT, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_ALL)
+        .add_binding(
+            LIGHT_GRID_BIND_POINT, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_ALL)
+        .add_binding(
+            LIGHT_GRID_ENTRIES_BIND_POINT, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_ALL)
         ;
 }
 
 void RenderBinnedLightsVulkan::update_shader_descriptor_table(vkrt::BindingCollector collector, vkrt::RenderPipelineOptions const& options, VkDescriptorSet desc_set) {
     auto& updater = collector.set;
     updater
-        .write_ssbo(desc_set, LIGHTS_BIND_POINT, light_params);
+        .write_ssbo(desc_set, LIGHTS_BIND_POINT, light_params)
+        .write_ssbo(desc_set, LIGHT_GRID_BIND_POINT, light_grid)
+        .write_ssbo(desc_set, LIGHT_GRID_ENTRIES_BIND_POINT, light_grid_entries);
 }
 
 void RenderBinnedLightsVulkan::update_lights(LightSamplingConfig const& params) {
     update_light_sampling(lights->binned, lights->emitters, params);
 
-    // todo once dynamic: cycle light buffers
-
     auto async_commands = device.async_command_stream();
 
     size_t lightBufferSize = std::max(size_t(1), lights->emitters.size());
     lightBufferSize = std::max(lightBufferSize, lights->binned.emitters.size());
-    if (!light_params || light_params.size() / sizeof(TriLightData) < lightBufferSize) {
-        light_params = vkrt::Buffer::device(reuse(vkrt::MemorySource(*device, backend->base_arena_idx + backend->StaticArenaOffset), light_params),
-            sizeof(TriLightData) * lightBufferSize,
-            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
-    }
-    if (!lights->binned.emitters.empty())
-    {
-        auto upload_light_params = light_params->secondary_for_host(VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    // both front and back buffers receive the full emitter set, dynamic updates then only touch changed ranges
+    for (vkrt::Buffer* buffer : { &light_params, &light_params_back }) {
+        if (!*buffer || buffer->size() / sizeof(TriLightData) < lightBufferSize) {
+            *buffer = vkrt::Buffer::device(reuse(vkrt::MemorySource(*device, backend->base_arena_idx + backend->StaticArenaOffset), *buffer),
+                sizeof(TriLightData) * lightBufferSize,
+                VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        }
+        if (lights->binned.emitters.empty())
+            continue;
+
+        auto upload_light_params = (*buffer)->secondary_for_host(VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
         void *map = upload_light_params->map();
 
         // todo: support quantization
@@ -130,13 +214,14 @@ void RenderBinnedLightsVulkan::update_lights(LightSamplingConfig const& params)
         copy_cmd.size = upload_light_params->size();
         vkCmdCopyBuffer(async_commands->current_buffer,
                         upload_light_params->handle(),
-                        light_params->handle(),
+                        (*buffer)->handle(),
                         1,
                         &copy_cmd);
 
         async_commands->end_submit();
         // do not need to wait since (secondary) upload buffer is kept for later updates
     }
+    back_dirty_ranges.clear();
 
     // todo: this needs to become more flexible for other techniques
     glsl::SceneParams& sceneParams = backend->global_params(true)->scene_params;
@@ -146,6 +231,64 @@ void RenderBinnedLightsVulkan::update_lights(LightSamplingConfig const& params)
 
     // export for interop extensions
     backend->binned_light_params = light_params;
+
+    update_light_grid(lights->grid, lights->binned.emitters, lights->binned.radiances, lights->scene_bounds, lights->grid_config);
+    upload_light_grid();
+}
+
+void RenderBinnedLightsVulkan::upload_light_grid() {
+    auto const& grid = lights->grid;
+    size_t gridBufferSize = sizeof(LightGridParams) + sizeof(LightGridCell) * std::max(grid.cells.size(), size_t(1));
+    size_t entriesBufferSize = sizeof(LightGridEntry) * std::max(grid.entries.size(), size_t(1));
+
+    if (!light_grid || light_grid.size() < gridBufferSize) {
+        light_grid = vkrt::Buffer::device(reuse(vkrt::MemorySource(*device, backend->base_arena_idx + backend->StaticArenaOffset), light_grid),
+            gridBufferSize,
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    }
+    if (!light_grid_entries || light_grid_entries.size() < entriesBufferSize) {
+        light_grid_entries = vkrt::Buffer::device(reuse(vkrt::MemorySource(*device, backend->base_arena_idx + backend->StaticArenaOffset), light_grid_entries),
+            entriesBufferSize,
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    }
+
+    auto upload_grid = light_grid->secondary_for_host(VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    auto upload_entries = light_grid_entries->secondary_for_host(VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    {
+        char *map = (char*) upload_grid->map();
+        std::memcpy(map, &grid.params, sizeof(LightGridParams));
+        std::memcpy(map + sizeof(LightGridParams), grid.cells.data(), grid.cells.size() * sizeof(LightGridCell));
+        upload_grid->unmap();
+    }
+    {
+        void *map = upload_entries->map();
+        std::memcpy(map, grid.entries.data(), grid.entries.size() * sizeof(LightGridEntry));
+        upload_entries->unmap();
+    }
+
+    auto async_commands = device.async_command_stream();
+    async_commands->begin_record();
+
+    VkBufferCopy copy_cmd = {};
+    copy_cmd.size = upload_grid->size();
+    vkCmdCopyBuffer(async_commands->current_buffer,
+                    upload_grid->handle(),
+                    light_grid->handle(),
+                    1,
+                    &copy_cmd);
+    copy_cmd.size = upload_entries->size();
+    vkCmdCopyBuffer(async_commands->current_buffer,
+                    upload_entries->handle(),
+                    light_grid_entries->handle(),
+                    1,
+                    &copy_cmd);
+
+    async_commands->end_submit();
+    // do not need to wait since (secondary) upload buffers are kept for later updates
+
+    println(CLL::VERBOSE, "Light grid: %d x %d x %d cells, %d entries, %.2f MB"
+        , grid.params.resolution.x, grid.params.resolution.y, grid.params.resolution.z
+        , grid.params.entry_count, double(grid.size_in_bytes()) / (1024.0 * 1024.0));
 }
 
 // todo: move somewhere more central when more light sampling algorithms come in
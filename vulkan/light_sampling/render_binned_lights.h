@@ -12,10 +12,14 @@ struct RenderBinnedLightsVulkan : RenderPipelineExtensionVulkan {
     RenderVulkan* backend;
 
     std::unique_ptr<LightSamplingSetup> lights;
-    vkrt::Buffer light_params = nullptr;
+    vkrt::Buffer light_params = nullptr; // front buffer, bound for rendering
+    vkrt::Buffer light_params_back = nullptr; // swapped in on dynamic emitter updates
+    std::vector<glm::uvec2> back_dirty_ranges; // emitter ranges updated in the front buffer only
+    vkrt::Buffer light_grid = nullptr; // LightGridParams header followed by cells
+    vkrt::Buffer light_grid_entries = nullptr;
     unsigned unique_scene_id = 0;
     unsigned lights_revision = ~0;
-    // todo once dynamic: swap buffers
+    Scene const* active_scene = nullptr;
 
     RenderBinnedLightsVulkan(RenderVulkan* backend);
     virtual ~RenderBinnedLightsVulkan();
@@ -33,4 +37,6 @@ struct RenderBinnedLightsVulkan : RenderPipelineExtensionVulkan {
     void update_shader_descriptor_table(vkrt::BindingCollector collector, vkrt::RenderPipelineOptions const& options, VkDescriptorSet desc_set) override;
 
     void update_lights(LightSamplingConfig const& params);
+    void upload_light_grid();
+    void update_dynamic_lights(vkrt::CommandStream* cmd_stream);
 };
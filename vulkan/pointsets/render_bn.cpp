@@ -7,12 +7,12 @@
 #include "types.h"
 #include "util.h"
 #include "profiling.h"
+#include "pointset_tables.h"
 
 #include <algorithm>
 #include <numeric>
 
 #include "../rendering/pointsets/bn_data.h"
-#include "../rendering/pointsets/bn_tables.h"
 
 namespace glsl {
     using namespace glm;
@@ -78,6 +78,10 @@ void RenderBNPointsVulkan::update_random_buf()
 {
     auto async_commands = device.async_command_stream();
 
+    mapped_vector<uint32_t> tables = load_bn_tables(BNTableConfig::compiled());
+    if (tables.nbytes() != sizeof(BNData))
+        throw_error("Blue noise tables do not match the BNData layout");
+
     random_numbers_buf = vkrt::Buffer::device(
         *device,
         sizeof(BNData),
@@ -85,25 +89,7 @@ void RenderBNPointsVulkan::update_random_buf()
     {
         auto upload_random_numbers = random_numbers_buf.for_host(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, vkrt::MemorySource(*device, vkrt::Device::ScratchArena));
         BNData* map = (BNData*) upload_random_numbers->map();
-        static_assert(sizeof(map->sobol_spp_d) == sizeof(sobol_256spp_256d), "Sobol sample array misconfigured");
-        std::memcpy(&map->sobol_spp_d, sobol_256spp_256d, sizeof(map->sobol_spp_d));
-        static_assert(sizeof(map->tile_scrambling_yx_d_1spp) == sizeof(scramblingTile_yx_d_1spp), "Scrambling tile size misconfigured");
-        //static_assert(sizeof(map->tile_ranking_yx_d_1spp) == sizeof(rankingTile_yx_d_1spp), "Ranking tile size misconfigured");
-        std::memcpy(&map->tile_scrambling_yx_d_1spp, scramblingTile_yx_d_1spp, sizeof(map->tile_scrambling_yx_d_1spp));
-        //std::memcpy(&map->tile_ranking_yx_d_1spp, rankingTile_yx_d_1spp, sizeof(map->tile_ranking_yx_d_1spp)); // omitting all zeros:
-        assert(rankingTile_yx_d_1spp[0] == 0 && 0 == memcmp(rankingTile_yx_d_1spp, &rankingTile_yx_d_1spp[1], sizeof(rankingTile_yx_d_1spp)-sizeof(rankingTile_yx_d_1spp[0])));
-        static_assert(sizeof(map->tile_scrambling_yx_d_4spp) == sizeof(scramblingTile_yx_d_4spp), "Scrambling tile size misconfigured");
-        static_assert(sizeof(map->tile_ranking_yx_d_4spp) == sizeof(rankingTile_yx_d_4spp), "Ranking tile size misconfigured");
-        std::memcpy(&map->tile_scrambling_yx_d_4spp, scramblingTile_yx_d_4spp, sizeof(map->tile_scrambling_yx_d_4spp));
-        std::memcpy(&map->tile_ranking_yx_d_4spp, rankingTile_yx_d_4spp, sizeof(map->tile_ranking_yx_d_4spp));
-        static_assert(sizeof(map->tile_scrambling_yx_d_16spp) == sizeof(scramblingTile_yx_d_16spp), "Scrambling tile size misconfigured");
-        static_assert(sizeof(map->tile_ranking_yx_d_16spp) == sizeof(rankingTile_yx_d_16spp), "Ranking tile size misconfigured");
-        std::memcpy(&map->tile_scrambling_yx_d_16spp, scramblingTile_yx_d_16spp, sizeof(map->tile_scrambling_yx_d_16spp));
-        std::memcpy(&map->tile_ranking_yx_d_16spp, rankingTile_yx_d_16spp, sizeof(map->tile_ranking_yx_d_16spp));
-        static_assert(sizeof(map->tile_scrambling_yx_d_256spp) == sizeof(scramblingTile_yx_d_256spp), "Scrambling tile size misconfigured");
-        static_assert(sizeof(map->tile_ranking_yx_d_256spp) == sizeof(rankingTile_yx_d_256spp), "Ranking tile size misconfigured");
-        std::memcpy(&map->tile_scrambling_yx_d_256spp, scramblingTile_yx_d_256spp, sizeof(map->tile_scrambling_yx_d_256spp));
-        std::memcpy(&map->tile_ranking_yx_d_256spp, rankingTile_yx_d_256spp, sizeof(map->tile_ranking_yx_d_256spp));
+        std::memcpy(map, tables.data(), sizeof(BNData));
         upload_random_numbers->unmap();
 
         async_commands->begin_record();
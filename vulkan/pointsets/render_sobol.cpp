@@ -7,11 +7,11 @@
 #include "types.h"
 #include "util.h"
 #include "profiling.h"
+#include "pointset_tables.h"
 
 #include <algorithm>
 #include <numeric>
 
-#include "../rendering/pointsets/sobol_tables.h"
 #include "../rendering/pointsets/sobol_data.h"
 
 namespace glsl {
@@ -79,6 +79,10 @@ void RenderSobolVulkan::update_random_buf()
 {
     auto async_commands = device.async_command_stream();
 
+    mapped_vector<uint32_t> tables = load_sobol_tables(SobolTableConfig::compiled());
+    if (tables.nbytes() != sizeof(SobolData))
+        throw_error("Sobol tables do not match the SobolData layout");
+
     random_numbers_buf = vkrt::Buffer::device(
         *device,
         sizeof(SobolData),
@@ -86,10 +90,7 @@ void RenderSobolVulkan::update_random_buf()
     {
         auto upload_random_numbers = random_numbers_buf.for_host(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, vkrt::MemorySource(*device, vkrt::Device::ScratchArena));
         SobolData* map = (SobolData*) upload_random_numbers->map();
-        static_assert(sizeof(map->matrix) == sizeof(SobolMatrix), "Sobol matrix size misconfigured");
-        std::memcpy(&map->matrix, SobolMatrix, sizeof(map->matrix));
-        static_assert(sizeof(map->tile_invert_1_0) == sizeof(SobolInversion_1_0), "Sobol tile inversion size misconfigured");
-        std::memcpy(&map->tile_invert_1_0, SobolInversion_1_0, sizeof(map->tile_invert_1_0));
+        std::memcpy(map, tables.data(), sizeof(SobolData));
         upload_random_numbers->unmap();
 
         async_commands->begin_record();
@@ -76,6 +76,10 @@ layout(binding = LIGHTS_BIND_POINT, set = 0, std430) buffer LightParamsBuffer {
     TriLightData global_lights[];
 };
 
+layout(binding = SKY_SAMPLING_BIND_POINT, set = 0, std430) buffer SkySamplingBuffer {
+    float sky_sampling_map[];
+};
+
 layout(binding = 0, set = TEXTURE_BIND_SET) uniform sampler2D textures[];
 #ifdef STANDARD_TEXTURE_BIND_SET
 layout(binding = 0, set = STANDARD_TEXTURE_BIND_SET) uniform sampler2D standard_textures[];
@@ -98,30 +102,27 @@ layout(push_constant) uniform PushConstants {
 
 #define SCENE_GET_LIGHT_SOURCE(light_id) decode_tri_light(global_lights[nonuniformEXT(light_id)])
 #define SCENE_GET_LIGHT_SOURCE_COUNT()   int(scene_params.light_sampling.light_count)
+#define SCENE_GET_SKY_MAP_VALUE(index) sky_sampling_map[index]
 
 #define BINNED_LIGHTS_BIN_SIZE int(view_params.light_sampling.bin_size)
 #define SCENE_GET_BINNED_LIGHTS_BIN_COUNT() (int(scene_params.light_sampling.light_count + (view_params.light_sampling.bin_size - 1)) / int(view_params.light_sampling.bin_size))
 
 #define CUSTOM_MATERIAL_ALPHA
 #include "rt/material_textures.glsl"
+#include "light_grid.glsl"
 #include "mc/nee.glsl"
 
 #include "mc/shade_megakernel.glsl"
 
-#include "lights/sky_model_arhosek/sky_model.glsl"
+#include "lights/sky_map.glsl"
 
 vec3 compute_sky_illum(vec3 ray_origin, vec3 ray_dir, float prev_bsdf_pdf) {
     vec3 atmosphere_illum;
     vec3 sun_illum;
 
     vec3 dir = ray_dir;
-    float ocean_coeff = 1.0f;
-    if (dir.y <= 0.0f) {
-        dir.y = -dir.y;
-        ocean_coeff = 0.7 * pow(max(1.0 - abs(dir.y), 0.0), 5);
-    }
-
-    atmosphere_illum = max( skymodel_radiance(scene_params.sky_params, scene_params.sun_dir, dir), vec3(0.0f) ) * ocean_coeff;
+    atmosphere_illum = sky_atmosphere_radiance(scene_params.sky_params, scene_params.sun_dir, dir);
+    float ocean_coeff = sky_ocean_mirror(dir);
     if (dot(dir, scene_params.sun_dir) >= scene_params.sun_cos_angle)
         sun_illum = vec3(scene_params.sun_radiance) * ocean_coeff;
     else
@@ -129,19 +130,23 @@ vec3 compute_sky_illum(vec3 ray_origin, vec3 ray_dir, float prev_bsdf_pdf) {
 
     vec3 illum = vec3(0.0f);
 
-    illum += abs(atmosphere_illum);
     {
         NEEQueryPoint query;
         query.point = ray_origin;
         query.normal = vec3(0.0f); // todo: query points need to be serializable, not currently using prev_n;
         query.w_o = vec3(0.0f); // todo: query points need to be serializable, not currently using prev_wo;
         query.info = NEEQueryInfo(0);
+        float sky_w = 1.0f;
 #ifndef PT_DISABLE_NEE
         float light_pdf = eval_direct_sun_light_pdf(query, ray_dir);
         float w = nee_mis_heuristic(1.f, prev_bsdf_pdf, 1.f, light_pdf);
+#ifdef SKY_SAMPLING_GLSL
+        sky_w = nee_mis_heuristic(1.f, prev_bsdf_pdf, 1.f, eval_direct_sky_light_pdf(query, ray_dir));
+#endif
 #else
         float w = 1.0f;
 #endif
+        illum += sky_w * abs(atmosphere_illum);
         illum += w * abs(sun_illum);
     }
 
@@ -681,6 +686,8 @@ EXPLICIT_MASK_END
             NEESampledArea nee_area;
             nee_area.type = LIGHT_TYPE_TRIANGLE;
             nee_area.approx_solid_angle = approx_tri_solid_angle;
+            nee_area.query_point = ray_origin;
+            nee_area.w_i = ray_dir;
             vec3 w_i;
             ShadingQueryAux aux;
             int shading_result = shade_megakernel(shading_state
@@ -103,6 +103,9 @@ RenderVulkan::RenderVulkan(vkrt::Device const& dev)
     cached_gpu_params.reset(new ParameterCache());
 
     null_buffer = vkrt::Buffer::device(*device, sizeof(uint64_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    sky_sampling_buf = vkrt::Buffer::device(*device,
+                                        sizeof(float) * SKY_MAP_SIZE(SKY_MAP_DEFAULT_WIDTH, SKY_MAP_DEFAULT_HEIGHT),
+                                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
     null_texture = vkrt::Texture2D::device(*device
         , glm::ivec4(1, 1, 1, 0)
         , VK_FORMAT_R8G8B8A8_UNORM
@@ -188,6 +191,7 @@ void RenderVulkan::internal_release_resources()
 
     // Light data
     light_data_buf = nullptr;
+    sky_sampling_buf = nullptr;
 }
 
 std::string RenderVulkan::name() const
@@ -1216,6 +1220,33 @@ void RenderVulkan::update_meshes(const Scene &scene, bool& update_sbt, bool& reb
     }
 }
 
+VkAccelerationStructureInstanceKHR RenderVulkan::make_tlas_instance(vkrt::Instance const& inst, int parameterized_mesh_id
+    , uint32_t instance_mask, uint32_t& instanced_geometry_count) const {
+    VkAccelerationStructureInstanceKHR vkinst = { };
+#ifdef IMPLICIT_INSTANCE_PARAMS
+    vkinst.instanceCustomIndex = parameterized_meshes[parameterized_mesh_id].render_mesh_base_offset;
+#else
+    vkinst.instanceCustomIndex = instanced_geometry_count;
+#endif
+    vkinst.instanceShaderBindingTableRecordOffset =
+        parameterized_meshes[parameterized_mesh_id].render_mesh_base_offset;
+    vkinst.flags = parameterized_meshes[parameterized_mesh_id].no_alpha ? VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR : 0;
+    int mesh_id = parameterized_meshes[parameterized_mesh_id].mesh_id;
+    vkinst.accelerationStructureReference = meshes[mesh_id]->device_address;
+    vkinst.mask = instance_mask;
+
+    // Note: 4x3 row major
+    const glm::mat4 m = glm::transpose(inst.transform);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            vkinst.transform.matrix[r][c] = m[r][c];
+        }
+    }
+
+    instanced_geometry_count += parameterized_meshes[parameterized_mesh_id].render_mesh_count;
+    return vkinst;
+}
+
 void RenderVulkan::default_update_tlas(std::unique_ptr<vkrt::TopLevelBVH>& scene_bvh, bool rebuild_tlas
                , int lod_offset, uint32_t instance_mask) {
     vkrt::MemorySource static_memory_arena(device, base_arena_idx + StaticArenaOffset);
@@ -1240,34 +1271,19 @@ void RenderVulkan::default_update_tlas(std::unique_ptr<vkrt::TopLevelBVH>& scene
 
         for (int i = 0, ie = int_cast(instances.size()); i < ie; ++i) {
             const auto &inst = instances[i];
-            VkAccelerationStructureInstanceKHR vkinst = { };
             int parameterized_mesh_id = inst.parameterized_mesh_id;
-            auto& lodGroup = this->lod_groups[parameterized_mesh_id];
-            if (!lodGroup.mesh_ids.empty())
-                parameterized_mesh_id = lodGroup.mesh_ids[std::min(lod_offset, (int) lodGroup.mesh_ids.size() -1)];
-#ifdef IMPLICIT_INSTANCE_PARAMS
-            vkinst.instanceCustomIndex = parameterized_meshes[parameterized_mesh_id].render_mesh_base_offset;
-#else
-            vkinst.instanceCustomIndex = instancedGeometryCount;
-#endif
-            vkinst.instanceShaderBindingTableRecordOffset =
-                parameterized_meshes[parameterized_mesh_id].render_mesh_base_offset;
-            vkinst.flags = parameterized_meshes[parameterized_mesh_id].no_alpha ? VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR : 0;
-            int mesh_id = parameterized_meshes[parameterized_mesh_id].mesh_id;
-            vkinst.accelerationStructureReference = meshes[mesh_id]->device_address;
-            vkinst.mask = instance_mask;
-
-            // Note: 4x3 row major
-            const glm::mat4 m = glm::transpose(inst.transform);
-            for (int r = 0; r < 3; ++r) {
-                for (int c = 0; c < 4; ++c) {
-                    vkinst.transform.matrix[r][c] = m[r][c];
-                }
+            uint32_t mask = instance_mask;
+            if (lod_offset == 0) {
+                // keep the current per-instance LoD selection
+                parameterized_mesh_id = tlas_parameterized_mesh_id(i);
+                if (i < ilen(tlas_parameterized_mesh_ids) && tlas_parameterized_mesh_ids[i] < 0)
+                    mask = 0;
+            } else {
+                auto& lodGroup = this->lod_groups[parameterized_mesh_id];
+                if (!lodGroup.mesh_ids.empty())
+                    parameterized_mesh_id = lodGroup.mesh_ids[std::min(lod_offset, (int) lodGroup.mesh_ids.size() -1)];
             }
-
-            map[i] = vkinst;
-
-            instancedGeometryCount += parameterized_meshes[parameterized_mesh_id].render_mesh_count;
+            map[i] = make_tlas_instance(inst, parameterized_mesh_id, mask, instancedGeometryCount);
         }
 
         upload_instances->unmap();
@@ -1373,6 +1389,14 @@ void RenderVulkan::update_instances(const Scene &scene, bool rebuild_tlas) {
     auto async_commands = device.async_command_stream();
     auto sync_commands = device.sync_command_stream();
 
+    instance_animation.initialize(scene, this->time);
+    instance_bounds.initialize(scene);
+    instance_bounds.transform(instance_animation.transforms.data());
+    lod_system = LoDSystem();
+    if (!scene.lod_groups.empty())
+        lod_system.initialize(scene, this->time);
+    lod_selection = LoDSelection();
+    tlas_parameterized_mesh_ids.clear();
     instances.resize(scene.instances.size());
     parameterized_instances.resize(parameterized_meshes.size());
     for (auto& pi : parameterized_instances)
@@ -1391,27 +1415,16 @@ void RenderVulkan::update_instances(const Scene &scene, bool rebuild_tlas) {
 
             vkrt::Instance vkinst;
             vkinst.parameterized_mesh_id = inst.parameterized_mesh_id;
-
-            const auto &animData = scene.animation_data.at(inst.animation_data_index);
-            constexpr uint32_t frame = 0;
-            vkinst.transform = animData.dequantize(inst.transform_index, frame);
+            vkinst.transform = instance_animation.transforms[i];
 
             instances[i] = vkinst;
 
-            // todo: incorporate lod groups
-            glm::vec3 aabbMin(FLT_MAX, FLT_MAX, FLT_MAX);
-            glm::vec3 aabbMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-            for (auto& geo : scene.meshes[scene.parameterized_meshes[vkinst.parameterized_mesh_id].mesh_id].geometries) {
-                aabbMin = min(geo.base, aabbMin);
-                aabbMax = max(geo.base + geo.extent, aabbMax);
-            }
-
-            map[i].minX = aabbMin.x;
-            map[i].minY = aabbMin.y;
-            map[i].minZ = aabbMin.z;
-            map[i].maxX = aabbMax.x;
-            map[i].maxY = aabbMax.y;
-            map[i].maxZ = aabbMax.z;
+            map[i].minX = instance_bounds.lower_x[i];
+            map[i].minY = instance_bounds.lower_y[i];
+            map[i].minZ = instance_bounds.lower_z[i];
+            map[i].maxX = instance_bounds.upper_x[i];
+            map[i].maxY = instance_bounds.upper_y[i];
+            map[i].maxZ = instance_bounds.upper_z[i];
 
 
             parameterized_instances[vkinst.parameterized_mesh_id].push_back(i);
@@ -1468,22 +1481,166 @@ void RenderVulkan::update_instances(const Scene &scene, bool rebuild_tlas) {
     }
 }
 
-void RenderVulkan::update_instance_params() {
+namespace {
+    // makes transfer writes, e.g. to TLAS instances, visible to subsequent builds and shaders
+    void transfer_barrier(VkCommandBuffer cmd_buf, VkBuffer buffer) {
+        BUFFER_BARRIER(buf_barrier);
+        buf_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        buf_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        buf_barrier.buffer = buffer;
+        vkCmdPipelineBarrier(cmd_buf,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                             0,
+                             0, nullptr,
+                             1, &buf_barrier,
+                             0, nullptr);
+    }
+}
+
+void RenderVulkan::update_animated_instances(vkrt::CommandStream* cmd_stream) {
+    moved_instance_transforms = nullptr;
+    moved_instance_regions.clear();
+    if (!instance_animation.has_animation() || !scene_bvh || !instance_animation.update(this->time))
+        return;
+    auto const& moved = instance_animation.moved_instances;
+    instance_bounds.transform(instance_animation.transforms.data(), moved.data(), moved.size());
+
+    vkrt::MemorySource scratch_memory_arena(device, vkrt::Device::ScratchArena);
+    constexpr size_t transform_offset = offsetof(VkAccelerationStructureInstanceKHR, transform);
+    auto upload_transforms = vkrt::Buffer::host(scratch_memory_arena
+        , moved.size() * sizeof(VkTransformMatrixKHR), VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    VkTransformMatrixKHR *map = reinterpret_cast<VkTransformMatrixKHR*>(upload_transforms->map());
+    moved_instance_regions.reserve(moved.size());
+    for (int k = 0, ke = ilen(moved); k < ke; ++k) {
+        uint32_t i = moved[k];
+        instances[i].transform = instance_animation.transforms[i];
+
+        // Note: 4x3 row major
+        const glm::mat4 m = glm::transpose(instances[i].transform);
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                map[k].matrix[r][c] = m[r][c];
+            }
+        }
+
+        // only the transform of the instance record changes
+        VkBufferCopy copy_cmd = {};
+        copy_cmd.srcOffset = k * sizeof(VkTransformMatrixKHR);
+        copy_cmd.dstOffset = i * sizeof(VkAccelerationStructureInstanceKHR) + transform_offset;
+        copy_cmd.size = sizeof(VkTransformMatrixKHR);
+        moved_instance_regions.push_back(copy_cmd);
+    }
+    upload_transforms->unmap();
+    moved_instance_transforms = upload_transforms;
+    cmd_stream->hold_buffer(upload_transforms);
+
+    copy_moved_instance_transforms(cmd_stream->current_buffer, *scene_bvh);
+    if (vkrt::CmdTraceRaysKHR)
+        request_tlas_operation(BVHOperation::Refit);
+
+#ifndef IMPLICIT_INSTANCE_PARAMS
+    // instanced geometry parameters carry copies of the instance transforms
+    instance_params_generation = ~0;
+    update_instance_params(cmd_stream);
+#endif
+    ++tlas_content_generation;
+}
+
+void RenderVulkan::copy_moved_instance_transforms(VkCommandBuffer cmd_buf, vkrt::TopLevelBVH& tlas) {
+    if (moved_instance_regions.empty())
+        return;
+    vkCmdCopyBuffer(cmd_buf,
+                    moved_instance_transforms->handle(),
+                    tlas.instance_buf->handle(),
+                    uint32_t(moved_instance_regions.size()),
+                    moved_instance_regions.data());
+    transfer_barrier(cmd_buf, tlas.instance_buf->handle());
+}
+
+void RenderVulkan::update_instance_selection(vkrt::CommandStream* cmd_stream) {
+    bool enabled = active_options.enable_lod_selection && !lod_system.get_lod_group_infos().empty();
+    // nothing to select, or nothing to restore after the selection was disabled
+    if (!scene_bvh || instances.empty() || (!enabled && tlas_parameterized_mesh_ids.empty()))
+        return;
+
+    std::vector<int32_t> selected_ids;
+    if (enabled) {
+        ProfilingScope profile_selection("Select instance LoDs");
+        LoDSystem::Settings settings = lod_system.get_settings();
+        if (settings.rebuild_triangle_budget != active_options.rebuild_triangle_budget) {
+            settings.rebuild_triangle_budget = active_options.rebuild_triangle_budget;
+            lod_system.update_settings(settings);
+        }
+
+        LoDInstanceView instance_view;
+        instance_view.parameterized_mesh_ids = &instances[0].parameterized_mesh_id;
+        instance_view.transforms = &instances[0].transform;
+        instance_view.stride = sizeof(vkrt::Instance);
+        instance_view.count = instances.size();
+        lod_system.select_instances(lod_selection, lod_culling_view, instance_view);
+
+        selected_ids.assign(instances.size(), -1);
+        for (auto const& entry : lod_selection.instances)
+            selected_ids[entry.instance_id] = entry.parameterized_mesh_id;
+    }
+    // the selection is stable across most frames, only changes are uploaded
+    if (selected_ids == tlas_parameterized_mesh_ids)
+        return;
+    tlas_parameterized_mesh_ids = std::move(selected_ids);
+
+    // all records are rewritten, since instanced geometry offsets depend on the selected meshes
+    vkrt::MemorySource scratch_memory_arena(device, vkrt::Device::ScratchArena);
+    auto upload_instances = vkrt::Buffer::host(scratch_memory_arena
+        , instances.size() * sizeof(VkAccelerationStructureInstanceKHR), VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    VkAccelerationStructureInstanceKHR *map = reinterpret_cast<VkAccelerationStructureInstanceKHR*>(upload_instances->map());
+    uint32_t instanced_geometry_count = 0;
+    for (size_t i = 0, ie = instances.size(); i < ie; ++i) {
+        bool culled = !tlas_parameterized_mesh_ids.empty() && tlas_parameterized_mesh_ids[i] < 0;
+        map[i] = make_tlas_instance(instances[i], tlas_parameterized_mesh_id(i), culled ? 0 : 0xff, instanced_geometry_count);
+    }
+    upload_instances->unmap();
+
+    VkBufferCopy copy_cmd = {};
+    copy_cmd.size = upload_instances->size();
+    vkCmdCopyBuffer(cmd_stream->current_buffer,
+                    upload_instances->handle(),
+                    scene_bvh->instance_buf->handle(),
+                    1,
+                    &copy_cmd);
+    cmd_stream->hold_buffer(upload_instances);
+
+    transfer_barrier(cmd_stream->current_buffer, scene_bvh->instance_buf->handle());
+
+    // switched meshes and masks keep the instance count, so a refit suffices
+    if (vkrt::CmdTraceRaysKHR)
+        request_tlas_operation(BVHOperation::Refit);
+#ifndef IMPLICIT_INSTANCE_PARAMS
+    // instanced geometry parameters are laid out per selected mesh
+    instance_params_generation = ~0;
+    update_instance_params(cmd_stream);
+#endif
+    ++tlas_content_generation;
+}
+
+void RenderVulkan::update_instance_params(vkrt::CommandStream* cmd_stream) {
     if (instance_params_generation == render_meshes_generation)
         return;
 
     vkrt::MemorySource static_memory_arena(device, base_arena_idx + StaticArenaOffset);
     vkrt::MemorySource scratch_memory_arena(device, vkrt::Device::ScratchArena);
 
-    auto sync_commands = device.sync_command_stream();
+    // during a frame, the upload is recorded on the frame's commands, otherwise submitted right away
+    auto upload_commands = cmd_stream ? cmd_stream : device.sync_command_stream();
+    vkrt::Buffer previous_param_buf = instance_param_buf;
 
     int instanced_geometry_count = 0;
 #ifdef IMPLICIT_INSTANCE_PARAMS
     for (auto& pm : parameterized_meshes)
         instanced_geometry_count = std::max(pm.render_mesh_base_offset + pm.render_mesh_count, instanced_geometry_count);
 #else
-    for (auto& inst : instances)
-        instanced_geometry_count += parameterized_meshes[inst.parameterized_mesh_id].render_mesh_count;
+    for (size_t i = 0, ie = instances.size(); i < ie; ++i)
+        instanced_geometry_count += parameterized_meshes[tlas_parameterized_mesh_id(i)].render_mesh_count;
 #endif
 
     instance_param_buf = vkrt::Buffer::device(reuse(static_memory_arena, instance_param_buf),
@@ -1511,8 +1668,9 @@ void RenderVulkan::update_instance_params() {
 #else
         std::vector<InstancedGeometry> geo_instances;
         geo_instances.reserve(instanced_geometry_count);
-        for (const auto& inst : this->instances) {
-            auto const& geoms = render_meshes[inst.parameterized_mesh_id];
+        for (size_t inst_idx = 0, inst_end = this->instances.size(); inst_idx < inst_end; ++inst_idx) {
+            const auto& inst = this->instances[inst_idx];
+            auto const& geoms = render_meshes[tlas_parameterized_mesh_id(inst_idx)];
 
             size_t inst_geom_idx = geo_instances.size();
             geo_instances.resize(geo_instances.size() + geoms.size());
@@ -1536,16 +1694,23 @@ void RenderVulkan::update_instance_params() {
         std::memcpy(map, geo_instances.data(), upload_params->size());
         upload_params->unmap();
 
-        sync_commands->begin_record();
+        if (!cmd_stream)
+            upload_commands->begin_record();
 
         VkBufferCopy copy_cmd = {};
         copy_cmd.size = upload_params->size();
-        vkCmdCopyBuffer(sync_commands->current_buffer
+        vkCmdCopyBuffer(upload_commands->current_buffer
             , upload_params->handle()
             , instance_param_buf->handle(), 1, &copy_cmd);
-        sync_commands->hold_buffer(upload_params);
+        upload_commands->hold_buffer(upload_params);
 
-        sync_commands->end_submit();
+        if (cmd_stream) {
+            // frames still in flight may read the previous parameters
+            if (previous_param_buf)
+                cmd_stream->hold_buffer(previous_param_buf);
+            transfer_barrier(cmd_stream->current_buffer, instance_param_buf->handle());
+        } else
+            upload_commands->end_submit();
     }
 
     instance_params_generation = render_meshes_generation;
@@ -1997,6 +2162,11 @@ void RenderVulkan::begin_frame(CommandStream* cmd_stream_, const RenderConfigura
     // For the following frame
     *ref_view_params() = *view_params();
 
+    lod_system.update_camera(config.camera.fovy);
+    lod_culling_view.eye = config.camera.pos;
+    lod_culling_view.view_projection = view_params()->VP;
+    lod_culling_view.frustum_culling = active_options.lod_frustum_culling;
+
     //if (!cmd_stream_)
     //    cmd_stream->end_submit();
 }
@@ -2162,6 +2332,8 @@ void RenderVulkan::draw_frame(CommandStream* cmd_stream_, int variant_idx) {
     if (!cmd_stream_)
         cmd_stream->begin_record();
 
+    update_animated_instances(cmd_stream);
+    update_instance_selection(cmd_stream);
     execute_pending_tlas_operations(cmd_stream->current_buffer);
 
     auto md = profiling_data.start_timing(cmd_stream->current_buffer, ProfilingMarker::Rendering, swap_index);
@@ -2314,6 +2486,8 @@ void RenderVulkan::register_descriptors(vkrt::BindingLayoutCollector collector,
             MATERIALS_BIND_POINT, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_ALL)
         .add_binding(
             INSTANCES_BIND_POINT, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_ALL)
+        .add_binding(
+            SKY_SAMPLING_BIND_POINT, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_ALL)
         ;
 
     if (options.enable_rayqueries) {
@@ -2405,6 +2579,7 @@ void RenderVulkan::update_shader_descriptor_table(vkrt::BindingCollector collect
         .write_ubo(desc_set, SCENE_PARAMS_BIND_POINT, global_param_buf)
         .write_ssbo(desc_set, MATERIALS_BIND_POINT, mat_params)
         .write_ssbo(desc_set, INSTANCES_BIND_POINT, instance_param_buf)
+        .write_ssbo(desc_set, SKY_SAMPLING_BIND_POINT, sky_sampling_buf)
     ;
 
     if (options.enable_rayqueries) {
@@ -14,6 +14,9 @@
 #include "../librender/render_data.h"
 #include "../librender/gpu_programs.h"
 #include "../librender/lights.h"
+#include "../librender/instance_animation.h"
+#include "../librender/instance_bounds.h"
+#include "../util/lod.h"
 
 namespace glsl {
     struct ViewParams;
@@ -65,6 +68,9 @@ struct RenderVulkan : RenderBackend {
     vkrt::Buffer light_data_buf = nullptr;
     std::vector<LightData> lightData;
 
+    // Sky importance sampling map, rebuilt with the sky light
+    vkrt::Buffer sky_sampling_buf = nullptr;
+
     vkrt::Buffer instance_param_buf = nullptr;
     vkrt::Buffer instance_aabb_buf = nullptr;
     vkrt::Buffer parameterized_instance_buf = nullptr;
@@ -96,6 +102,16 @@ struct RenderVulkan : RenderBackend {
     std::vector<std::vector<RenderMeshParams>> render_meshes; // note: indexed by parameterized mesh id!
     std::vector<std::vector<std::string>> shader_names; // note: indexed by parameterized mesh id
     std::vector<vkrt::Instance> instances;
+    InstanceAnimation instance_animation;
+    // transforms of the instances moved in the current frame, and their regions in TLAS instance buffers
+    vkrt::Buffer moved_instance_transforms = nullptr;
+    std::vector<VkBufferCopy> moved_instance_regions;
+    InstanceBounds instance_bounds;
+    // per-frame LoD selection and culling of instances, see RenderBackendOptions::enable_lod_selection
+    LoDSystem lod_system;
+    LoDSelection lod_selection;
+    LoDCullingView lod_culling_view;
+    std::vector<int32_t> tlas_parameterized_mesh_ids; // per instance as referenced by the TLAS, -1 if culled, empty if unselected
     std::vector<LodGroup> lod_groups; // note: indexed by parameterized mesh id!
     std::vector<std::vector<uint32_t>> parameterized_instances; // note: indexed by parameterized mesh id!
     std::unique_ptr<vkrt::TopLevelBVH> scene_bvh;
@@ -256,18 +272,34 @@ struct RenderVulkan : RenderBackend {
     void update_meshes(const Scene &scene, bool &update_sbt, bool &rebuild_sbt);
     void update_lights(const Scene &scene);
     void update_instances(const Scene &scene, bool rebuild_tlas);
+    // re-uploads the transforms and bounds of instances moved by the animation, requests a TLAS refit
+    // and lets active extensions update their own TLASes
+    void update_animated_instances(vkrt::CommandStream* cmd_stream);
+    // copies the transforms of the instances moved in this frame into the instances of the given TLAS,
+    // built by default_update_tlas; the caller refits it
+    void copy_moved_instance_transforms(VkCommandBuffer cmd_buf, vkrt::TopLevelBVH& tlas);
+    // selects LoDs and culls instances for the current camera, rewrites the TLAS instances if the selection changed
+    void update_instance_selection(vkrt::CommandStream* cmd_stream);
+    // parameterized mesh of the selected LoD, culled instances keep the one they reference
+    int tlas_parameterized_mesh_id(size_t instance) const {
+        int id = instance < tlas_parameterized_mesh_ids.size() ? tlas_parameterized_mesh_ids[instance] : -1;
+        return id >= 0 ? id : instances[instance].parameterized_mesh_id;
+    }
+    VkAccelerationStructureInstanceKHR make_tlas_instance(vkrt::Instance const& inst, int parameterized_mesh_id
+        , uint32_t instance_mask, uint32_t& instanced_geometry_count) const;
     void default_update_tlas(std::unique_ptr<vkrt::TopLevelBVH>& scene_bvh, bool rebuild_tlas
         , int lod_offset, uint32_t instance_mask);
     void request_tlas_operation(BVHOperation op);
     bool has_pending_tlas_operations();
     void execute_pending_tlas_operations(VkCommandBuffer command_buffer);
     void update_tlas(bool rebuild_tlas);
-    void update_instance_params();
+    void update_instance_params(vkrt::CommandStream* cmd_stream = nullptr);
 
     void update_textures(const Scene &scene);
     void update_materials(const Scene &scene);
 
     void update_sky_light(SceneConfig const& config);
+    void upload_sky_sampling_map(std::vector<float> const& map);
 
     void record_frame(VkCommandBuffer command_buffer, int variant_idx, int num_rayqueries = 0, int samples_per_query = -1);
     void record_readback(VkCommandBuffer command_buffer, vkrt::Texture2D* target);